@@ -469,6 +469,32 @@ std::unique_ptr<mfem::ParMesh> refineAndDistribute(mfem::Mesh&& serial_mesh, con
   return parallel_mesh;
 }
 
+std::vector<std::unique_ptr<mfem::ParMesh>> refineAndDistributeHierarchy(mfem::Mesh&&   serial_mesh,
+                                                                         const int      refine_serial,
+                                                                         const int      refine_parallel,
+                                                                         const MPI_Comm comm)
+{
+  for (int lev = 0; lev < refine_serial; lev++) {
+    serial_mesh.UniformRefinement();
+  }
+
+  std::vector<std::unique_ptr<mfem::ParMesh>> levels;
+  levels.push_back(std::make_unique<mfem::ParMesh>(comm, serial_mesh));
+
+  // Nodes are created before refining, so that the finer levels' refinement transformations
+  // (used to build transfer operators between levels) are the last operation on each mesh
+  levels.back()->EnsureNodes();
+  levels.back()->ExchangeFaceNbrData();
+
+  for (int lev = 0; lev < refine_parallel; lev++) {
+    levels.push_back(std::make_unique<mfem::ParMesh>(*levels.back()));
+    levels.back()->UniformRefinement();
+    levels.back()->ExchangeFaceNbrData();
+  }
+
+  return levels;
+}
+
 }  // namespace mesh
 }  // namespace serac
 
@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <variant>
+#include <vector>
 #include "mfem.hpp"
 
 #include "serac/infrastructure/input.hpp"
@@ -223,6 +224,24 @@ struct NBallInputOptions {
 std::unique_ptr<mfem::ParMesh> refineAndDistribute(mfem::Mesh&& serial_mesh, const int refine_serial = 0,
                                                    const int refine_parallel = 0, const MPI_Comm comm = MPI_COMM_WORLD);
 
+/**
+ * @brief Finalizes a serial mesh into a refined parallel mesh, keeping each level of parallel refinement
+ *
+ * @param[in] serial_mesh The "base" serial mesh
+ * @param[in] refine_serial The number of serial refinements
+ * @param[in] refine_parallel The number of parallel refinements
+ * @param[in] comm The MPI communicator
+ *
+ * @return The parallel meshes, ordered from coarsest to finest, where each one is a uniform refinement of the
+ * previous one (e.g. to build a geometric multigrid hierarchy). The last mesh is the same as the one returned by
+ * refineAndDistribute() with the same arguments.
+ *
+ * @note Only the parallel refinements produce levels, as the serial refinements happen before partitioning
+ */
+std::vector<std::unique_ptr<mfem::ParMesh>> refineAndDistributeHierarchy(
+    mfem::Mesh&& serial_mesh, const int refine_serial = 0, const int refine_parallel = 0,
+    const MPI_Comm comm = MPI_COMM_WORLD);
+
 }  // namespace mesh
 
 }  // namespace serac
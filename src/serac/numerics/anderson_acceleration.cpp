@@ -0,0 +1,80 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/anderson_acceleration.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac {
+
+AndersonAcceleration::AndersonAcceleration(int depth, MPI_Comm comm) : depth_(depth), comm_(comm)
+{
+  SLIC_ERROR_ROOT_IF(depth_ < 0, "Anderson acceleration depth must be nonnegative");
+}
+
+void AndersonAcceleration::reset()
+{
+  f_previous_.Destroy();
+  g_previous_.Destroy();
+  dF_.clear();
+  dG_.clear();
+}
+
+void AndersonAcceleration::next(const mfem::Vector& x, const mfem::Vector& gx, mfem::Vector& x_next)
+{
+  mfem::Vector f(gx);
+  f -= x;
+
+  if (depth_ > 0 && f_previous_.Size() == f.Size()) {
+    dF_.emplace_back(f);
+    dF_.back() -= f_previous_;
+    dG_.emplace_back(gx);
+    dG_.back() -= g_previous_;
+    if (static_cast<int>(dF_.size()) > depth_) {
+      dF_.pop_front();
+      dG_.pop_front();
+    }
+  }
+
+  f_previous_ = f;
+  g_previous_ = gx;
+
+  const int m = historySize();
+
+  mfem::Vector gamma(m);
+  if (m > 0) {
+    // solve the (small) least squares problem with the normal equations
+    mfem::DenseMatrix A(m, m);
+    mfem::Vector      b(m);
+    double            trace = 0.0;
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j <= i; j++) {
+        A(i, j) = A(j, i) = mfem::InnerProduct(comm_, dF_[size_t(i)], dF_[size_t(j)]);
+      }
+      b(i) = mfem::InnerProduct(comm_, dF_[size_t(i)], f);
+      trace += A(i, i);
+    }
+
+    // a little regularization guards against (nearly) linearly dependent residual differences
+    for (int i = 0; i < m; i++) {
+      A(i, i) += 1.0e-12 * trace;
+    }
+
+    if (trace > 0.0) {
+      mfem::DenseMatrixInverse A_inv(A);
+      A_inv.Mult(b, gamma);
+    } else {
+      gamma = 0.0;
+    }
+  }
+
+  x_next = gx;
+  for (int i = 0; i < m; i++) {
+    x_next.Add(-gamma(i), dG_[size_t(i)]);
+  }
+}
+
+}  // namespace serac
@@ -0,0 +1,87 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file anderson_acceleration.hpp
+ *
+ * @brief Anderson mixing for accelerating fixed-point iterations x = g(x)
+ */
+
+#pragma once
+
+#include <deque>
+
+#include "mfem.hpp"
+
+namespace serac {
+
+/**
+ * @brief Anderson acceleration (a.k.a. Anderson mixing) of a fixed-point iteration x_{k+1} = g(x_k)
+ *
+ * Given the most recent iterate x_k and its image g_k = g(x_k), the next iterate is the combination
+ * of the last (depth + 1) images whose residuals f_i = g_i - x_i have the smallest (least squares) combination:
+ *
+ *   gamma   = argmin || f_k - dF gamma ||
+ *   x_{k+1} = g_k - dG gamma
+ *
+ * where the columns of dF and dG are the differences of successive residuals and images. With depth == 0,
+ * this is the plain fixed-point iteration x_{k+1} = g_k.
+ *
+ * @code{.cpp}
+ * AndersonAcceleration anderson(5, comm);
+ * for (int k = 0; k < max_iterations; k++) {
+ *   g(x, gx);
+ *   if (converged(x, gx)) break;
+ *   anderson.next(x, gx, x);
+ * }
+ * @endcode
+ */
+class AndersonAcceleration {
+public:
+  /**
+   * @brief create an Anderson mixing scheme
+   *
+   * @param depth the number of previous iterates used to compute the next one
+   * @param comm the communicator the vectors are distributed over
+   */
+  AndersonAcceleration(int depth, MPI_Comm comm);
+
+  /// @brief discard the history, e.g. before starting a new fixed-point iteration
+  void reset();
+
+  /**
+   * @brief compute the next iterate
+   *
+   * @param x the current iterate x_k
+   * @param gx the image of the current iterate, g(x_k)
+   * @param x_next the next iterate x_{k+1} (may alias x)
+   */
+  void next(const mfem::Vector& x, const mfem::Vector& gx, mfem::Vector& x_next);
+
+  /// @brief the number of previous iterates that were used to compute the most recent iterate
+  int historySize() const { return static_cast<int>(dF_.size()); }
+
+private:
+  /// @brief the maximum number of previous iterates to use
+  int depth_;
+
+  /// @brief the communicator the vectors are distributed over
+  MPI_Comm comm_;
+
+  /// @brief the residual g(x) - x of the previous iterate
+  mfem::Vector f_previous_;
+
+  /// @brief the image g(x) of the previous iterate
+  mfem::Vector g_previous_;
+
+  /// @brief differences of successive residuals, oldest first
+  std::deque<mfem::Vector> dF_;
+
+  /// @brief differences of successive images, oldest first
+  std::deque<mfem::Vector> dG_;
+};
+
+}  // namespace serac
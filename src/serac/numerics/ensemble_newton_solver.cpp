@@ -0,0 +1,94 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/ensemble_newton_solver.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac {
+
+EnsembleNewtonSolver::EnsembleNewtonSolver(const NonlinearSolverOptions& nonlinear_opts,
+                                           const LinearSolverOptions& linear_opts, MPI_Comm comm)
+    : nonlinear_options_(nonlinear_opts), comm_(comm)
+{
+  if (linear_opts.linear_solver == LinearSolver::CG) {
+    krylov_ = std::make_unique<mfem::CGSolver>(comm);
+  } else if (linear_opts.linear_solver == LinearSolver::GMRES) {
+    krylov_ = std::make_unique<mfem::GMRESSolver>(comm);
+  } else {
+    SLIC_ERROR_ROOT(axom::fmt::format("EnsembleNewtonSolver only supports the CG and GMRES linear solvers, not {}",
+                                      linearName(linear_opts.linear_solver)));
+  }
+
+  krylov_->iterative_mode = false;
+  krylov_->SetRelTol(linear_opts.relative_tol);
+  krylov_->SetAbsTol(linear_opts.absolute_tol);
+  krylov_->SetMaxIter(linear_opts.max_iterations);
+  krylov_->SetPrintLevel(linear_opts.print_level);
+}
+
+void EnsembleNewtonSolver::setEssentialDofs(const mfem::Array<int>& dofs) { essential_dofs_ = dofs; }
+
+void EnsembleNewtonSolver::solve(const EnsembleResidual& residual, std::vector<mfem::Vector>& u)
+{
+  std::size_t num_samples = u.size();
+
+  residuals_.resize(num_samples);
+  jacobians_.assign(num_samples, nullptr);
+  initial_norms_.assign(num_samples, 0.0);
+  iterations_.assign(num_samples, 0);
+  converged_ = false;
+
+  for (int k = 0;; k++) {
+    // one evaluation linearizes every sample, including the ones that have already converged
+    residual(u, residuals_, jacobians_);
+
+    bool all_converged = true;
+    for (std::size_t s = 0; s < num_samples; s++) {
+      residuals_[s].SetSubVector(essential_dofs_, 0.0);
+
+      double norm = std::sqrt(mfem::InnerProduct(comm_, residuals_[s], residuals_[s]));
+      if (k == 0) {
+        initial_norms_[s] = norm;
+      }
+
+      double tolerance = std::max(nonlinear_options_.absolute_tol, nonlinear_options_.relative_tol * initial_norms_[s]);
+      bool   converged = (norm <= tolerance && k >= nonlinear_options_.min_iterations);
+
+      if (nonlinear_options_.print_level > 0) {
+        SLIC_INFO_ROOT(axom::fmt::format("ensemble Newton iteration {}, sample {}: ||r|| = {:.6e}", k, s, norm));
+      }
+
+      if (converged || k == nonlinear_options_.max_iterations) {
+        all_converged = all_converged && converged;
+        continue;
+      }
+
+      all_converged = false;
+
+      // J du = r, where the prescribed dofs are held fixed
+      mfem::ConstrainedOperator J(jacobians_[s], essential_dofs_);
+      krylov_->SetOperator(J);
+      correction_.SetSize(u[s].Size());
+      krylov_->Mult(residuals_[s], correction_);
+
+      u[s] -= correction_;
+      iterations_[s]++;
+    }
+
+    if (all_converged || k == nonlinear_options_.max_iterations) {
+      converged_ = all_converged;
+      break;
+    }
+  }
+
+  SLIC_WARNING_ROOT_IF(!converged_, "EnsembleNewtonSolver: some samples did not converge");
+}
+
+}  // namespace serac
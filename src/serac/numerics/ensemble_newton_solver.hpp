@@ -0,0 +1,124 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file ensemble_newton_solver.hpp
+ *
+ * @brief Newton's method for an ensemble of independent nonlinear systems that share one residual evaluation
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/solver_config.hpp"
+
+namespace serac {
+
+/**
+ * @brief Newton's method for an ensemble of independent nonlinear systems r_s(u_s) = 0, s = 0, 1, ..., S - 1
+ * (e.g. the same model, solved for several parameter samples)
+ *
+ * Each iteration evaluates the residuals and linearizations of every sample with one call, so that they can all
+ * be computed by a single pass over the mesh (see Functional::evaluateEnsemble()). The Newton correction of each
+ * unconverged sample is then computed by a matrix-free Krylov solve with the jacobian of that sample.
+ *
+ * @code{.cpp}
+ * EnsembleNewtonSolver solver(nonlinear_options, linear_options, comm);
+ * solver.setEssentialDofs(essential_dofs);
+ * solver.solve(
+ *     [&](const std::vector<mfem::Vector>& u, std::vector<mfem::Vector>& r, std::vector<mfem::Operator*>& J) {
+ *       auto [values, dr_du] = residual.evaluateEnsemble(t, differentiate_wrt(u), conductivities);
+ *       r                    = values;
+ *       for (uint32_t s = 0; s < dr_du.size(); s++) {
+ *         J[s] = &dr_du[s];
+ *       }
+ *     },
+ *     temperatures);
+ * @endcode
+ *
+ * @note the linear solves are not preconditioned, since the jacobians are only available as operators
+ */
+class EnsembleNewtonSolver {
+public:
+  /**
+   * @brief a function that evaluates the residual of every sample, and linearizes each of them about its own state
+   *
+   * The arguments are the current state of each sample, the residual of each sample (to be computed), and
+   * the jacobian of each sample (to be set), which must remain valid until the next evaluation.
+   */
+  using EnsembleResidual = std::function<void(const std::vector<mfem::Vector>&, std::vector<mfem::Vector>&,
+                                              std::vector<mfem::Operator*>&)>;
+
+  /**
+   * @brief create a batched Newton solver
+   *
+   * @param nonlinear_opts the tolerances and iteration limits of the Newton iterations of each sample
+   * @param linear_opts the Krylov method (LinearSolver::CG or LinearSolver::GMRES), tolerances and iteration limit
+   * of the linear solves
+   * @param comm the communicator the vectors are distributed over
+   */
+  EnsembleNewtonSolver(const NonlinearSolverOptions& nonlinear_opts, const LinearSolverOptions& linear_opts,
+                       MPI_Comm comm);
+
+  /**
+   * @brief set the (true) dofs whose values are prescribed, which keep the values of the initial guess
+   *
+   * @param dofs the list of prescribed true dofs, shared by every sample
+   */
+  void setEssentialDofs(const mfem::Array<int>& dofs);
+
+  /**
+   * @brief solve r_s(u_s) = 0 for every sample
+   *
+   * @param residual evaluates the residuals and jacobians of every sample
+   * @param u the initial guess of each sample, overwritten by the solutions
+   */
+  void solve(const EnsembleResidual& residual, std::vector<mfem::Vector>& u);
+
+  /// @brief the number of Newton iterations taken by each sample in the last solve
+  const std::vector<int>& iterations() const { return iterations_; }
+
+  /// @brief whether every sample converged in the last solve
+  bool converged() const { return converged_; }
+
+private:
+  /// @brief the tolerances and iteration limits of the Newton iterations
+  NonlinearSolverOptions nonlinear_options_;
+
+  /// @brief the Krylov solver used for the Newton corrections of every sample
+  std::unique_ptr<mfem::IterativeSolver> krylov_;
+
+  /// @brief the communicator the vectors are distributed over
+  MPI_Comm comm_;
+
+  /// @brief the prescribed true dofs
+  mfem::Array<int> essential_dofs_;
+
+  /// @brief the residual of each sample at the current iterate
+  std::vector<mfem::Vector> residuals_;
+
+  /// @brief the jacobian of each sample at the current iterate
+  std::vector<mfem::Operator*> jacobians_;
+
+  /// @brief the norm of the initial residual of each sample
+  std::vector<double> initial_norms_;
+
+  /// @brief the number of Newton iterations taken by each sample in the last solve
+  std::vector<int> iterations_;
+
+  /// @brief the Newton correction of a sample
+  mfem::Vector correction_;
+
+  /// @brief whether every sample converged in the last solve
+  bool converged_ = false;
+};
+
+}  // namespace serac
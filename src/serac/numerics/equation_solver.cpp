@@ -6,6 +6,8 @@
 
 #include "serac/numerics/equation_solver.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <sstream>
 #include <ios>
@@ -15,25 +17,123 @@
 #include "serac/infrastructure/terminator.hpp"
 #include "serac/serac_config.hpp"
 #include "serac/infrastructure/profiling.hpp"
+#include "serac/numerics/stdfunction_operator.hpp"
 
 namespace serac {
 
+/**
+ * @brief Eisenstat-Walker forcing terms for inexact Newton methods
+ *
+ * Early Newton iterations, where the linearization is a poor model of the nonlinear residual,
+ * don't benefit from accurate linear solves. These forcing terms loosen the linear solver tolerance
+ * there, and tighten it as the nonlinear iteration converges (S. C. Eisenstat and H. F. Walker,
+ * "Choosing the forcing terms in an inexact Newton method", SIAM J. Sci. Comput. 17, 1996).
+ */
+class ForcingTermSequence {
+public:
+  /**
+   * @brief construct the sequence of forcing terms for one nonlinear solve
+   * @param type which forcing term to use
+   * @param min_eta the smallest relative tolerance to return
+   * @param max_eta the largest relative tolerance to return
+   * @param norm_goal the nonlinear residual norm that will be considered converged
+   */
+  ForcingTermSequence(ForcingTerm type, double min_eta, double max_eta, double norm_goal)
+      : type_(type), min_eta_(min_eta), max_eta_(std::max(min_eta, max_eta)), norm_goal_(norm_goal)
+  {
+  }
+
+  /// @brief whether the relative tolerance changes from one iteration to the next
+  bool adaptive() const { return type_ != ForcingTerm::Fixed; }
+
+  /// @brief whether next() requires the norm of the previous linear model's residual, see setLinearResidualNorm()
+  bool needsLinearResidualNorm() const { return type_ == ForcingTerm::EisenstatWalker1; }
+
+  /// @brief record ||F(x_k) + J(x_k) s_k||, the linear model's residual for the step that was taken
+  void setLinearResidualNorm(double linear_residual_norm) { linear_residual_norm_ = linear_residual_norm; }
+
+  /**
+   * @brief the relative tolerance for the linear solve of the current iteration
+   * @param norm the current nonlinear residual norm ||F(x_{k+1})||
+   */
+  double next(double norm)
+  {
+    constexpr double golden_ratio = 1.618033988749895;
+    constexpr double gamma        = 0.9;
+    constexpr double alpha        = 2.0;
+    constexpr double threshold    = 0.1;
+
+    double eta = std::min(0.5, max_eta_);
+    if (previous_norm_ > 0.0) {
+      double safeguard = 0.0;
+      if (type_ == ForcingTerm::EisenstatWalker1) {
+        eta       = std::abs(norm - linear_residual_norm_) / previous_norm_;
+        safeguard = std::pow(previous_eta_, golden_ratio);
+      } else if (type_ == ForcingTerm::EisenstatWalker2) {
+        eta       = gamma * std::pow(norm / previous_norm_, alpha);
+        safeguard = gamma * std::pow(previous_eta_, alpha);
+      }
+
+      // don't let the tolerance decrease too quickly while the nonlinear convergence is still slow
+      if (safeguard > threshold) {
+        eta = std::max(eta, safeguard);
+      }
+    }
+
+    // there's no point in solving more accurately than needed to reach the nonlinear tolerance
+    if (norm > 0.0) {
+      eta = std::max(eta, 0.5 * norm_goal_ / norm);
+    }
+    eta = std::clamp(eta, min_eta_, max_eta_);
+
+    previous_norm_ = norm;
+    previous_eta_  = eta;
+    return eta;
+  }
+
+private:
+  /// @brief which forcing term to use
+  ForcingTerm type_;
+  /// @brief the smallest relative tolerance to return
+  double min_eta_;
+  /// @brief the largest relative tolerance to return
+  double max_eta_;
+  /// @brief the nonlinear residual norm that will be considered converged
+  double norm_goal_;
+  /// @brief the nonlinear residual norm of the previous iteration
+  double previous_norm_ = 0.0;
+  /// @brief the relative tolerance of the previous iteration
+  double previous_eta_ = 0.0;
+  /// @brief the linear model's residual norm from the previous iteration
+  double linear_residual_norm_ = 0.0;
+};
+
 /// Newton solver with a 2-way line-search.  Reverts to regular Newton if max_line_search_iterations is set to 0.
 class NewtonSolver : public mfem::NewtonSolver {
 protected:
   /// initial solution vector to do line-search off of
   mutable mfem::Vector x0;
+  /// scratch space for the linear model's residual, used by the Eisenstat-Walker choice 1 forcing term
+  mutable mfem::Vector linear_residual;
   /// nonlinear solver options
   NonlinearSolverOptions nonlinear_options;
+  /// linear solver options, whose relative tolerance is restored after an adaptive (Eisenstat-Walker) solve
+  LinearSolverOptions linear_options;
+  /// whether `grad` was already evaluated at the current iterate, along with its residual
+  mutable bool jacobian_is_current = false;
 
 public:
   /// constructor
-  NewtonSolver(const NonlinearSolverOptions& nonlinear_opts) : nonlinear_options(nonlinear_opts) {}
+  NewtonSolver(const NonlinearSolverOptions& nonlinear_opts, const LinearSolverOptions& linear_opts = {})
+      : nonlinear_options(nonlinear_opts), linear_options(linear_opts)
+  {
+  }
 
 #ifdef MFEM_USE_MPI
   /// parallel constructor
-  NewtonSolver(MPI_Comm comm_, const NonlinearSolverOptions& nonlinear_opts)
-      : mfem::NewtonSolver(comm_), nonlinear_options(nonlinear_opts)
+  NewtonSolver(MPI_Comm comm_, const NonlinearSolverOptions& nonlinear_opts,
+               const LinearSolverOptions& linear_opts = {})
+      : mfem::NewtonSolver(comm_), nonlinear_options(nonlinear_opts), linear_options(linear_opts)
   {
   }
 #endif
@@ -42,7 +142,8 @@ public:
   double evaluateNorm(const mfem::Vector& x, mfem::Vector& rOut) const
   {
     SERAC_MARK_FUNCTION;
-    double normEval = std::numeric_limits<double>::max();
+    jacobian_is_current = false;
+    double normEval     = std::numeric_limits<double>::max();
     try {
       oper->Mult(x, rOut);
       normEval = Norm(rOut);
@@ -52,17 +153,52 @@ public:
     return normEval;
   }
 
-  /// assemble the jacobian
-  void assembleJacobian(const mfem::Vector& x) const
+  /**
+   * @brief Evaluate the residual and the jacobian together, put the residual in rOut and return its norm.
+   *
+   * Operators that can only evaluate them separately (see mfem_ext::StdFunctionOperator::MultAndGetGradient)
+   * just evaluate the residual, and leave the jacobian to assembleJacobian().
+   */
+  double evaluateNormAndJacobian(const mfem::Vector& x, mfem::Vector& rOut) const
   {
+    auto* combined = dynamic_cast<const mfem_ext::StdFunctionOperator*>(oper);
+    if (!combined || !combined->hasResidualAndGradient()) {
+      return evaluateNorm(x, rOut);
+    }
+
     SERAC_MARK_FUNCTION;
-    grad = &oper->GetGradient(x);
+    jacobian_is_current = false;
+    double normEval     = std::numeric_limits<double>::max();
+    try {
+      setJacobian(combined->MultAndGetGradient(x, rOut));
+      jacobian_is_current = true;
+      normEval            = Norm(rOut);
+    } catch (const std::exception&) {
+      normEval = std::numeric_limits<double>::max();
+    }
+    return normEval;
+  }
+
+  /// use J as the jacobian of the linear system, converting block operators to a monolithic matrix if requested
+  void setJacobian(mfem::Operator& J) const
+  {
+    grad = &J;
     if (nonlinear_options.force_monolithic) {
       auto* grad_blocked = dynamic_cast<mfem::BlockOperator*>(grad);
       if (grad_blocked) grad = buildMonolithicMatrix(*grad_blocked).release();
     }
   }
 
+  /// assemble the jacobian, unless it was already evaluated along with the residual at this iterate
+  void assembleJacobian(const mfem::Vector& x) const
+  {
+    SERAC_MARK_FUNCTION;
+    if (jacobian_is_current) {
+      return;
+    }
+    setJacobian(oper->GetGradient(x));
+  }
+
   /// set the preconditioner for the linear solver
   void setPreconditioner() const
   {
@@ -86,7 +222,7 @@ public:
     using real_t = mfem::real_t;
 
     real_t norm, norm_goal;
-    norm = initial_norm = evaluateNorm(x, r);
+    norm = initial_norm = evaluateNormAndJacobian(x, r);
 
     if (print_options.first_and_last && !print_options.iterations) {
       mfem::out << "Newton iteration " << std::setw(3) << 0 << " : ||r|| = " << std::setw(13) << norm << "...\n";
@@ -95,6 +231,17 @@ public:
     norm_goal            = std::max(rel_tol * initial_norm, abs_tol);
     prec->iterative_mode = false;
 
+    // the forcing terms can only be applied when the linear solver is iterative
+    auto*               iterative_solver = dynamic_cast<mfem::IterativeSolver*>(prec);
+    ForcingTermSequence forcing(iterative_solver ? nonlinear_options.forcing_term : ForcingTerm::Fixed,
+                                linear_options.relative_tol, nonlinear_options.max_forcing_term, norm_goal);
+    int                 linear_iterations = 0;
+    mfem::StopWatch     timer;
+    timer.Start();
+
+    // the residual norm before the previous step, used to predict whether the next iterate will converge
+    real_t norm_nm2 = 0.0;
+
     int it = 0;
     for (; true; it++) {
       MFEM_ASSERT(mfem::IsFinite(norm), "norm = " << norm);
@@ -124,16 +271,36 @@ public:
 
       assembleJacobian(x);
       setPreconditioner();
+      if (forcing.adaptive()) {
+        iterative_solver->SetRelTol(forcing.next(norm));
+      }
       solveLinearSystem(r, c);
+      if (iterative_solver) {
+        linear_iterations += iterative_solver->GetNumIterations();
+      }
+
+      // ||F(x) + J s|| for the full step s = -c, measured before r is overwritten by the line search
+      if (forcing.needsLinearResidualNorm()) {
+        linear_residual.SetSize(r.Size());
+        grad->Mult(c, linear_residual);
+        linear_residual -= r;
+        forcing.setLinearResidualNorm(Norm(linear_residual));
+      }
 
       // there must be a better way to do this?
       x0.SetSize(x.Size());
       x0 = 0.0;
       x0.Add(1.0, x);
 
+      // the jacobian at the full step is evaluated along with its residual (saving a residual evaluation),
+      // unless the step is expected to converge, based on the observed rate of convergence
+      real_t predicted_norm = (norm_nm2 > 0.0) ? norm_nm1 * std::min(norm_nm1 / norm_nm2, 1.0) : norm_nm1;
+      bool   needs_jacobian = predicted_norm > norm_goal || it + 1 < nonlinear_options.min_iterations;
+      norm_nm2              = norm_nm1;
+
       real_t stepScale = 1.0;
       add(x0, -stepScale, c, x);
-      norm = evaluateNorm(x, r);
+      norm = needs_jacobian ? evaluateNormAndJacobian(x, r) : evaluateNorm(x, r);
 
       const int               max_ls_iters = nonlinear_options.max_line_search_iterations;
       static constexpr real_t reduction    = 0.5;
@@ -191,9 +358,17 @@ public:
 
     final_iter = it;
     final_norm = norm;
+    timer.Stop();
+
+    // restore the linear solver's own tolerance, e.g. for subsequent adjoint solves
+    if (forcing.adaptive()) {
+      iterative_solver->SetRelTol(linear_options.relative_tol);
+    }
 
     if (print_options.summary || (!converged && print_options.warnings) || print_options.first_and_last) {
       mfem::out << "Newton: Number of iterations: " << final_iter << '\n' << "   ||r|| = " << final_norm << '\n';
+      mfem::out << "   total linear iterations = " << linear_iterations << ", wall time = " << timer.RealTime()
+                << " s\n";
     }
     if (!converged && (print_options.summary || print_options.warnings)) {
       mfem::out << "Newton: No convergence!\n";
@@ -507,6 +682,12 @@ public:
     settings.cg_tol                                     = 0.5 * norm_goal;
     double tr_size                                      = nonlinear_options.trust_region_scaling * std::sqrt(X.Size());
     size_t cumulative_cg_iters_from_last_precond_update = 0;
+    size_t linear_iterations                            = 0;
+
+    ForcingTermSequence forcing(nonlinear_options.forcing_term, linear_options.relative_tol,
+                                nonlinear_options.max_forcing_term, norm_goal);
+    mfem::StopWatch     timer;
+    timer.Start();
 
     auto& d  = trResults.d;   // reuse, maybe dangerous!
     auto& Hd = trResults.Hd;  // reuse, maybe dangerous!
@@ -581,10 +762,12 @@ public:
         trResults.cg_iterations_count = 1;
         trResults.interior_status     = TrustRegionResults::Status::OnBoundary;
       } else {
-        settings.cg_tol = std::max(0.5 * norm_goal, 5e-5 * norm);
+        double eta      = forcing.adaptive() ? forcing.next(norm) : 5e-5;
+        settings.cg_tol = std::max(0.5 * norm_goal, eta * norm);
         solveTrustRegionModelProblem(r, scratch, hess_vec_func, precond_func, settings, tr_size, trResults);
       }
       cumulative_cg_iters_from_last_precond_update += trResults.cg_iterations_count;
+      linear_iterations += trResults.cg_iterations_count;
 
       bool happyAboutTrSize = false;
       int  lineSearchIter   = 0;
@@ -597,6 +780,10 @@ public:
 
         hess_vec_func(d, Hd);
         double dHd            = Dot(d, Hd);
+        if (forcing.needsLinearResidualNorm()) {
+          add(r, Hd, scratch);
+          forcing.setLinearResidualNorm(Norm(scratch));
+        }
         double modelObjective = Dot(r, d) + 0.5 * dHd - roundOffTol;
 
         add(X, d, x_pred);
@@ -672,9 +859,12 @@ public:
 
     final_iter = it;
     final_norm = norm;
+    timer.Stop();
 
     if (print_options.summary || (!converged && print_options.warnings) || print_options.first_and_last) {
       mfem::out << "Newton: Number of iterations: " << final_iter << '\n' << "   ||r|| = " << final_norm << '\n';
+      mfem::out << "   total linear iterations = " << linear_iterations << ", wall time = " << timer.RealTime()
+                << " s\n";
     }
     if (!converged && (print_options.summary || print_options.warnings)) {
       mfem::out << "Newton: No convergence!\n";
@@ -815,6 +1005,219 @@ void StrumpackSolver::SetOperator(const mfem::Operator& op)
 
 #endif
 
+#ifdef MFEM_USE_MUMPS
+
+void MUMPSSolver::Mult(const mfem::Vector& input, mfem::Vector& output) const
+{
+  SLIC_ERROR_ROOT_IF(!mumps_solver_, "Operator must be set prior to solving with MUMPS");
+
+  // Use the underlying MFEM-based solver to apply the factorization
+  mumps_solver_->Mult(input, output);
+}
+
+bool MUMPSSolver::samePattern(const mfem::HypreParMatrix& matrix)
+{
+  mfem::SparseMatrix diag;
+  mfem::SparseMatrix offd;
+  HYPRE_BigInt*      offd_columns = nullptr;
+  matrix.GetDiag(diag);
+  matrix.GetOffd(offd, offd_columns);
+
+  std::vector<HYPRE_BigInt> pattern;
+  pattern.reserve(static_cast<size_t>(2 * diag.Height() + diag.NumNonZeroElems() + offd.NumNonZeroElems() + 3));
+  pattern.push_back(matrix.GetGlobalNumRows());
+  pattern.insert(pattern.end(), diag.GetI(), diag.GetI() + diag.Height() + 1);
+  pattern.insert(pattern.end(), diag.GetJ(), diag.GetJ() + diag.NumNonZeroElems());
+  pattern.insert(pattern.end(), offd.GetI(), offd.GetI() + offd.Height() + 1);
+  for (int k = 0; k < offd.NumNonZeroElems(); k++) {
+    pattern.push_back(offd_columns[offd.GetJ()[k]]);
+  }
+
+  int same = (pattern == pattern_);
+  MPI_Allreduce(MPI_IN_PLACE, &same, 1, MPI_INT, MPI_MIN, comm_);
+
+  pattern_ = std::move(pattern);
+  return same;
+}
+
+void MUMPSSolver::SetOperator(const mfem::Operator& op)
+{
+  // Check if this is a block operator
+  auto* block_operator = dynamic_cast<const mfem::BlockOperator*>(&op);
+
+  const mfem::HypreParMatrix* matrix = nullptr;
+
+  // If it is, make a monolithic system from the underlying blocks
+  if (block_operator) {
+    monolithic_mat_ = buildMonolithicMatrix(*block_operator);
+    matrix          = monolithic_mat_.get();
+  } else {
+    // If this is not a block system, check that the input operator is a HypreParMatrix as expected
+    matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+
+    SLIC_ERROR_ROOT_IF(!matrix, "Matrix must be an assembled HypreParMatrix for use with MUMPS");
+  }
+
+  height = matrix->Height();
+  width  = matrix->Width();
+
+  // The symbolic analysis can only be reused for the same sparsity pattern, so start over if it changed. The pattern
+  // comparison is collective and records the pattern for the next call, so it runs on every call
+  bool same_pattern = samePattern(*matrix);
+  if (!mumps_solver_ || !same_pattern) {
+    mumps_solver_ = std::make_unique<mfem::MUMPSSolver>(comm_);
+
+    switch (symmetry_) {
+      case MatrixSymmetry::SymmetricPositiveDefinite:
+        mumps_solver_->SetMatrixSymType(mfem::MUMPSSolver::MatType::SYMMETRIC_POSITIVE_DEFINITE);
+        break;
+      case MatrixSymmetry::SymmetricIndefinite:
+        mumps_solver_->SetMatrixSymType(mfem::MUMPSSolver::MatType::SYMMETRIC_INDEFINITE);
+        break;
+      case MatrixSymmetry::Unsymmetric:
+        mumps_solver_->SetMatrixSymType(mfem::MUMPSSolver::MatType::UNSYMMETRIC);
+        break;
+    }
+
+    mumps_solver_->SetPrintLevel(print_level_);
+    mumps_solver_->SetReorderingReuse(true);
+    num_analyses_++;
+  }
+
+  mumps_solver_->SetOperator(*matrix);
+}
+
+#endif
+
+void GeometricMultigrid::setHierarchy(const std::vector<std::unique_ptr<mfem::ParMesh>>& coarse_meshes,
+                                      const mfem::ParFiniteElementSpace&                 fine_space)
+{
+  coarse_spaces_.clear();
+  prolongations_.clear();
+  coarse_operators_.clear();
+  smoothers_.clear();
+  fine_operator_ = nullptr;
+
+  for (auto& coarse_mesh : coarse_meshes) {
+    coarse_spaces_.push_back(std::make_unique<mfem::ParFiniteElementSpace>(
+        coarse_mesh.get(), fine_space.FEColl(), fine_space.GetVDim(), fine_space.GetOrdering()));
+  }
+
+  // the transfer operators use the refinement transformations recorded in each finer mesh,
+  // which is why every level has to be exactly one uniform refinement of the previous one
+  for (std::size_t i = 0; i < coarse_spaces_.size(); i++) {
+    const mfem::ParFiniteElementSpace& finer = (i + 1 < coarse_spaces_.size()) ? *coarse_spaces_[i + 1] : fine_space;
+
+    mfem::OperatorHandle P(mfem::Operator::Hypre_ParCSR);
+    finer.GetTrueTransferOperator(*coarse_spaces_[i], P);
+    P.SetOperatorOwner(false);
+    prolongations_.emplace_back(P.As<mfem::HypreParMatrix>());
+  }
+
+  // the work vectors of the V-cycle only depend on the sizes of the levels
+  std::size_t num_levels = coarse_spaces_.size() + 1;
+  level_rhs_.resize(num_levels);
+  level_solution_.resize(num_levels);
+  level_residual_.resize(num_levels);
+  level_correction_.resize(num_levels);
+  for (std::size_t level = 0; level < num_levels; level++) {
+    int size = (level < coarse_spaces_.size()) ? coarse_spaces_[level]->GetTrueVSize() : fine_space.GetTrueVSize();
+    level_rhs_[level].SetSize(size);
+    level_solution_[level].SetSize(size);
+    level_residual_[level].SetSize(size);
+    level_correction_[level].SetSize(size);
+  }
+  coarse_operators_.resize(coarse_spaces_.size());
+  smoothers_.resize(coarse_spaces_.size());
+
+  coarse_solver_ = std::make_unique<mfem::HypreBoomerAMG>();
+  coarse_solver_->SetPrintLevel(print_level_);
+  if (fine_space.GetVDim() > 1) {
+    coarse_solver_->SetSystemsOptions(fine_space.GetVDim(), fine_space.GetOrdering() == mfem::Ordering::byNODES);
+  }
+}
+
+void GeometricMultigrid::SetOperator(const mfem::Operator& op)
+{
+  SERAC_MARK_FUNCTION;
+
+  fine_operator_ = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+  SLIC_ERROR_ROOT_IF(!fine_operator_, "GeometricMultigrid requires an assembled HypreParMatrix operator");
+
+  height = op.Height();
+  width  = op.Width();
+
+  // without a hierarchy (see setHierarchy()), the coarse solver is applied to the fine operator
+  if (!coarse_solver_) {
+    coarse_solver_ = std::make_unique<mfem::HypreBoomerAMG>();
+    coarse_solver_->SetPrintLevel(print_level_);
+  }
+
+  // the spaces, prolongations and work vectors are kept from setHierarchy(), only the operators and the
+  // smoothers (whose Chebyshev bounds depend on the operators) are refreshed here
+  //
+  // Galerkin coarse operators, from the finest level down
+  const mfem::HypreParMatrix* finer = fine_operator_;
+  for (std::size_t i = coarse_spaces_.size(); i-- > 0;) {
+    coarse_operators_[i].reset(mfem::RAP(finer, prolongations_[i].get()));
+    finer = coarse_operators_[i].get();
+  }
+
+  coarse_solver_->SetOperator(levelOperator(0));
+
+  for (std::size_t level = 1; level < coarse_spaces_.size() + 1; level++) {
+    mfem::Vector diagonal(levelOperator(level).Height());
+    levelOperator(level).GetDiag(diagonal);
+    smoothers_[level - 1] = std::make_unique<mfem::OperatorChebyshevSmoother>(
+        levelOperator(level), diagonal, no_essential_dofs_, smoother_order_, comm_);
+  }
+}
+
+mfem::HypreParMatrix& GeometricMultigrid::levelOperator(std::size_t level) const
+{
+  return const_cast<mfem::HypreParMatrix&>(level < coarse_operators_.size() ? *coarse_operators_[level]
+                                                                             : *fine_operator_);
+}
+
+void GeometricMultigrid::cycle(std::size_t level, const mfem::Vector& rhs, mfem::Vector& solution) const
+{
+  if (level == 0) {
+    coarse_solver_->Mult(rhs, solution);
+    return;
+  }
+
+  const mfem::HypreParMatrix& A        = levelOperator(level);
+  const mfem::Solver&         smoother = *smoothers_[level - 1];
+  mfem::Vector&               residual = level_residual_[level];
+  mfem::Vector&               delta    = level_correction_[level];
+  const mfem::HypreParMatrix& P        = *prolongations_[level - 1];
+
+  // pre-smoothing, from a zero initial guess
+  smoother.Mult(rhs, solution);
+
+  // coarse grid correction
+  A.Mult(solution, residual);
+  subtract(rhs, residual, residual);
+  P.MultTranspose(residual, level_rhs_[level - 1]);
+  level_solution_[level - 1] = 0.0;
+  cycle(level - 1, level_rhs_[level - 1], level_solution_[level - 1]);
+  P.Mult(level_solution_[level - 1], delta);
+  solution += delta;
+
+  // post-smoothing
+  A.Mult(solution, residual);
+  subtract(rhs, residual, residual);
+  smoother.Mult(residual, delta);
+  solution += delta;
+}
+
+void GeometricMultigrid::Mult(const mfem::Vector& input, mfem::Vector& output) const
+{
+  SLIC_ERROR_ROOT_IF(!fine_operator_, "Operator must be set prior to applying GeometricMultigrid");
+  output = 0.0;
+  cycle(coarse_spaces_.size(), input, output);
+}
+
 std::unique_ptr<mfem::NewtonSolver> buildNonlinearSolver(const NonlinearSolverOptions& nonlinear_opts,
                                                          const LinearSolverOptions& linear_opts, mfem::Solver& prec,
                                                          MPI_Comm comm)
@@ -824,14 +1227,14 @@ std::unique_ptr<mfem::NewtonSolver> buildNonlinearSolver(const NonlinearSolverOp
   if (nonlinear_opts.nonlin_solver == NonlinearSolver::Newton) {
     SLIC_ERROR_ROOT_IF(nonlinear_opts.min_iterations != 0 || nonlinear_opts.max_line_search_iterations != 0,
                        "Newton's method does not support nonzero min_iterations or max_line_search_iterations");
-    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts);
+    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts, linear_opts);
     // nonlinear_solver = std::make_unique<mfem::NewtonSolver>(comm);
   } else if (nonlinear_opts.nonlin_solver == NonlinearSolver::LBFGS) {
     SLIC_ERROR_ROOT_IF(nonlinear_opts.min_iterations != 0 || nonlinear_opts.max_line_search_iterations != 0,
                        "LBFGS does not support nonzero min_iterations or max_line_search_iterations");
     nonlinear_solver = std::make_unique<mfem::LBFGSSolver>(comm);
   } else if (nonlinear_opts.nonlin_solver == NonlinearSolver::NewtonLineSearch) {
-    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts);
+    nonlinear_solver = std::make_unique<NewtonSolver>(comm, nonlinear_opts, linear_opts);
   } else if (nonlinear_opts.nonlin_solver == NonlinearSolver::TrustRegion) {
     nonlinear_solver = std::make_unique<TrustRegion>(comm, nonlinear_opts, linear_opts, prec);
 #ifdef SERAC_USE_PETSC
@@ -907,6 +1310,16 @@ std::pair<std::unique_ptr<mfem::Solver>, std::unique_ptr<mfem::Solver>> buildLin
 
 #endif
 
+  if (linear_opts.linear_solver == LinearSolver::MUMPS) {
+#ifdef MFEM_USE_MUMPS
+    auto lin_solver = std::make_unique<MUMPSSolver>(linear_opts.matrix_symmetry, linear_opts.print_level, comm);
+    return {std::move(lin_solver), std::move(preconditioner)};
+#else
+    SLIC_ERROR_ROOT("MUMPS linear solver requested for a build of MFEM without MUMPS.");
+    exitGracefully(true);
+#endif
+  }
+
   std::unique_ptr<mfem::IterativeSolver> iter_lin_solver;
 
   switch (linear_opts.linear_solver) {
@@ -1030,6 +1443,9 @@ std::unique_ptr<mfem::Solver> buildPreconditioner(LinearSolverOptions linear_opt
     ilu_preconditioner->SetLevelOfFill(1);
     ilu_preconditioner->SetPrintLevel(print_level);
     preconditioner_solver = std::move(ilu_preconditioner);
+  } else if (preconditioner == Preconditioner::GeometricMultigrid) {
+    preconditioner_solver =
+        std::make_unique<GeometricMultigrid>(linear_opts.multigrid_smoother_order, print_level, comm);
   } else if (preconditioner == Preconditioner::AMGX) {
 #ifdef MFEM_USE_AMGX
     preconditioner_solver = buildAMGX(linear_opts.amgx_options, comm);
@@ -1072,7 +1488,8 @@ void EquationSolver::defineInputFileSchema(axom::inlet::Container& container)
   iterative_container.addInt("max_iter", "Maximum iterations for the linear solve.").defaultValue(5000);
   iterative_container.addInt("print_level", "Linear print level.").defaultValue(0);
   iterative_container.addString("solver_type", "Solver type (gmres|minres|cg).").defaultValue("gmres");
-  iterative_container.addString("prec_type", "Preconditioner type (JacobiSmoother|L1JacobiSmoother|AMG|ILU|Petsc).")
+  iterative_container
+      .addString("prec_type", "Preconditioner type (JacobiSmoother|L1JacobiSmoother|AMG|ILU|GeometricMultigrid|Petsc).")
       .defaultValue("JacobiSmoother");
   iterative_container.addString("petsc_prec_type", "Type of PETSc preconditioner to use.").defaultValue("jacobi");
 
@@ -1128,6 +1545,8 @@ serac::LinearSolverOptions FromInlet<serac::LinearSolverOptions>::operator()(con
     options.preconditioner = serac::Preconditioner::HypreAMG;
   } else if (prec_type == "ILU") {
     options.preconditioner = serac::Preconditioner::HypreILU;
+  } else if (prec_type == "GeometricMultigrid") {
+    options.preconditioner = serac::Preconditioner::GeometricMultigrid;
 #ifdef MFEM_USE_AMGX
   } else if (prec_type == "AMGX") {
     options.preconditioner = serac::Preconditioner::AMGX;
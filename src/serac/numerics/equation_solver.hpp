@@ -15,6 +15,7 @@
 #include <memory>
 #include <optional>
 #include <variant>
+#include <vector>
 
 #include "mfem.hpp"
 
@@ -250,6 +251,200 @@ private:
 
 #endif
 
+#ifdef MFEM_USE_MUMPS
+/**
+ * @brief A wrapper class for using the MFEM MUMPS solver with a HypreParMatrix
+ *
+ * For symmetric systems, MUMPS factors only one triangle of the matrix (Cholesky or LDL^T), which takes about half
+ * the memory and flops of an LU factorization. The symbolic analysis (fill-reducing ordering and elimination tree)
+ * is reused for as long as the sparsity pattern of the operator does not change, e.g. over the Newton iterations
+ * of a nonlinear solve.
+ */
+class MUMPSSolver : public mfem::Solver {
+public:
+  /**
+   * @brief Constructs a wrapper over an mfem::MUMPSSolver
+   * @param[in] symmetry The symmetry of the matrices to factorize, which selects the factorization
+   * @param[in] print_level The verbosity level for the mfem::MUMPSSolver
+   * @param[in] comm The MPI communicator used by the vectors and matrices in the solve
+   */
+  MUMPSSolver(MatrixSymmetry symmetry, int print_level, MPI_Comm comm)
+      : symmetry_(symmetry), print_level_(print_level), comm_(comm)
+  {
+  }
+
+  /**
+   * @brief Solve the linear system y = Op^{-1} x using the MUMPS factorization
+   *
+   * @param input The input RHS vector
+   * @param output The output solution vector
+   */
+  void Mult(const mfem::Vector& input, mfem::Vector& output) const;
+
+  /**
+   * @brief Set the underlying matrix operator and compute its numeric factorization
+   *
+   * @param op The matrix operator to factorize with MUMPS
+   * @pre This operator must be an assembled HypreParMatrix or a BlockOperator
+   * with all blocks either null or HypreParMatrixs for compatibility with
+   * MUMPS
+   * @pre For MatrixSymmetry::SymmetricPositiveDefinite and MatrixSymmetry::SymmetricIndefinite, the operator
+   * must be symmetric
+   */
+  void SetOperator(const mfem::Operator& op);
+
+  /// @brief The number of symbolic analyses computed so far, the other factorizations reused the last one
+  int numAnalyses() const { return num_analyses_; }
+
+private:
+  /**
+   * @brief Whether @a matrix has the same sparsity pattern as the last factorized operator, on every rank
+   *
+   * @param matrix The matrix to compare, whose pattern is stored for the next comparison
+   */
+  bool samePattern(const mfem::HypreParMatrix& matrix);
+
+  /// @brief The symmetry of the matrices to factorize
+  MatrixSymmetry symmetry_;
+
+  /// @brief The verbosity level for the mfem::MUMPSSolver
+  int print_level_;
+
+  /// @brief The MPI communicator used by the vectors and matrices in the solve
+  MPI_Comm comm_;
+
+  /// @brief The number of symbolic analyses computed so far
+  int num_analyses_ = 0;
+
+  /**
+   * @brief The owner of the monolithic matrix for block operators, stored
+   * as a member variable for lifetime purposes
+   */
+  std::unique_ptr<mfem::HypreParMatrix> monolithic_mat_;
+
+  /// @brief The row offsets and column indices of the local diagonal and off-diagonal blocks of the last operator
+  std::vector<HYPRE_BigInt> pattern_;
+
+  /**
+   * @brief The underlying MFEM-based MUMPS solver, which is recreated (with a new symbolic analysis)
+   * whenever the sparsity pattern of the operator changes
+   */
+  std::unique_ptr<mfem::MUMPSSolver> mumps_solver_;
+};
+
+#endif
+
+/**
+ * @brief A geometric (h-)multigrid V-cycle preconditioner built over a uniform refinement hierarchy
+ *
+ * The operator on each coarse level is the Galerkin product P^T A P of the next finer level's operator,
+ * where P is the geometric prolongation between the finite element spaces on consecutive mesh levels.
+ * Each level (except the coarsest) is smoothed with Chebyshev iteration, and the coarsest level is
+ * approximately solved with BoomerAMG.
+ *
+ * @note Until setHierarchy() is called, this preconditioner reduces to a single BoomerAMG V-cycle
+ */
+class GeometricMultigrid : public mfem::Solver {
+public:
+  /**
+   * @brief Construct a multigrid preconditioner without a hierarchy (must be set later with setHierarchy())
+   * @param[in] smoother_order The polynomial degree of the Chebyshev smoother
+   * @param[in] print_level The verbosity level of the coarse solver
+   * @param[in] comm The MPI communicator used by the vectors and matrices in the solve
+   */
+  GeometricMultigrid(int smoother_order, int print_level, MPI_Comm comm)
+      : smoother_order_(smoother_order), print_level_(print_level), comm_(comm)
+  {
+  }
+
+  /**
+   * @brief Set the finite element spaces of each level
+   *
+   * @param coarse_meshes The coarse mesh levels, ordered from coarsest to finest, where the
+   * mesh of @a fine_space is one uniform refinement of the last one (see mesh::refineAndDistributeHierarchy)
+   * @param fine_space The finite element space of the operator passed to SetOperator()
+   */
+  void setHierarchy(const std::vector<std::unique_ptr<mfem::ParMesh>>& coarse_meshes,
+                    const mfem::ParFiniteElementSpace&                 fine_space);
+
+  /// @brief The number of levels in the hierarchy, including the finest one
+  int numLevels() const { return int(prolongations_.size()) + 1; }
+
+  /**
+   * @brief Apply one multigrid V-cycle, y ~ Op^{-1} x
+   *
+   * @param input The input RHS vector
+   * @param output The output approximate solution vector
+   */
+  void Mult(const mfem::Vector& input, mfem::Vector& output) const;
+
+  /**
+   * @brief Set the fine level operator, and refresh the coarse level operators, smoothers and coarse solver
+   *
+   * The finite element spaces, prolongations and work vectors of every level are built once by setHierarchy(),
+   * so repeated calls (e.g. one per Newton iteration) only recompute what depends on the operator.
+   *
+   * @param op The fine level operator
+   * @pre This operator must be an assembled HypreParMatrix, so that the coarse operators can be formed
+   */
+  void SetOperator(const mfem::Operator& op);
+
+private:
+  /// @brief The operator on a given level, where level 0 is the coarsest
+  mfem::HypreParMatrix& levelOperator(std::size_t level) const;
+
+  /**
+   * @brief Apply a V-cycle on a given level and the ones below it
+   *
+   * @param level The level of @a rhs and @a solution, where level 0 is the coarsest
+   * @param rhs The right hand side on that level
+   * @param solution The approximate solution on that level
+   */
+  void cycle(std::size_t level, const mfem::Vector& rhs, mfem::Vector& solution) const;
+
+  /// @brief The polynomial degree of the Chebyshev smoother
+  int smoother_order_;
+
+  /// @brief The verbosity level of the coarse solver
+  int print_level_;
+
+  /// @brief The MPI communicator used by the vectors and matrices in the solve
+  MPI_Comm comm_;
+
+  /// @brief The finite element spaces on each coarse level, ordered from coarsest to finest
+  std::vector<std::unique_ptr<mfem::ParFiniteElementSpace>> coarse_spaces_;
+
+  /// @brief The true dof prolongation from level i to level i + 1
+  std::vector<std::unique_ptr<mfem::HypreParMatrix>> prolongations_;
+
+  /// @brief The Galerkin operators on each coarse level, ordered from coarsest to finest
+  std::vector<std::unique_ptr<mfem::HypreParMatrix>> coarse_operators_;
+
+  /// @brief The fine level operator of the last call to SetOperator()
+  const mfem::HypreParMatrix* fine_operator_ = nullptr;
+
+  /// @brief The solver on the coarsest level (or on the fine level, without a hierarchy)
+  std::unique_ptr<mfem::HypreBoomerAMG> coarse_solver_;
+
+  /// @brief The smoother on every level above the coarsest, ordered from coarsest to finest
+  std::vector<std::unique_ptr<mfem::Solver>> smoothers_;
+
+  /// @brief The smoothers' (empty) essential dof list, essential conditions are already applied to the operators
+  mfem::Array<int> no_essential_dofs_;
+
+  /// @brief The right hand side of the coarse grid correction on each level (work space for the V-cycle)
+  mutable std::vector<mfem::Vector> level_rhs_;
+
+  /// @brief The solution of the coarse grid correction on each level (work space for the V-cycle)
+  mutable std::vector<mfem::Vector> level_solution_;
+
+  /// @brief The residual on each level (work space for the V-cycle)
+  mutable std::vector<mfem::Vector> level_residual_;
+
+  /// @brief The correction to the solution on each level (work space for the V-cycle)
+  mutable std::vector<mfem::Vector> level_correction_;
+};
+
 /**
  * @brief Function for building a monolithic parallel Hypre matrix from a block system of smaller Hypre matrices
  *
@@ -109,6 +109,21 @@ auto get_derivative_type(lambda qf)
                zero{}};
 };
 
+/**
+ * @brief allocate storage for the derivatives of a q-function w.r.t. each of its arguments, at each quadrature point
+ *
+ * @param qf the q-function
+ * @param num_qpts the total number of quadrature points in the domain
+ * @return a tuple of arrays, one for each argument of the q-function
+ */
+template <int dim, typename... trials, typename lambda, int... i>
+auto allocate_qf_derivatives(lambda qf, uint32_t num_qpts, std::integer_sequence<int, i...>)
+{
+  return serac::make_tuple(
+      accelerator::make_shared_array<ExecutionSpace::CPU, decltype(get_derivative_type<i, dim, trials...>(qf))>(
+          num_qpts)...);
+}
+
 template <typename lambda, int n, typename... T>
 SERAC_HOST_DEVICE auto batch_apply_qf(lambda qf, double t, const tensor<double, 2, n>& positions,
                                       const tensor<double, 1, 2, n>& jacobians, const T&... inputs)
@@ -204,6 +219,158 @@ void evaluation_kernel_impl(trial_element_type trial_elements, test_element, dou
   }
 }
 
+/**
+ * @brief evaluate the integral for an ensemble of inputs, in a single pass over the elements
+ *
+ * see domain_integral::ensemble_evaluation_kernel_impl for a description of the E-vector layout,
+ * and of the layout of the q-function derivatives of each sample
+ */
+template <uint32_t differentiation_index, int Q, mfem::Geometry::Type geom, typename test_element,
+          typename trial_element_type, typename lambda_type, typename derivative_type, int... indices>
+void ensemble_evaluation_kernel_impl(trial_element_type trial_elements, test_element, double t,
+                                     const std::vector<const double*>& inputs,
+                                     const std::vector<uint32_t>& input_samples, double* outputs, uint32_t num_samples,
+                                     const double* positions, const double* jacobians, lambda_type qf,
+                                     [[maybe_unused]] derivative_type* qf_derivatives, const int* elements,
+                                     uint32_t num_elements, camp::int_seq<int, indices...>)
+{
+  constexpr int dim = dimension_of(geom) + 1;
+  constexpr int nqp = num_quadrature_points(geom, Q);
+  auto          J   = reinterpret_cast<const tensor<double, dim - 1, dim, nqp>*>(jacobians);
+  auto          x   = reinterpret_cast<const tensor<double, dim, nqp>*>(positions);
+  auto          r   = reinterpret_cast<typename test_element::dof_type*>(outputs);
+  static constexpr TensorProductQuadratureRule<Q> rule{};
+
+  [[maybe_unused]] tuple u = {
+      reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
+
+  // for each element in the domain
+  for (uint32_t e = 0; e < num_elements; e++) {
+    // load the jacobians and positions for each quadrature point in this element
+    auto J_e = J[e];
+    auto x_e = x[e];
+
+    for (uint32_t s = 0; s < num_samples; s++) {
+      // where this sample's values are stored in an E-vector holding n samples
+      [[maybe_unused]] auto row = [&](uint32_t n) { return uint32_t(elements[e]) * n + ((n > 1) ? s : 0); };
+
+      [[maybe_unused]] tuple qf_inputs = {promote_each_to_dual_when<indices == differentiation_index>(
+          get<indices>(trial_elements).interpolate(get<indices>(u)[row(input_samples[indices])], rule))...};
+
+      auto qf_outputs = batch_apply_qf(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
+
+      if constexpr (differentiation_index != serac::NO_DIFFERENTIATION) {
+        std::size_t first = (std::size_t(s) * num_elements + e) * std::size_t(nqp);
+        for (int q = 0; q < leading_dimension(qf_outputs); q++) {
+          qf_derivatives[first + std::size_t(q)] = get_gradient(qf_outputs[q]);
+        }
+      }
+
+      test_element::integrate(get_value(qf_outputs), rule, &r[row(num_samples)]);
+    }
+  }
+}
+
+/**
+ * @brief a variant of `evaluation_kernel_impl` that seeds every argument of the q-function at once
+ * (see `make_dual_block`), and stores the derivatives w.r.t. each argument in its own buffer.
+ */
+template <int Q, mfem::Geometry::Type geom, typename test_element, typename trial_element_type, typename lambda_type,
+          typename derivative_ptrs_type, int... indices>
+void joint_evaluation_kernel_impl(trial_element_type trial_elements, test_element, double t,
+                                  const std::vector<const double*>& inputs, double* outputs, const double* positions,
+                                  const double* jacobians, lambda_type qf, derivative_ptrs_type qf_derivatives,
+                                  const int* elements, uint32_t num_elements, camp::int_seq<int, indices...>)
+{
+  constexpr int num_args = sizeof...(indices);
+  static_assert(num_args <= 4, "block dual numbers are limited to 4 arguments (serac::tuple has at most 8 entries)");
+
+  constexpr int dim = dimension_of(geom) + 1;
+  constexpr int nqp = num_quadrature_points(geom, Q);
+  auto          J   = reinterpret_cast<const tensor<double, dim - 1, dim, nqp>*>(jacobians);
+  auto          x   = reinterpret_cast<const tensor<double, dim, nqp>*>(positions);
+  auto          r   = reinterpret_cast<typename test_element::dof_type*>(outputs);
+  static constexpr TensorProductQuadratureRule<Q> rule{};
+
+  static constexpr int qpts_per_elem = num_quadrature_points(geom, Q);
+
+  tuple u = {reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
+
+  // for each element in the domain
+  for (uint32_t e = 0; e < num_elements; e++) {
+    // load the jacobians and positions for each quadrature point in this element
+    auto J_e = J[e];
+    auto x_e = x[e];
+
+    // batch-calculate values / derivatives of each trial space, at each quadrature point,
+    // where every argument is seeded in its own block of the dual number's gradient
+    tuple qf_inputs = {promote_each_to_dual_block<indices, num_args>(
+        get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule))...};
+
+    // (batch) evalute the q-function at each quadrature point
+    auto qf_outputs = batch_apply_qf(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
+
+    // split the block derivatives up, and write them out to the buffer associated with each argument
+    for (int q = 0; q < leading_dimension(qf_outputs); q++) {
+      uint32_t id = e * qpts_per_elem + uint32_t(q);
+      (assign_derivative(get<indices>(qf_derivatives)[id], get_gradient(restrict_dual<indices>(qf_outputs[q]))), ...);
+    }
+
+    // (batch) integrate the material response against the test-space basis functions
+    test_element::integrate(get_value(qf_outputs), rule, &r[elements[e]]);
+  }
+}
+
+/**
+ * @brief a variant of `evaluation_kernel_impl` that differentiates along a linear combination of the arguments
+ * that share the trial space of argument `representative`, see domain_integral::combined_evaluation_kernel_impl
+ */
+template <uint32_t representative, int Q, mfem::Geometry::Type geom, typename test_element,
+          typename trial_element_type, typename lambda_type, typename derivative_type, int... indices>
+void combined_evaluation_kernel_impl(trial_element_type trial_elements, test_element, double t,
+                                     const std::vector<const double*>& inputs, double* outputs,
+                                     const double* positions, const double* jacobians, lambda_type qf,
+                                     derivative_type* qf_derivatives, const double* coefficients,
+                                     const int* elements, uint32_t num_elements, camp::int_seq<int, indices...>)
+{
+  using representative_element = std::decay_t<decltype(type<representative>(trial_elements))>;
+
+  constexpr int dim = dimension_of(geom) + 1;
+  constexpr int nqp = num_quadrature_points(geom, Q);
+  auto          J   = reinterpret_cast<const tensor<double, dim - 1, dim, nqp>*>(jacobians);
+  auto          x   = reinterpret_cast<const tensor<double, dim, nqp>*>(positions);
+  auto          r   = reinterpret_cast<typename test_element::dof_type*>(outputs);
+  static constexpr TensorProductQuadratureRule<Q> rule{};
+
+  static constexpr int qpts_per_elem = num_quadrature_points(geom, Q);
+
+  tuple u = {reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
+
+  // for each element in the domain
+  for (uint32_t e = 0; e < num_elements; e++) {
+    // load the jacobians and positions for each quadrature point in this element
+    auto J_e = J[e];
+    auto x_e = x[e];
+
+    // batch-calculate values / derivatives of each trial space, at each quadrature point,
+    // where the arguments in the linear combination share one (scaled) seed
+    tuple qf_inputs = {
+        promote_each_to_scaled_dual_when<std::is_same_v<std::decay_t<decltype(type<indices>(trial_elements))>,
+                                                        representative_element>>(
+            get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule), coefficients[indices])...};
+
+    // (batch) evalute the q-function at each quadrature point
+    auto qf_outputs = batch_apply_qf(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
+
+    for (int q = 0; q < leading_dimension(qf_outputs); q++) {
+      qf_derivatives[e * qpts_per_elem + uint32_t(q)] = get_gradient(qf_outputs[q]);
+    }
+
+    // (batch) integrate the material response against the test-space basis functions
+    test_element::integrate(get_value(qf_outputs), rule, &r[elements[e]]);
+  }
+}
+
 //clang-format off
 template <typename S, typename T>
 SERAC_HOST_DEVICE auto chain_rule(const S& dfdx, const T& dx)
@@ -337,6 +504,81 @@ auto evaluation_kernel(signature s, lambda_type qf, const double* positions, con
   };
 }
 
+/**
+ * @brief create a kernel that evaluates the integral and computes the q-function derivatives
+ * w.r.t. every argument in a single pass
+ *
+ * @param qf_derivatives a tuple of buffers (one per argument) where the q-function derivatives are stored
+ */
+template <int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type, typename... derivative_type>
+auto joint_evaluation_kernel(signature s, lambda_type qf, const double* positions, const double* jacobians,
+                             serac::tuple<std::shared_ptr<derivative_type>...> qf_derivatives, const int* elements,
+                             uint32_t num_elements)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool /* update state */) {
+    auto derivative_ptrs = serac::apply([](auto&... ptrs) { return serac::make_tuple(ptrs.get()...); }, qf_derivatives);
+    joint_evaluation_kernel_impl<Q, geom>(trial_elements, test_element, time, inputs, outputs, positions, jacobians,
+                                          qf, derivative_ptrs, elements, num_elements, s.index_seq);
+  };
+}
+
+/**
+ * @brief create a kernel that evaluates the integral and differentiates it along a linear combination
+ * of the arguments that share the trial space of argument `representative`, see `combined_evaluation_kernel_impl`
+ *
+ * @param qf_derivatives the buffer of argument `representative`, where the combined derivatives are stored
+ * @param coefficients the coefficient of each argument in the linear combination, read at each evaluation
+ */
+template <uint32_t representative, int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type,
+          typename derivative_type>
+auto combined_evaluation_kernel(signature s, lambda_type qf, const double* positions, const double* jacobians,
+                                std::shared_ptr<derivative_type>     qf_derivatives,
+                                std::shared_ptr<std::vector<double>> coefficients, const int* elements,
+                                uint32_t num_elements)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool /* update state */) {
+    combined_evaluation_kernel_impl<representative, Q, geom>(trial_elements, test_element, time, inputs, outputs,
+                                                             positions, jacobians, qf, qf_derivatives.get(),
+                                                             coefficients->data(), elements, num_elements,
+                                                             s.index_seq);
+  };
+}
+
+/**
+ * @brief create a kernel that evaluates the integral for an ensemble of inputs,
+ * see `ensemble_evaluation_kernel_impl`
+ *
+ * @param qf_derivatives the buffer where the q-function derivatives of every sample w.r.t. argument `wrt` are
+ * stored, it grows to fit the number of samples of each evaluation (unused when `wrt == NO_DIFFERENTIATION`)
+ */
+template <uint32_t wrt, int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type,
+          typename derivative_type>
+auto ensemble_evaluation_kernel(signature s, lambda_type qf, const double* positions, const double* jacobians,
+                                std::shared_ptr<std::vector<derivative_type>> qf_derivatives, const int* elements,
+                                uint32_t num_elements)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, const std::vector<uint32_t>& input_samples,
+             double* outputs, uint32_t num_samples) {
+    derivative_type* derivatives = nullptr;
+    if constexpr (wrt != NO_DIFFERENTIATION) {
+      std::size_t qpts_per_sample = std::size_t(num_elements) * std::size_t(num_quadrature_points(geom, Q));
+      if (qf_derivatives->size() < num_samples * qpts_per_sample) {
+        qf_derivatives->resize(num_samples * qpts_per_sample);
+      }
+      derivatives = qf_derivatives->data();
+    }
+    ensemble_evaluation_kernel_impl<wrt, Q, geom>(trial_elements, test_element, time, inputs, input_samples, outputs,
+                                                  num_samples, positions, jacobians, qf, derivatives, elements,
+                                                  num_elements, s.index_seq);
+  };
+}
+
 template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
 std::function<void(const double*, double*)> jacobian_vector_product_kernel(
     signature, std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements)
@@ -348,6 +590,24 @@ std::function<void(const double*, double*)> jacobian_vector_product_kernel(
   };
 }
 
+/**
+ * @brief create a kernel that applies the q-function derivatives of one sample of the last ensemble evaluation
+ * (w.r.t. argument `wrt`) to a (non-interleaved) E-vector, see `ensemble_evaluation_kernel`
+ */
+template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
+std::function<void(const double*, double*, uint32_t)> ensemble_jacobian_vector_product_kernel(
+    signature, std::shared_ptr<std::vector<derivative_type>> qf_derivatives, const int* elements,
+    uint32_t num_elements)
+{
+  return [=](const double* du, double* dr, uint32_t sample) {
+    using test_space  = typename signature::return_type;
+    using trial_space = typename std::tuple_element<wrt, typename signature::parameter_types>::type;
+    std::size_t qpts_per_sample = std::size_t(num_elements) * std::size_t(num_quadrature_points(geom, Q));
+    action_of_gradient_kernel<Q, geom, test_space, trial_space>(
+        du, dr, qf_derivatives->data() + sample * qpts_per_sample, elements, num_elements);
+  };
+}
+
 template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
 std::function<void(ExecArrayView<double, 3, ExecutionSpace::CPU>)> element_gradient_kernel(
     signature, std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements)
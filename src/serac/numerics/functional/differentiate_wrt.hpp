@@ -5,13 +5,19 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 #pragma once
 
+#include <vector>
+
 #include "mfem.hpp"
 
 namespace serac {
 
 static constexpr uint32_t NO_DIFFERENTIATION = uint32_t(1) << 31;
 
-template <uint32_t i>
+/**
+ * @brief a tag type indicating which argument(s) of `serac::Functional::operator()` should be differentiated
+ * (`NO_DIFFERENTIATION` for none). Several indices request derivatives w.r.t. several arguments in one evaluation.
+ */
+template <uint32_t... i>
 struct DifferentiateWRT {
 };
 
@@ -29,7 +35,7 @@ struct differentiate_wrt_this {
 /**
  * @brief this function is intended to only be used in combination with
  *   `serac::Functional::operator()`, as a way for the user to express that
- *   it should both evaluate and differentiate w.r.t. a specific argument (only 1 argument at a time)
+ *   it should both evaluate and differentiate w.r.t. a specific argument (or several arguments)
  *
  * For example:
  * @code{.cpp}
@@ -37,8 +43,71 @@ struct differentiate_wrt_this {
  *     mfem::Vector arg1 = ...;
  *     mfem::Vector just_the_value = my_functional(arg0, arg1);
  *     auto [value, gradient_wrt_arg1] = my_functional(arg0, differentiate_wrt(arg1));
+ *     auto [value, gradient_wrt_arg0, gradient_wrt_arg1] = my_functional(differentiate_wrt(arg0), differentiate_wrt(arg1));
  * @endcode
  */
 inline auto differentiate_wrt(const mfem::Vector& v) { return differentiate_wrt_this{v}; }
 
+/**
+ * @brief this type exists solely as a way to signal to `serac::Functional::evaluateEnsemble()` that it should
+ * differentiate each sample w.r.t. an argument that has one value per sample
+ */
+struct differentiate_wrt_ensemble_this {
+  const std::vector<mfem::Vector>& ref;  ///< the actual data wrapped by this type
+
+  /// @brief implicitly convert back to `std::vector<mfem::Vector>` to extract the actual data
+  operator const std::vector<mfem::Vector>&() const { return ref; }
+};
+
+/**
+ * @overload
+ *
+ * For example:
+ * @code{.cpp}
+ *     std::vector<mfem::Vector> temperatures = ...;
+ *     auto [residuals, dresidual_dtemperature] = my_functional.evaluateEnsemble(t, differentiate_wrt(temperatures));
+ * @endcode
+ */
+inline auto differentiate_wrt(const std::vector<mfem::Vector>& v) { return differentiate_wrt_ensemble_this{v}; }
+
+/**
+ * @brief this type exists solely as a way to signal to `serac::Functional` that the function
+ * `serac::Functional::operator()` should differentiate along a linear combination of some of its arguments,
+ * e.g. the dynamic Jacobian M + c K of a residual r(u, a) is the derivative along (c du, da)
+ */
+struct differentiate_along_this {
+  const mfem::Vector& ref;          ///< the actual data wrapped by this type
+  double              coefficient;  ///< the coefficient of this argument's derivative in the linear combination
+
+  /// @brief implicitly convert back to `mfem::Vector` to extract the actual data
+  operator const mfem::Vector&() const { return ref; }
+};
+
+/**
+ * @brief this function is intended to only be used in combination with
+ *   `serac::Functional::operator()`, as a way for the user to express that it should evaluate, and
+ *   compute the linear combination of the derivatives w.r.t. the tagged arguments in a single pass
+ *
+ * For example:
+ * @code{.cpp}
+ *     // J = c * d(residual)/d(arg0) + d(residual)/d(arg1), assembled from one set of element matrices
+ *     auto [value, J] = my_functional(differentiate_along(arg0, c), differentiate_along(arg1, 1.0));
+ * @endcode
+ *
+ * @note the tagged arguments must share the same trial space
+ */
+inline auto differentiate_along(const mfem::Vector& v, double coefficient)
+{
+  return differentiate_along_this{v, coefficient};
+}
+
+/**
+ * @brief the arguments (and their coefficients) of a linear combination of derivatives,
+ * see `serac::differentiate_along`
+ */
+struct DerivativeCombination {
+  std::vector<uint32_t> indices;       ///< which arguments appear in the linear combination
+  std::vector<double>   coefficients;  ///< the coefficient of each of those arguments
+};
+
 }  // namespace serac
@@ -293,8 +293,9 @@ struct GradientAssemblyLookupTables {
     // we start by having each element and boundary element emit the (i,j) entry that it
     // touches in the global "stiffness matrix", and also keep track of some metadata about
     // which element and which dof are associated with that particular nonzero entry
-    for (const auto& [geometry, trial_dofs] : block_trial_dofs.restrictions) {
-      const auto& test_dofs = block_test_dofs.restrictions.at(geometry);
+    for (const auto& [geometry, trial_dofs_ptr] : block_trial_dofs.restrictions) {
+      const auto& trial_dofs = *trial_dofs_ptr;
+      const auto& test_dofs = *block_test_dofs.restrictions.at(geometry);
 
       std::vector<DoF> test_vdofs(test_dofs.nodes_per_elem * test_dofs.components);
       std::vector<DoF> trial_vdofs(trial_dofs.nodes_per_elem * trial_dofs.components);
@@ -379,4 +380,188 @@ struct GradientAssemblyLookupTables {
   bool initialized;
 };
 
+/**
+ * @brief a variant of GradientAssemblyLookupTables for test and trial spaces with the same number of
+ *   (> 1) components per node, e.g. the displacement field in solid mechanics. Every node-node coupling
+ *   in these matrices is a dense (components x components) block, so the sparsity pattern (and lookup table)
+ *   is built for the nodes alone, and the nonzero values are stored in block-CSR format:
+ *
+ *   the (a, b) entry of the `k`th block is stored in `values[k * block_size * block_size + a * block_size + b]`
+ *
+ *   initScalarExpansion() additionally records how to expand the block-CSR values into an equivalent scalar CSR
+ *   matrix (with the same vdof numbering as the finite element spaces), for use with mfem::SparseMatrix.
+ */
+struct BlockGradientAssemblyLookupTables {
+  /// @brief a type for representing a nonzero block in a block-sparse matrix
+  using Entry = GradientAssemblyLookupTables::Entry;
+
+  /// dummy default ctor to enable deferred initialization
+  BlockGradientAssemblyLookupTables() : initialized{false}, scalar_initialized{false} {};
+
+  /**
+   * @param block_test_dofs object containing information about dofs for the test space
+   * @param block_trial_dofs object containing information about dofs for the trial space
+   *
+   * @brief create lookup tables describing which blocks of the global sparse matrix
+   * correspond to each pair of nodes in a domain/boundary element
+   */
+  void init(const serac::BlockElementRestriction& block_test_dofs,
+            const serac::BlockElementRestriction& block_trial_dofs)
+  {
+    num_test_nodes  = 0;
+    num_trial_nodes = 0;
+    ordering        = mfem::Ordering::byVDIM;
+
+    for (const auto& [geometry, trial_dofs_ptr] : block_trial_dofs.restrictions) {
+      const auto& trial_dofs = *trial_dofs_ptr;
+      const auto& test_dofs  = *block_test_dofs.restrictions.at(geometry);
+
+      SLIC_ERROR_IF(test_dofs.components != trial_dofs.components || test_dofs.ordering != trial_dofs.ordering,
+                    "block-CSR assembly requires test and trial spaces with the same number of components");
+
+      block_size      = uint32_t(test_dofs.components);
+      num_test_nodes  = test_dofs.num_nodes;
+      num_trial_nodes = trial_dofs.num_nodes;
+      ordering        = test_dofs.ordering;
+
+      auto num_elements = static_cast<uint32_t>(trial_dofs.num_elements);
+      for (uint32_t e = 0; e < num_elements; e++) {
+        for (uint64_t i = 0; i < uint64_t(test_dofs.dof_info.shape()[1]); i++) {
+          auto test_node = uint32_t(test_dofs.dof_info(e, i).index());
+          for (uint64_t j = 0; j < uint64_t(trial_dofs.dof_info.shape()[1]); j++) {
+            auto trial_node                 = uint32_t(trial_dofs.dof_info(e, j).index());
+            nz_LUT[{test_node, trial_node}] = 0;  // just store the keys initially
+          }
+        }
+      }
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve(nz_LUT.size());
+    for (auto [key, value] : nz_LUT) {
+      entries.push_back(key);
+    }
+    std::sort(entries.begin(), entries.end());
+
+    nnzb = static_cast<uint32_t>(entries.size());
+    row_ptr.assign(num_test_nodes + 1, 0);
+    col_ind.resize(nnzb);
+
+    for (uint32_t k = 0; k < nnzb; k++) {
+      nz_LUT[entries[k]] = k;
+      col_ind[k]         = int(entries[k].column);
+      row_ptr[entries[k].row + 1]++;
+    }
+    for (uint64_t r = 0; r < num_test_nodes; r++) {
+      row_ptr[r + 1] += row_ptr[r];
+    }
+
+    initialized = true;
+  }
+
+  /**
+   * @brief record how to expand the block-CSR values into an equivalent scalar CSR matrix, see scalar_row_ptr,
+   * scalar_col_ind and scalar_to_block (only needed when the blocks are given to a scalar CSR consumer)
+   *
+   * @pre init() has been called
+   */
+  void initScalarExpansion()
+  {
+    // the scalar CSR matrix has the same sparsity pattern, but with every block expanded,
+    // so its rows/columns are numbered like the vdofs of the finite element spaces
+    auto vdof = [&](uint64_t node, uint64_t component, uint64_t num_nodes) {
+      return (ordering == mfem::Ordering::byNODES) ? component * num_nodes + node : node * block_size + component;
+    };
+
+    uint64_t bs = block_size;
+    scalar_row_ptr.assign(num_test_nodes * bs + 1, 0);
+    scalar_col_ind.resize(nnzb * bs * bs);
+    scalar_to_block.resize(nnzb * bs * bs);
+
+    // count the entries in each scalar row, then convert those counts to offsets
+    for (uint64_t n = 0; n < num_test_nodes; n++) {
+      for (uint64_t a = 0; a < bs; a++) {
+        scalar_row_ptr[vdof(n, a, num_test_nodes) + 1] = int(uint64_t(row_ptr[n + 1] - row_ptr[n]) * bs);
+      }
+    }
+    for (uint64_t r = 0; r < num_test_nodes * bs; r++) {
+      scalar_row_ptr[r + 1] += scalar_row_ptr[r];
+    }
+
+    for (uint64_t n = 0; n < num_test_nodes; n++) {
+      for (uint64_t a = 0; a < bs; a++) {
+        auto offset = uint64_t(scalar_row_ptr[vdof(n, a, num_test_nodes)]);
+
+        // visit the columns in increasing order, so that each scalar row is sorted
+        auto append = [&](uint64_t k, uint64_t b) {
+          scalar_col_ind[offset]  = int(vdof(uint64_t(col_ind[k]), b, num_trial_nodes));
+          scalar_to_block[offset] = uint32_t(k * bs * bs + a * bs + b);
+          offset++;
+        };
+
+        if (ordering == mfem::Ordering::byNODES) {
+          for (uint64_t b = 0; b < bs; b++) {
+            for (auto k = uint64_t(row_ptr[n]); k < uint64_t(row_ptr[n + 1]); k++) append(k, b);
+          }
+        } else {
+          for (auto k = uint64_t(row_ptr[n]); k < uint64_t(row_ptr[n + 1]); k++) {
+            for (uint64_t b = 0; b < bs; b++) append(k, b);
+          }
+        }
+      }
+    }
+
+    scalar_initialized = true;
+  }
+
+  /**
+   * @brief return the index of the block (into the nonzero blocks) coupling test node i and trial node j
+   * @param i the block row (test node)
+   * @param j the block column (trial node)
+   */
+  uint32_t operator()(int i, int j) const { return nz_LUT.at({uint32_t(i), uint32_t(j)}); }
+
+  /// @brief the number of rows and columns in each block (the number of components per node)
+  uint32_t block_size;
+
+  /// @brief how many nonzero blocks appear in the sparse matrix
+  uint32_t nnzb;
+
+  /// @brief the number of test nodes (block rows)
+  uint64_t num_test_nodes;
+
+  /// @brief the number of trial nodes (block columns)
+  uint64_t num_trial_nodes;
+
+  /// @brief how the vdofs of the test and trial spaces are ordered
+  mfem::Ordering::Type ordering;
+
+  /**
+   * @brief array holding the offsets for a given block row of the sparse matrix
+   * i.e. block row r corresponds to the blocks [row_ptr[r], row_ptr[r+1])
+   */
+  std::vector<int> row_ptr;
+
+  /// @brief array holding the block column associated with each nonzero block
+  std::vector<int> col_ind;
+
+  /// @brief the row offsets of the equivalent scalar CSR matrix
+  std::vector<int> scalar_row_ptr;
+
+  /// @brief the (sorted) column indices of the equivalent scalar CSR matrix
+  std::vector<int> scalar_col_ind;
+
+  /// @brief for each nonzero of the scalar CSR matrix, the index of its value in the block-CSR values
+  std::vector<uint32_t> scalar_to_block;
+
+  /// @brief `nz_LUT` returns the index of the nonzero block corresponding to the (test node, trial node) pair
+  std::unordered_map<Entry, uint32_t, Entry::Hasher> nz_LUT;
+
+  /// @brief specifies if the table has already been initialized or not
+  bool initialized;
+
+  /// @brief specifies if the scalar CSR expansion has already been initialized or not, see initScalarExpansion()
+  bool scalar_initialized;
+};
+
 }  // namespace serac
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
+#include <set>
 #include <vector>
 #include "mfem.hpp"
 
@@ -13,6 +16,40 @@
 
 namespace serac {
 
+/**
+ * @brief the vertex coordinates and attributes of a batch of mesh entities (elements or boundary faces)
+ * that all have the same geometry, see `Domain::ofElementsInBatches`
+ */
+template <int d>
+struct EntityBatch {
+  /// @brief the geometry of every entity in this batch
+  mfem::Geometry::Type geometry;
+
+  /// @brief how many entities are in this batch
+  int size;
+
+  /// @brief how many vertices each entity has
+  int vertices_per_entity;
+
+  /// @brief the vertex coordinates of each entity, stored contiguously: `size * vertices_per_entity` entries in total
+  const tensor<double, d>* vertices;
+
+  /// @brief the attribute of each entity (-1 for faces that have no boundary attribute)
+  const int* attributes;
+
+  /// @brief the coordinates of vertex `v` of entity `e` in this batch
+  const tensor<double, d>& vertex(int e, int v) const { return vertices[e * vertices_per_entity + v]; }
+};
+
+/**
+ * @brief a predicate that is evaluated on an entire EntityBatch at once,
+ * writing `selected[e] = true` for each entity `e` to be included in the Domain
+ *
+ * @note `selected` is zero-initialized before the predicate is called
+ */
+template <int d>
+using BatchPredicate = std::function<void(const EntityBatch<d>&, bool* selected)>;
+
 /**
  * @brief a class for representing a geometric region that can be used for integration
  *
@@ -117,6 +154,70 @@ struct Domain {
   /// @overload
   static Domain ofBoundaryElements(const mfem::Mesh& mesh, std::function<bool(std::vector<vec3>, int)> func);
 
+  /**
+   * @brief create a domain from some subset of the elements (spatial dim == geometry dim) in an mfem::Mesh,
+   * using a predicate that is evaluated on batches of elements
+   *
+   * Unlike `ofElements`, this doesn't invoke a `std::function` (and allocate a list of vertex coordinates)
+   * for every element, which makes a significant difference for very large meshes.
+   *
+   * @param mesh the entire mesh
+   * @param func predicate function for determining which elements will be included in this domain
+   */
+  static Domain ofElementsInBatches(const mfem::Mesh& mesh, BatchPredicate<2> func);
+
+  /// @overload
+  static Domain ofElementsInBatches(const mfem::Mesh& mesh, BatchPredicate<3> func);
+
+  /**
+   * @brief create a domain from some subset of the boundary elements (spatial dim == geometry dim + 1) in an
+   * mfem::Mesh, using a predicate that is evaluated on batches of boundary elements
+   *
+   * @param mesh the entire mesh
+   * @param func predicate function for determining which boundary elements will be included in this domain
+   */
+  static Domain ofBoundaryElementsInBatches(const mfem::Mesh& mesh, BatchPredicate<2> func);
+
+  /// @overload
+  static Domain ofBoundaryElementsInBatches(const mfem::Mesh& mesh, BatchPredicate<3> func);
+
+  /**
+   * @brief create a domain from the elements in an mfem::Mesh whose attribute is in the given set,
+   * reading the mesh's attribute array directly (no vertex coordinates are gathered)
+   *
+   * @param mesh the entire mesh
+   * @param attributes the element attributes to include in this domain
+   */
+  static Domain ofElementsWithAttributes(const mfem::Mesh& mesh, const std::set<int>& attributes);
+
+  /**
+   * @brief create a domain from the boundary elements in an mfem::Mesh whose boundary attribute is in the given set
+   *
+   * @param mesh the entire mesh
+   * @param attributes the boundary attributes to include in this domain
+   */
+  static Domain ofBoundaryElementsWithAttributes(const mfem::Mesh& mesh, const std::set<int>& attributes);
+
+  /**
+   * @brief create a domain from a list of the elements of each geometry in an mfem::Mesh
+   *
+   * @param mesh the entire mesh
+   * @param element_indices for each geometry, the (sorted) indices of the elements to include, counting only
+   * the elements of that geometry (i.e. the same indices used by the "E-vector")
+   */
+  static Domain ofElementsByIndex(const mfem::Mesh&                                        mesh,
+                                  const std::map<mfem::Geometry::Type, std::vector<int> >& element_indices);
+
+  /**
+   * @brief create a domain from a list of the boundary elements of each geometry in an mfem::Mesh
+   *
+   * @param mesh the entire mesh
+   * @param element_indices for each geometry, the (sorted) indices of the boundary elements to include, counting
+   * only the boundary elements of that geometry (i.e. the same indices used by the "E-vector")
+   */
+  static Domain ofBoundaryElementsByIndex(const mfem::Mesh&                                        mesh,
+                                          const std::map<mfem::Geometry::Type, std::vector<int> >& element_indices);
+
   /// @brief get elements by geometry type
   const std::vector<int>& get(mfem::Geometry::Type geom) const
   {
@@ -102,6 +102,23 @@ auto get_derivative_type(const lambda& qf, qpt_data_type qpt_data)
                                make_dual_wrt<i>(qf_arguments{})));
 };
 
+/**
+ * @brief allocate storage for the derivatives of a q-function w.r.t. each of its arguments, at each quadrature point
+ *
+ * @param qf the q-function
+ * @param qpt_data an instance of the quadrature point data type (only used to deduce the derivative types)
+ * @param num_qpts the total number of quadrature points in the domain
+ * @return a tuple of arrays, one for each argument of the q-function
+ */
+template <int dim, typename... trials, typename lambda, typename qpt_data_type, int... i>
+auto allocate_qf_derivatives(const lambda& qf, qpt_data_type qpt_data, uint32_t num_qpts,
+                             std::integer_sequence<int, i...>)
+{
+  return serac::make_tuple(
+      accelerator::make_shared_array<ExecutionSpace::CPU,
+                                     decltype(get_derivative_type<i, dim, trials...>(qf, qpt_data))>(num_qpts)...);
+}
+
 template <typename lambda, int dim, int n, typename... T>
 SERAC_HOST_DEVICE auto batch_apply_qf_no_qdata(const lambda& qf, double t, const tensor<double, dim, n>& x,
                                                const tensor<double, dim, dim, n>& J, const T&... inputs)
@@ -125,11 +142,11 @@ SERAC_HOST_DEVICE auto batch_apply_qf_no_qdata(const lambda& qf, double t, const
 
 template <typename lambda, int dim, int n, typename qpt_data_type, typename... T>
 SERAC_HOST_DEVICE auto batch_apply_qf(const lambda& qf, double t, const tensor<double, dim, n>& x,
-                                      const tensor<double, dim, dim, n>& J, qpt_data_type* qpt_data, bool update_state,
-                                      const T&... inputs)
+                                      const tensor<double, dim, dim, n>& J, QuadratureDataView<qpt_data_type> qpt_data,
+                                      uint32_t e, bool update_state, const T&... inputs)
 {
   using position_t  = serac::tuple<tensor<double, dim>, tensor<double, dim, dim>>;
-  using return_type = decltype(qf(double{}, position_t{}, qpt_data[0], T{}[0]...));
+  using return_type = decltype(qf(double{}, position_t{}, std::declval<qpt_data_type&>(), T{}[0]...));
   tensor<return_type, n> outputs{};
   for (int i = 0; i < n; i++) {
     tensor<double, dim>      x_q;
@@ -140,10 +157,10 @@ SERAC_HOST_DEVICE auto batch_apply_qf(const lambda& qf, double t, const tensor<d
       }
       x_q[j] = x(j, i);
     }
-    auto qdata = qpt_data[i];
+    auto qdata = qpt_data(e, uint32_t(i));
     outputs[i] = qf(t, serac::tuple{x_q, J_q}, qdata, inputs[i]...);
     if (update_state) {
-      qpt_data[i] = qdata;
+      qpt_data.store(e, uint32_t(i), qdata);
     }
   }
   return outputs;
@@ -155,7 +172,7 @@ template <uint32_t differentiation_index, int Q, mfem::Geometry::Type geom, type
 void evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, double t,
                             const std::vector<const double*>& inputs, double* outputs, const double* positions,
                             const double* jacobians, lambda_type qf,
-                            [[maybe_unused]] axom::ArrayView<state_type, 2> qf_state,
+                            [[maybe_unused]] QuadratureDataView<state_type> qf_state,
                             [[maybe_unused]] derivative_type* qf_derivatives, const int* elements,
                             uint32_t num_elements, bool update_state, camp::int_seq<int, indices...>)
 {
@@ -195,7 +212,7 @@ void evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, do
       if constexpr (std::is_same_v<state_type, Nothing>) {
         return batch_apply_qf_no_qdata(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
       } else {
-        return batch_apply_qf(qf, t, x_e, J_e, &qf_state(e, 0), update_state, get<indices>(qf_inputs)...);
+        return batch_apply_qf(qf, t, x_e, J_e, qf_state, e, update_state, get<indices>(qf_inputs)...);
       }
     }();
 
@@ -219,6 +236,142 @@ void evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, do
   return;
 }
 
+/**
+ * @brief a variant of `evaluation_kernel_impl` that seeds every argument of the q-function at once
+ * (see `make_dual_block`), and stores the derivatives w.r.t. each argument in its own buffer.
+ *
+ * This produces the same values and q-function derivatives as calling `evaluation_kernel_impl`
+ * once per argument, but only requires a single pass over the elements.
+ */
+template <int Q, mfem::Geometry::Type geom, typename test_element, typename trial_element_tuple, typename lambda_type,
+          typename state_type, typename derivative_ptrs_type, int... indices>
+void joint_evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, double t,
+                                  const std::vector<const double*>& inputs, double* outputs, const double* positions,
+                                  const double* jacobians, lambda_type qf,
+                                  [[maybe_unused]] QuadratureDataView<state_type> qf_state,
+                                  derivative_ptrs_type qf_derivatives, const int* elements, uint32_t num_elements,
+                                  bool update_state, camp::int_seq<int, indices...>)
+{
+  constexpr int num_args = sizeof...(indices);
+  static_assert(num_args <= 4, "block dual numbers are limited to 4 arguments (serac::tuple has at most 8 entries)");
+
+  auto                           r = reinterpret_cast<typename test_element::dof_type*>(outputs);
+  auto                           x = reinterpret_cast<const typename batched_position<geom, Q>::type*>(positions);
+  auto                           J = reinterpret_cast<const typename batched_jacobian<geom, Q>::type*>(jacobians);
+  TensorProductQuadratureRule<Q> rule{};
+
+  auto qpts_per_elem = num_quadrature_points(geom, Q);
+
+  tuple u = {reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
+
+  // for each element in the domain
+  for (uint32_t e = 0; e < num_elements; ++e) {
+    // load the jacobians and positions for each quadrature point in this element
+    auto J_e = J[e];
+    auto x_e = x[e];
+
+    // batch-calculate values / derivatives of each trial space, at each quadrature point,
+    // where every argument is seeded in its own block of the dual number's gradient
+    tuple qf_inputs = {promote_each_to_dual_block<indices, num_args>(
+        get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule))...};
+
+    // use J_e to transform values / derivatives on the parent element
+    // to the to the corresponding values / derivatives on the physical element
+    (parent_to_physical<get<indices>(trial_elements).family>(get<indices>(qf_inputs), J_e), ...);
+
+    // (batch) evalute the q-function at each quadrature point
+    auto qf_outputs = [&]() {
+      if constexpr (std::is_same_v<state_type, Nothing>) {
+        return batch_apply_qf_no_qdata(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
+      } else {
+        return batch_apply_qf(qf, t, x_e, J_e, qf_state, e, update_state, get<indices>(qf_inputs)...);
+      }
+    }();
+
+    // use J to transform sources / fluxes on the physical element
+    // back to the corresponding sources / fluxes on the parent element
+    physical_to_parent<test_element::family>(qf_outputs, J_e);
+
+    // split the block derivatives up, and write them out to the buffer associated with each argument
+    for (int q = 0; q < leading_dimension(qf_outputs); q++) {
+      uint32_t id = e * uint32_t(qpts_per_elem) + uint32_t(q);
+      (assign_derivative(get<indices>(qf_derivatives)[id], get_gradient(restrict_dual<indices>(qf_outputs[q]))), ...);
+    }
+
+    // (batch) integrate the material response against the test-space basis functions
+    test_element::integrate(get_value(qf_outputs), rule, &r[elements[e]]);
+  }
+}
+
+/**
+ * @brief a variant of `evaluation_kernel_impl` that differentiates along a linear combination of the arguments
+ * that share the trial space of argument `representative`
+ *
+ * Each of those arguments is seeded in the same dual number, scaled by its coefficient (see `make_scaled_dual`),
+ * so that a single q-function evaluation produces the combined derivative (e.g. dR/da + c0 * dR/du), which is
+ * stored in the buffer of argument `representative`.
+ */
+template <uint32_t representative, int Q, mfem::Geometry::Type geom, typename test_element,
+          typename trial_element_tuple, typename lambda_type, typename state_type, typename derivative_type,
+          int... indices>
+void combined_evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, double t,
+                                     const std::vector<const double*>& inputs, double* outputs,
+                                     const double* positions, const double* jacobians, lambda_type qf,
+                                     [[maybe_unused]] QuadratureDataView<state_type> qf_state,
+                                     derivative_type* qf_derivatives, const double* coefficients,
+                                     const int* elements, uint32_t num_elements, bool update_state,
+                                     camp::int_seq<int, indices...>)
+{
+  using representative_element = std::decay_t<decltype(type<representative>(trial_elements))>;
+
+  auto                           r = reinterpret_cast<typename test_element::dof_type*>(outputs);
+  auto                           x = reinterpret_cast<const typename batched_position<geom, Q>::type*>(positions);
+  auto                           J = reinterpret_cast<const typename batched_jacobian<geom, Q>::type*>(jacobians);
+  TensorProductQuadratureRule<Q> rule{};
+
+  auto qpts_per_elem = num_quadrature_points(geom, Q);
+
+  tuple u = {reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
+
+  // for each element in the domain
+  for (uint32_t e = 0; e < num_elements; ++e) {
+    // load the jacobians and positions for each quadrature point in this element
+    auto J_e = J[e];
+    auto x_e = x[e];
+
+    // batch-calculate values / derivatives of each trial space, at each quadrature point,
+    // where the arguments in the linear combination share one (scaled) seed
+    tuple qf_inputs = {
+        promote_each_to_scaled_dual_when<std::is_same_v<std::decay_t<decltype(type<indices>(trial_elements))>,
+                                                        representative_element>>(
+            get<indices>(trial_elements).interpolate(get<indices>(u)[elements[e]], rule), coefficients[indices])...};
+
+    // use J_e to transform values / derivatives on the parent element
+    // to the to the corresponding values / derivatives on the physical element
+    (parent_to_physical<get<indices>(trial_elements).family>(get<indices>(qf_inputs), J_e), ...);
+
+    // (batch) evalute the q-function at each quadrature point
+    auto qf_outputs = [&]() {
+      if constexpr (std::is_same_v<state_type, Nothing>) {
+        return batch_apply_qf_no_qdata(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
+      } else {
+        return batch_apply_qf(qf, t, x_e, J_e, qf_state, e, update_state, get<indices>(qf_inputs)...);
+      }
+    }();
+
+    // use J to transform sources / fluxes on the physical element
+    // back to the corresponding sources / fluxes on the parent element
+    physical_to_parent<test_element::family>(qf_outputs, J_e);
+
+    for (int q = 0; q < leading_dimension(qf_outputs); q++) {
+      qf_derivatives[e * uint32_t(qpts_per_elem) + uint32_t(q)] = get_gradient(qf_outputs[q]);
+    }
+
+    // (batch) integrate the material response against the test-space basis functions
+    test_element::integrate(get_value(qf_outputs), rule, &r[elements[e]]);
+  }
+}
+
 //clang-format off
 template <bool is_QOI, typename S, typename T>
 SERAC_HOST_DEVICE auto chain_rule(const S& dfdx, const T& dx)
@@ -360,6 +513,79 @@ void element_gradient_kernel(ExecArrayView<double, 3, ExecutionSpace::CPU> dK, d
   }
 }
 
+/**
+ * @brief evaluate the integral for an ensemble of inputs, in a single pass over the elements
+ *
+ * The E-vectors interleave the samples: the values of sample `s` on element `e` are stored in
+ * row `e * n + s` of an E-vector holding `n` samples. Inputs with only one sample are shared by
+ * every sample of the ensemble. The geometric factors of each element are loaded once, and
+ * reused for every sample.
+ *
+ * If `differentiation_index` names an argument, the q-function derivatives of each sample are stored
+ * w.r.t. that argument. The derivatives of sample `s` start at `qf_derivatives + s * num_elements * qpts_per_elem`,
+ * and have the same layout as those of `evaluation_kernel_impl`, so the usual action_of_gradient kernel
+ * can be applied to each sample.
+ *
+ * @note the quadrature point data is read (but never updated) by every sample
+ */
+template <uint32_t differentiation_index, int Q, mfem::Geometry::Type geom, typename test_element,
+          typename trial_element_tuple, typename lambda_type, typename state_type, typename derivative_type,
+          int... indices>
+void ensemble_evaluation_kernel_impl(trial_element_tuple trial_elements, test_element, double t,
+                                     const std::vector<const double*>& inputs,
+                                     const std::vector<uint32_t>& input_samples, double* outputs, uint32_t num_samples,
+                                     const double* positions, const double* jacobians, lambda_type qf,
+                                     [[maybe_unused]] QuadratureDataView<state_type> qf_state,
+                                     [[maybe_unused]] derivative_type* qf_derivatives, const int* elements,
+                                     uint32_t num_elements, camp::int_seq<int, indices...>)
+{
+  auto                           r = reinterpret_cast<typename test_element::dof_type*>(outputs);
+  auto                           x = reinterpret_cast<const typename batched_position<geom, Q>::type*>(positions);
+  auto                           J = reinterpret_cast<const typename batched_jacobian<geom, Q>::type*>(jacobians);
+  TensorProductQuadratureRule<Q> rule{};
+
+  [[maybe_unused]] auto qpts_per_elem = uint32_t(num_quadrature_points(geom, Q));
+
+  [[maybe_unused]] tuple u = {
+      reinterpret_cast<const typename decltype(type<indices>(trial_elements))::dof_type*>(inputs[indices])...};
+
+  // for each element in the domain
+  for (uint32_t e = 0; e < num_elements; ++e) {
+    // load the jacobians and positions for each quadrature point in this element
+    auto J_e = J[e];
+    auto x_e = x[e];
+
+    for (uint32_t s = 0; s < num_samples; s++) {
+      // where this sample's values are stored in an E-vector holding n samples
+      [[maybe_unused]] auto row = [&](uint32_t n) { return uint32_t(elements[e]) * n + ((n > 1) ? s : 0); };
+
+      [[maybe_unused]] tuple qf_inputs = {promote_each_to_dual_when<indices == differentiation_index>(
+          get<indices>(trial_elements).interpolate(get<indices>(u)[row(input_samples[indices])], rule))...};
+
+      (parent_to_physical<get<indices>(trial_elements).family>(get<indices>(qf_inputs), J_e), ...);
+
+      auto qf_outputs = [&]() {
+        if constexpr (std::is_same_v<state_type, Nothing>) {
+          return batch_apply_qf_no_qdata(qf, t, x_e, J_e, get<indices>(qf_inputs)...);
+        } else {
+          return batch_apply_qf(qf, t, x_e, J_e, qf_state, e, false, get<indices>(qf_inputs)...);
+        }
+      }();
+
+      physical_to_parent<test_element::family>(qf_outputs, J_e);
+
+      if constexpr (differentiation_index != serac::NO_DIFFERENTIATION) {
+        std::size_t first = (std::size_t(s) * num_elements + e) * qpts_per_elem;
+        for (int q = 0; q < leading_dimension(qf_outputs); q++) {
+          qf_derivatives[first + std::size_t(q)] = get_gradient(qf_outputs[q]);
+        }
+      }
+
+      test_element::integrate(get_value(qf_outputs), rule, &r[row(num_samples)]);
+    }
+  }
+}
+
 template <uint32_t wrt, int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type, typename state_type,
           typename derivative_type>
 auto evaluation_kernel(signature s, const lambda_type& qf, const double* positions, const double* jacobians,
@@ -370,11 +596,91 @@ auto evaluation_kernel(signature s, const lambda_type& qf, const double* positio
   auto test_element   = get_test_element<geom>(s);
   return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool update_state) {
     domain_integral::evaluation_kernel_impl<wrt, Q, geom>(
-        trial_elements, test_element, time, inputs, outputs, positions, jacobians, qf, (*qf_state)[geom],
+        trial_elements, test_element, time, inputs, outputs, positions, jacobians, qf, qf_state->view(geom),
         qf_derivatives.get(), elements, num_elements, update_state, s.index_seq);
   };
 }
 
+/**
+ * @brief create a kernel that evaluates the integral and computes the q-function derivatives
+ * w.r.t. every argument in a single pass
+ *
+ * @param qf_derivatives a tuple of buffers (one per argument) where the q-function derivatives are stored
+ */
+template <int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type, typename state_type,
+          typename... derivative_type>
+auto joint_evaluation_kernel(signature s, const lambda_type& qf, const double* positions, const double* jacobians,
+                             std::shared_ptr<QuadratureData<state_type>>              qf_state,
+                             serac::tuple<std::shared_ptr<derivative_type>...> qf_derivatives, const int* elements,
+                             uint32_t num_elements)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool update_state) {
+    auto derivative_ptrs = serac::apply([](auto&... ptrs) { return serac::make_tuple(ptrs.get()...); }, qf_derivatives);
+    domain_integral::joint_evaluation_kernel_impl<Q, geom>(trial_elements, test_element, time, inputs, outputs,
+                                                           positions, jacobians, qf, qf_state->view(geom),
+                                                           derivative_ptrs, elements, num_elements, update_state,
+                                                           s.index_seq);
+  };
+}
+
+/**
+ * @brief create a kernel that evaluates the integral and differentiates it along a linear combination
+ * of the arguments that share the trial space of argument `representative`, see `combined_evaluation_kernel_impl`
+ *
+ * @param qf_derivatives the buffer of argument `representative`, where the combined derivatives are stored
+ * @param coefficients the coefficient of each argument in the linear combination, read at each evaluation
+ */
+template <uint32_t representative, int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type,
+          typename state_type, typename derivative_type>
+auto combined_evaluation_kernel(signature s, const lambda_type& qf, const double* positions, const double* jacobians,
+                                std::shared_ptr<QuadratureData<state_type>> qf_state,
+                                std::shared_ptr<derivative_type>            qf_derivatives,
+                                std::shared_ptr<std::vector<double>> coefficients, const int* elements,
+                                uint32_t num_elements)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, double* outputs, bool update_state) {
+    domain_integral::combined_evaluation_kernel_impl<representative, Q, geom>(
+        trial_elements, test_element, time, inputs, outputs, positions, jacobians, qf, qf_state->view(geom),
+        qf_derivatives.get(), coefficients->data(), elements, num_elements, update_state, s.index_seq);
+  };
+}
+
+/**
+ * @brief create a kernel that evaluates the integral for an ensemble of inputs,
+ * see `ensemble_evaluation_kernel_impl`
+ *
+ * @param qf_derivatives the buffer where the q-function derivatives of every sample w.r.t. argument `wrt` are
+ * stored, it grows to fit the number of samples of each evaluation (unused when `wrt == NO_DIFFERENTIATION`)
+ */
+template <uint32_t wrt, int Q, mfem::Geometry::Type geom, typename signature, typename lambda_type,
+          typename state_type, typename derivative_type>
+auto ensemble_evaluation_kernel(signature s, const lambda_type& qf, const double* positions, const double* jacobians,
+                                std::shared_ptr<QuadratureData<state_type>>   qf_state,
+                                std::shared_ptr<std::vector<derivative_type>> qf_derivatives, const int* elements,
+                                uint32_t num_elements)
+{
+  auto trial_elements = trial_elements_tuple<geom>(s);
+  auto test_element   = get_test_element<geom>(s);
+  return [=](double time, const std::vector<const double*>& inputs, const std::vector<uint32_t>& input_samples,
+             double* outputs, uint32_t num_samples) {
+    derivative_type* derivatives = nullptr;
+    if constexpr (wrt != NO_DIFFERENTIATION) {
+      std::size_t qpts_per_sample = std::size_t(num_elements) * std::size_t(num_quadrature_points(geom, Q));
+      if (qf_derivatives->size() < num_samples * qpts_per_sample) {
+        qf_derivatives->resize(num_samples * qpts_per_sample);
+      }
+      derivatives = qf_derivatives->data();
+    }
+    domain_integral::ensemble_evaluation_kernel_impl<wrt, Q, geom>(
+        trial_elements, test_element, time, inputs, input_samples, outputs, num_samples, positions, jacobians, qf,
+        qf_state->view(geom), derivatives, elements, num_elements, s.index_seq);
+  };
+}
+
 template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
 std::function<void(const double*, double*)> jacobian_vector_product_kernel(
     signature, std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements)
@@ -386,6 +692,24 @@ std::function<void(const double*, double*)> jacobian_vector_product_kernel(
   };
 }
 
+/**
+ * @brief create a kernel that applies the q-function derivatives of one sample of the last ensemble evaluation
+ * (w.r.t. argument `wrt`) to a (non-interleaved) E-vector, see `ensemble_evaluation_kernel`
+ */
+template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
+std::function<void(const double*, double*, uint32_t)> ensemble_jacobian_vector_product_kernel(
+    signature, std::shared_ptr<std::vector<derivative_type>> qf_derivatives, const int* elements,
+    uint32_t num_elements)
+{
+  return [=](const double* du, double* dr, uint32_t sample) {
+    using test_space  = typename signature::return_type;
+    using trial_space = typename std::tuple_element<wrt, typename signature::parameter_types>::type;
+    std::size_t qpts_per_sample = std::size_t(num_elements) * std::size_t(num_quadrature_points(geom, Q));
+    action_of_gradient_kernel<Q, geom, test_space, trial_space>(
+        du, dr, qf_derivatives->data() + sample * qpts_per_sample, elements, num_elements);
+  };
+}
+
 template <int wrt, int Q, mfem::Geometry::Type geom, typename signature, typename derivative_type>
 std::function<void(ExecArrayView<double, 3, ExecutionSpace::CPU>)> element_gradient_kernel(
     signature, std::shared_ptr<derivative_type> qf_derivatives, const int* elements, uint32_t num_elements)
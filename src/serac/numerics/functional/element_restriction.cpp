@@ -1,5 +1,11 @@
 #include "serac/numerics/functional/element_restriction.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <tuple>
+
 #include "mfem.hpp"
 
 #include "serac/numerics/functional/geometry.hpp"
@@ -466,6 +472,173 @@ void ElementRestriction::ScatterAdd(const mfem::Vector& E_vector, mfem::Vector&
   }
 }
 
+void ElementRestriction::ScatterAdd(const mfem::Vector& E_vector, mfem::Vector& L_vector,
+                                    const std::vector<int>& elements) const
+{
+  for (int i : elements) {
+    for (uint64_t c = 0; c < components; c++) {
+      for (uint64_t j = 0; j < nodes_per_elem; j++) {
+        uint64_t E_id = (uint64_t(i) * components + c) * nodes_per_elem + j;
+        uint64_t L_id = GetVDof(dof_info(i, j), c).index();
+        L_vector[int(L_id)] += E_vector[int(E_id)];
+      }
+    }
+  }
+}
+
+void ElementRestriction::ZeroElements(mfem::Vector& E_vector, const std::vector<int>& elements) const
+{
+  uint64_t values_per_elem = components * nodes_per_elem;
+  double*  E_ptr           = E_vector.ReadWrite();
+  for (int i : elements) {
+    std::fill_n(E_ptr + uint64_t(i) * values_per_elem, values_per_elem, 0.0);
+  }
+}
+
+void ElementRestriction::Gather(const std::vector<const mfem::Vector*>& L_vectors, mfem::Vector& E_vector) const
+{
+  uint64_t num_samples     = L_vectors.size();
+  uint64_t values_per_elem = components * nodes_per_elem;
+  for (uint64_t i = 0; i < num_elements; i++) {
+    for (uint64_t s = 0; s < num_samples; s++) {
+      const mfem::Vector& L_vector = *L_vectors[s];
+      for (uint64_t c = 0; c < components; c++) {
+        for (uint64_t j = 0; j < nodes_per_elem; j++) {
+          uint64_t E_id       = (i * num_samples + s) * values_per_elem + c * nodes_per_elem + j;
+          uint64_t L_id       = GetVDof(dof_info(i, j), c).index();
+          E_vector[int(E_id)] = L_vector[int(L_id)];
+        }
+      }
+    }
+  }
+}
+
+void ElementRestriction::ScatterAdd(const mfem::Vector& E_vector, const std::vector<mfem::Vector*>& L_vectors,
+                                    const std::vector<int>& elements) const
+{
+  uint64_t num_samples     = L_vectors.size();
+  uint64_t values_per_elem = components * nodes_per_elem;
+  for (int i : elements) {
+    for (uint64_t s = 0; s < num_samples; s++) {
+      mfem::Vector& L_vector = *L_vectors[s];
+      for (uint64_t c = 0; c < components; c++) {
+        for (uint64_t j = 0; j < nodes_per_elem; j++) {
+          uint64_t E_id = (uint64_t(i) * num_samples + s) * values_per_elem + c * nodes_per_elem + j;
+          uint64_t L_id = GetVDof(dof_info(i, j), c).index();
+          L_vector[int(L_id)] += E_vector[int(E_id)];
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// @brief used in place of a FaceType in the registry key, for restrictions of domain-type elements
+constexpr int domain_elements = -1;
+
+/**
+ * @brief the properties of a finite element space that determine its element restrictions
+ *
+ * @note the registry is keyed by the address of the space, which may be reused by a new space once the original one
+ * is destroyed. Entries are only reused if the space they were created from still matches this description.
+ */
+struct SpaceDescription {
+  const mfem::Mesh*    mesh;           ///< the mesh the space is defined on
+  long                 mesh_sequence;  ///< the mesh's sequence number, changed by refinement
+  std::string          collection;     ///< the name of the finite element collection
+  int                  vdim;           ///< the number of components
+  mfem::Ordering::Type ordering;       ///< the ordering of the components
+  int                  ndofs;          ///< the number of scalar dofs
+  long                 sequence;       ///< the space's sequence number, changed by updates
+
+  /// @brief describe the space `fes`
+  explicit SpaceDescription(const mfem::FiniteElementSpace* fes)
+      : mesh(fes->GetMesh()),
+        mesh_sequence(fes->GetMesh()->GetSequence()),
+        collection(fes->FEColl()->Name()),
+        vdim(fes->GetVDim()),
+        ordering(fes->GetOrdering()),
+        ndofs(fes->GetNDofs()),
+        sequence(fes->GetSequence())
+  {
+  }
+
+  /// @brief whether two descriptions refer to equivalent spaces
+  bool operator==(const SpaceDescription& other) const
+  {
+    return std::tie(mesh, mesh_sequence, collection, vdim, ordering, ndofs, sequence) ==
+           std::tie(other.mesh, other.mesh_sequence, other.collection, other.vdim, other.ordering, other.ndofs,
+                    other.sequence);
+  }
+};
+
+/// @brief a previously-created ElementRestriction, along with a description of the space it was created from
+struct RegistryEntry {
+  std::weak_ptr<const ElementRestriction> restriction;
+  SpaceDescription                        space;
+};
+
+using RegistryKey = std::tuple<const mfem::FiniteElementSpace*, mfem::Geometry::Type, int>;
+
+std::map<RegistryKey, RegistryEntry>& restriction_registry()
+{
+  static std::map<RegistryKey, RegistryEntry> registry;
+  return registry;
+}
+
+/// @brief guards `restriction_registry()`, since Functionals may be created from several threads
+std::mutex& restriction_registry_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+template <typename... arg_types>
+std::shared_ptr<const ElementRestriction> find_or_create(const RegistryKey& key, const mfem::FiniteElementSpace* fes,
+                                                         arg_types... args)
+{
+  std::lock_guard<std::mutex> lock(restriction_registry_mutex());
+
+  auto&            registry = restriction_registry();
+  SpaceDescription space(fes);
+
+  // entries are only reused if the space hasn't been updated (e.g. by refinement) or replaced since they were
+  // created, and at least one user is still holding on to them
+  auto it = registry.find(key);
+  if (it != registry.end() && it->second.space == space) {
+    if (auto existing = it->second.restriction.lock()) {
+      return existing;
+    }
+  }
+
+  // drop the entries whose restrictions have already been freed, so the registry doesn't grow with every
+  // space that was ever used
+  for (auto entry = registry.begin(); entry != registry.end();) {
+    entry = entry->second.restriction.expired() ? registry.erase(entry) : std::next(entry);
+  }
+
+  auto restriction = std::make_shared<const ElementRestriction>(fes, args...);
+  registry.insert_or_assign(key, RegistryEntry{restriction, space});
+  return restriction;
+}
+
+}  // namespace
+
+std::shared_ptr<const ElementRestriction> get_shared_restriction(const mfem::FiniteElementSpace* fes,
+                                                                 mfem::Geometry::Type            elem_geom)
+{
+  return find_or_create(RegistryKey{fes, elem_geom, domain_elements}, fes, elem_geom);
+}
+
+std::shared_ptr<const ElementRestriction> get_shared_restriction(const mfem::FiniteElementSpace* fes,
+                                                                 mfem::Geometry::Type face_geom, FaceType type)
+{
+  return find_or_create(RegistryKey{fes, face_geom, int(type)}, fes, face_geom, type);
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 BlockElementRestriction::BlockElementRestriction(const mfem::FiniteElementSpace* fes)
@@ -474,13 +647,13 @@ BlockElementRestriction::BlockElementRestriction(const mfem::FiniteElementSpace*
 
   if (dim == 2) {
     for (auto geom : {mfem::Geometry::TRIANGLE, mfem::Geometry::SQUARE}) {
-      restrictions[geom] = ElementRestriction(fes, geom);
+      restrictions[geom] = get_shared_restriction(fes, geom);
     }
   }
 
   if (dim == 3) {
     for (auto geom : {mfem::Geometry::TETRAHEDRON, mfem::Geometry::CUBE}) {
-      restrictions[geom] = ElementRestriction(fes, geom);
+      restrictions[geom] = get_shared_restriction(fes, geom);
     }
   }
 }
@@ -490,19 +663,19 @@ BlockElementRestriction::BlockElementRestriction(const mfem::FiniteElementSpace*
   int dim = fes->GetMesh()->Dimension();
 
   if (dim == 2) {
-    restrictions[mfem::Geometry::SEGMENT] = ElementRestriction(fes, mfem::Geometry::SEGMENT, type);
+    restrictions[mfem::Geometry::SEGMENT] = get_shared_restriction(fes, mfem::Geometry::SEGMENT, type);
   }
 
   if (dim == 3) {
     for (auto geom : {mfem::Geometry::TRIANGLE, mfem::Geometry::SQUARE}) {
-      restrictions[geom] = ElementRestriction(fes, geom, type);
+      restrictions[geom] = get_shared_restriction(fes, geom, type);
     }
   }
 }
 
-uint64_t BlockElementRestriction::ESize() const { return (*restrictions.begin()).second.ESize(); }
+uint64_t BlockElementRestriction::ESize() const { return (*restrictions.begin()).second->ESize(); }
 
-uint64_t BlockElementRestriction::LSize() const { return (*restrictions.begin()).second.LSize(); }
+uint64_t BlockElementRestriction::LSize() const { return (*restrictions.begin()).second->LSize(); }
 
 mfem::Array<int> BlockElementRestriction::bOffsets() const
 {
@@ -512,7 +685,7 @@ mfem::Array<int> BlockElementRestriction::bOffsets() const
   for (int i = 0; i < mfem::Geometry::NUM_GEOMETRIES; i++) {
     auto g = mfem::Geometry::Type(i);
     if (restrictions.count(g) > 0) {
-      offsets[g + 1] = offsets[g] + int(restrictions.at(g).ESize());
+      offsets[g + 1] = offsets[g] + int(restrictions.at(g)->ESize());
     } else {
       offsets[g + 1] = offsets[g];
     }
@@ -521,17 +694,59 @@ mfem::Array<int> BlockElementRestriction::bOffsets() const
   return offsets;
 };
 
+mfem::Array<int> BlockElementRestriction::bOffsets(uint32_t num_samples) const
+{
+  mfem::Array<int> offsets = bOffsets();
+  for (int i = 0; i < offsets.Size(); i++) {
+    offsets[i] *= int(num_samples);
+  }
+  return offsets;
+}
+
 void BlockElementRestriction::Gather(const mfem::Vector& L_vector, mfem::BlockVector& E_block_vector) const
 {
-  for (auto [geom, restriction] : restrictions) {
-    restriction.Gather(L_vector, E_block_vector.GetBlock(geom));
+  for (auto& [geom, restriction] : restrictions) {
+    restriction->Gather(L_vector, E_block_vector.GetBlock(geom));
   }
 }
 
 void BlockElementRestriction::ScatterAdd(const mfem::BlockVector& E_block_vector, mfem::Vector& L_vector) const
 {
-  for (auto [geom, restriction] : restrictions) {
-    restriction.ScatterAdd(E_block_vector.GetBlock(geom), L_vector);
+  for (auto& [geom, restriction] : restrictions) {
+    restriction->ScatterAdd(E_block_vector.GetBlock(geom), L_vector);
+  }
+}
+
+void BlockElementRestriction::ScatterAdd(const mfem::BlockVector& E_block_vector, mfem::Vector& L_vector,
+                                         const std::map<mfem::Geometry::Type, std::vector<int> >& elements) const
+{
+  for (auto& [geom, ids] : elements) {
+    restrictions.at(geom)->ScatterAdd(E_block_vector.GetBlock(geom), L_vector, ids);
+  }
+}
+
+void BlockElementRestriction::Gather(const std::vector<const mfem::Vector*>& L_vectors,
+                                     mfem::BlockVector&                      E_block_vector) const
+{
+  for (auto& [geom, restriction] : restrictions) {
+    restriction->Gather(L_vectors, E_block_vector.GetBlock(geom));
+  }
+}
+
+void BlockElementRestriction::ScatterAdd(const mfem::BlockVector&                                 E_block_vector,
+                                         const std::vector<mfem::Vector*>&                        L_vectors,
+                                         const std::map<mfem::Geometry::Type, std::vector<int> >& elements) const
+{
+  for (auto& [geom, ids] : elements) {
+    restrictions.at(geom)->ScatterAdd(E_block_vector.GetBlock(geom), L_vectors, ids);
+  }
+}
+
+void BlockElementRestriction::ZeroElements(mfem::BlockVector&                                       E_block_vector,
+                                           const std::map<mfem::Geometry::Type, std::vector<int> >& elements) const
+{
+  for (auto& [geom, ids] : elements) {
+    restrictions.at(geom)->ZeroElements(E_block_vector.GetBlock(geom), ids);
   }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+#include <memory>
 #include <vector>
 
 #include "mfem.hpp"
@@ -176,6 +178,25 @@ struct ElementRestriction {
   /// "E->L" in mfem parlance, each element scatter-adds its local vector into the appropriate place in the "L-vector"
   void ScatterAdd(const mfem::Vector& E_vector, mfem::Vector& L_vector) const;
 
+  /// @overload (only the elements in the provided list take part in the scatter-add)
+  void ScatterAdd(const mfem::Vector& E_vector, mfem::Vector& L_vector, const std::vector<int>& elements) const;
+
+  /// set the "E-vector" values associated with the listed elements to zero
+  void ZeroElements(mfem::Vector& E_vector, const std::vector<int>& elements) const;
+
+  /**
+   * @brief "L->E" for an ensemble of L-vectors, where the E-vector interleaves the samples:
+   * the values of sample `s` on element `i` are stored at offset `(i * num_samples + s) * components * nodes_per_elem`
+   *
+   * @param L_vectors the L-vector of each sample
+   * @param E_vector the interleaved E-vector (of size `L_vectors.size() * ESize()`)
+   */
+  void Gather(const std::vector<const mfem::Vector*>& L_vectors, mfem::Vector& E_vector) const;
+
+  /// "E->L" for an interleaved ensemble E-vector (see Gather), only for the elements in the provided list
+  void ScatterAdd(const mfem::Vector& E_vector, const std::vector<mfem::Vector*>& L_vectors,
+                  const std::vector<int>& elements) const;
+
   /// the size of the "E-vector"
   uint64_t esize;
 
@@ -201,6 +222,30 @@ struct ElementRestriction {
   mfem::Ordering::Type ordering;
 };
 
+/**
+ * @brief get the ElementRestriction for all domain-type elements of the specified geometry
+ *
+ * Restrictions are kept in a registry keyed by (space, geometry, FaceType), so every caller that asks for
+ * the same finite element space and geometry (e.g. the residual and parameter-sensitivity `Functional`s
+ * of a physics module) shares one copy of the DoF tables instead of rebuilding them. The registry
+ * only holds weak references: a restriction is freed once its last user is destroyed. Access to the
+ * registry is thread-safe.
+ *
+ * @param fes the finite element space
+ * @param elem_geom the element geometry
+ */
+std::shared_ptr<const ElementRestriction> get_shared_restriction(const mfem::FiniteElementSpace* fes,
+                                                                 mfem::Geometry::Type            elem_geom);
+
+/**
+ * @overload
+ * @param fes the finite element space
+ * @param face_geom the face geometry
+ * @param type which kind of faces (boundary or interior)
+ */
+std::shared_ptr<const ElementRestriction> get_shared_restriction(const mfem::FiniteElementSpace* fes,
+                                                                 mfem::Geometry::Type face_geom, FaceType type);
+
 /**
  * @brief a generalization of mfem::ElementRestriction that works with multiple kinds of element geometries.
  * Instead of doing the "E->L" (gather) and "L->E" (scatter) operations for only one element geometry, this
@@ -231,8 +276,30 @@ struct BlockElementRestriction {
   /// "E->L" in mfem parlance, each element scatter-adds its local vector into the appropriate place in the "L-vector"
   void ScatterAdd(const mfem::BlockVector& E_block_vector, mfem::Vector& L_vector) const;
 
-  /// the individual ElementRestriction operators for each element geometry
-  std::map<mfem::Geometry::Type, ElementRestriction> restrictions;
+  /**
+   * @overload
+   * @param elements the (per-geometry) lists of element indices that take part in the scatter-add,
+   *                 geometries that don't appear in this container are skipped entirely
+   */
+  void ScatterAdd(const mfem::BlockVector& E_block_vector, mfem::Vector& L_vector,
+                  const std::map<mfem::Geometry::Type, std::vector<int> >& elements) const;
+
+  /// set the "E-vector" values associated with the listed (per-geometry) elements to zero
+  void ZeroElements(mfem::BlockVector&                                       E_block_vector,
+                    const std::map<mfem::Geometry::Type, std::vector<int> >& elements) const;
+
+  /// block offsets for E-vectors that interleave the values of several samples on each element
+  mfem::Array<int> bOffsets(uint32_t num_samples) const;
+
+  /// "L->E" for an ensemble of L-vectors, see ElementRestriction::Gather
+  void Gather(const std::vector<const mfem::Vector*>& L_vectors, mfem::BlockVector& E_block_vector) const;
+
+  /// "E->L" for an interleaved ensemble E-vector, only for the listed (per-geometry) elements
+  void ScatterAdd(const mfem::BlockVector& E_block_vector, const std::vector<mfem::Vector*>& L_vectors,
+                  const std::map<mfem::Geometry::Type, std::vector<int> >& elements) const;
+
+  /// the individual ElementRestriction operators for each element geometry (shared, see `get_shared_restriction`)
+  std::map<mfem::Geometry::Type, std::shared_ptr<const ElementRestriction> > restrictions;
 };
 
 }  // namespace serac
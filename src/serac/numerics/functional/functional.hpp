@@ -20,6 +20,7 @@
 #include "serac/numerics/functional/quadrature.hpp"
 #include "serac/numerics/functional/finite_element.hpp"
 #include "serac/numerics/functional/integral.hpp"
+#include "serac/numerics/functional/fused_qfunction.hpp"
 #include "serac/numerics/functional/dof_numbering.hpp"
 #include "serac/numerics/functional/differentiate_wrt.hpp"
 
@@ -27,7 +28,12 @@
 
 #include "serac/numerics/functional/domain.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <map>
 #include <vector>
 
 namespace serac {
@@ -59,6 +65,65 @@ constexpr uint32_t index_of_differentiation()
   return NO_DIFFERENTIATION;
 }
 
+/**
+ * @brief given a list of types, this function returns the indices of every `differentiate_wrt_this` in that list
+ *
+ * @tparam T a list of types
+ *
+ * e.g.
+ * @code{.cpp}
+ * static_assert(indices_of_differentiation < foo, differentiate_wrt_this, baz, differentiate_wrt_this >()[1] == 3);
+ * @endcode
+ */
+template <typename... T>
+constexpr auto indices_of_differentiation()
+{
+  constexpr uint32_t          n          = sizeof...(T);
+  constexpr std::size_t       count      = (std::is_same_v<T, differentiate_wrt_this> + ... + 0);
+  bool                        matching[] = {std::is_same_v<T, differentiate_wrt_this>...};
+  std::array<uint32_t, count> indices{};
+  std::size_t                 k = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    if (matching[i]) {
+      indices[k++] = i;
+    }
+  }
+  return indices;
+}
+
+/**
+ * @brief create the `DifferentiateWRT` tag corresponding to every `differentiate_wrt_this` in a list of types
+ *
+ * @tparam T a list of types
+ * @tparam k 0, 1, ..., (number of `differentiate_wrt_this` in T) - 1
+ */
+template <typename... T, std::size_t... k>
+constexpr auto differentiate_wrt_each(std::index_sequence<k...>)
+{
+  constexpr auto indices = indices_of_differentiation<T...>();
+  return DifferentiateWRT<indices[k]...>{};
+}
+
+/**
+ * @brief given a list of argument types of `Functional::evaluateEnsemble()`, this function returns the index of
+ * the (at most one) argument tagged with `differentiate_wrt()`, or `NO_DIFFERENTIATION` if there is none
+ *
+ * @tparam T a list of types
+ */
+template <typename... T>
+constexpr uint32_t index_of_ensemble_differentiation()
+{
+  constexpr uint32_t n          = sizeof...(T);
+  bool               matching[] = {
+      (std::is_same_v<T, differentiate_wrt_this> || std::is_same_v<T, differentiate_wrt_ensemble_this>)...};
+  for (uint32_t i = 0; i < n; i++) {
+    if (matching[i]) {
+      return i;
+    }
+  }
+  return NO_DIFFERENTIATION;
+}
+
 /**
  * @brief Compile-time alias for index of differentiation
  */
@@ -198,6 +263,7 @@ class Functional<test(trials...), exec> {
                                                            mfem::Geometry::TRIANGLE, mfem::Geometry::TETRAHEDRON};
 
   class Gradient;
+  class EnsembleGradient;
 
   // clang-format off
   template <uint32_t i>
@@ -208,6 +274,15 @@ class Functional<test(trials...), exec> {
         serac::tuple<mfem::Vector&, Gradient&> // otherwise we return the value and the derivative w.r.t arg `i`
         >::type;
   };
+
+  template <uint32_t i>
+  struct ensemble_return {
+    using type = typename std::conditional<
+        i == NO_DIFFERENTIATION,                 // if `i` indicates that we want to skip differentiation
+        const std::vector<mfem::Vector>&,        // we just return the value of each sample
+        serac::tuple<const std::vector<mfem::Vector>&, EnsembleGradient&> // and otherwise their derivatives too
+        >::type;
+  };
   // clang-format on
 
 public:
@@ -226,6 +301,7 @@ public:
 
     for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
       input_E_[type].resize(num_trial_spaces);
+      ensemble_.input_E[type].resize(num_trial_spaces);
     }
 
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
@@ -269,6 +345,8 @@ public:
     // to ensure that those member variables are initialized first
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
       grad_.emplace_back(*this, i);
+      combined_grad_.emplace_back(*this, i, true);
+      ensemble_grad_.emplace_back(*this, i);
     }
   }
 
@@ -297,6 +375,7 @@ public:
     using signature = test(decltype(serac::type<args>(trial_spaces))...);
     integrals_.push_back(
         MakeDomainIntegral<signature, Q, dim>(EntireDomain(domain), integrand, qdata, std::vector<uint32_t>{args...}));
+    register_active_elements(integrals_.back());
   }
 
   /// @overload
@@ -314,6 +393,7 @@ public:
     using signature = test(decltype(serac::type<args>(trial_spaces))...);
     integrals_.push_back(
         MakeDomainIntegral<signature, Q, dim>(domain, integrand, qdata, std::vector<uint32_t>{args...}));
+    register_active_elements(integrals_.back());
   }
 
   /**
@@ -336,6 +416,7 @@ public:
     using signature = test(decltype(serac::type<args>(trial_spaces))...);
     integrals_.push_back(
         MakeBoundaryIntegral<signature, Q, dim>(EntireBoundary(domain), integrand, std::vector<uint32_t>{args...}));
+    register_active_elements(integrals_.back());
   }
 
   /// @overload
@@ -351,6 +432,7 @@ public:
 
     using signature = test(decltype(serac::type<args>(trial_spaces))...);
     integrals_.push_back(MakeBoundaryIntegral<signature, Q, dim>(domain, integrand, std::vector<uint32_t>{args...}));
+    register_active_elements(integrals_.back());
   }
 
   /**
@@ -398,37 +480,42 @@ public:
    * @param input_T the T-vector to apply the action of gradient to
    * @param output_T the T-vector where the resulting values are stored
    * @param which describes which trial space input_T corresponds to
+   * @param combination whether to act with the derivative along the linear combination of arguments of the last
+   * evaluation with `differentiate_along`, rather than the derivative w.r.t. argument `which`
    *
    * @note: it accepts exactly `num_trial_spaces` arguments of type mfem::Vector. Additionally, one of those
    * arguments may be a dual_vector, to indicate that Functional::operator() should not only evaluate the
    * element calculations, but also differentiate them w.r.t. the specified dual_vector argument
    */
-  void ActionOfGradient(const mfem::Vector& input_T, mfem::Vector& output_T, uint32_t which) const
+  void ActionOfGradient(const mfem::Vector& input_T, mfem::Vector& output_T, uint32_t which,
+                        bool combination = false) const
   {
-    P_trial_[which]->Mult(input_T, input_L_[which]);
-
-    output_L_ = 0.0;
-
-    // this is used to mark when gather operations have been performed,
-    // to avoid doing them more than once per trial space
-    bool already_computed[Domain::num_types]{};  // default initializes to `false`
-
-    for (auto& integral : integrals_) {
-      auto type = integral.domain_.type_;
-
-      if (!already_computed[type]) {
-        G_trial_[type][which].Gather(input_L_[which], input_E_[type][which]);
-        already_computed[type] = true;
-      }
-
-      integral.GradientMult(input_E_[type][which], output_E_[type], which);
-
-      // scatter-add to compute residuals on the local processor
-      G_test_[type].ScatterAdd(output_E_[type], output_L_);
-    }
+    applyGradient(input_T, output_T, which,
+                  [&](const Integral& integral, const mfem::BlockVector& input_E, mfem::BlockVector& output_E) {
+                    integral.GradientMult(input_E, output_E, combination ? integral.combined_index_ : which);
+                  });
+  }
 
-    // scatter-add to compute global residuals
-    P_test_->MultTranspose(output_L_, output_T);
+  /**
+   * @brief this function computes the directional derivative of one sample of the last ensemble evaluation,
+   * see `evaluateEnsemble()`
+   *
+   * @param input_T the T-vector to apply the action of gradient to
+   * @param output_T the T-vector where the resulting values are stored
+   * @param which describes which trial space input_T corresponds to
+   * @param sample which sample of the ensemble to differentiate
+   */
+  void ActionOfEnsembleGradient(const mfem::Vector& input_T, mfem::Vector& output_T, uint32_t which,
+                                uint32_t sample) const
+  {
+    SLIC_ERROR_IF(ensemble_.differentiation_index != which || sample >= ensemble_.num_samples,
+                  axom::fmt::format("the last ensemble evaluation has no derivative w.r.t. argument {} of sample {}",
+                                    which, sample));
+
+    applyGradient(input_T, output_T, which,
+                  [&](const Integral& integral, const mfem::BlockVector& input_E, mfem::BlockVector& output_E) {
+                    integral.GradientMultEnsemble(input_E, output_E, which, sample);
+                  });
   }
 
   /**
@@ -448,35 +535,7 @@ public:
   {
     const mfem::Vector* input_T[] = {&static_cast<const mfem::Vector&>(args)...};
 
-    // get the values for each local processor
-    for (uint32_t i = 0; i < num_trial_spaces; i++) {
-      P_trial_[i]->Mult(*input_T[i], input_L_[i]);
-    }
-
-    output_L_ = 0.0;
-
-    // this is used to mark when operations have been performed,
-    // to avoid doing them more than once
-    bool already_computed[Domain::num_types][num_trial_spaces]{};  // default initializes to `false`
-
-    for (auto& integral : integrals_) {
-      auto type = integral.domain_.type_;
-
-      for (auto i : integral.active_trial_spaces_) {
-        if (!already_computed[type][i]) {
-          G_trial_[type][i].Gather(input_L_[i], input_E_[type][i]);
-          already_computed[type][i] = true;
-        }
-      }
-
-      integral.Mult(t, input_E_[type], output_E_[type], wrt, update_qdata_);
-
-      // scatter-add to compute residuals on the local processor
-      G_test_[type].ScatterAdd(output_E_[type], output_L_);
-    }
-
-    // scatter-add to compute global residuals
-    P_test_->MultTranspose(output_L_, output_T_);
+    evaluate(t, input_T, wrt);
 
     if constexpr (wrt != NO_DIFFERENTIATION) {
       // if the user has indicated they'd like to evaluate and differentiate w.r.t.
@@ -497,159 +556,1049 @@ public:
     }
   }
 
-  /// @overload
-  template <typename... T>
-  auto operator()(double t, const T&... args)
+  /**
+   * @brief evaluate the serac::Functional and differentiate it w.r.t. several arguments at once
+   *
+   * Integrals that depend on more than one of the requested arguments compute the q-function derivatives
+   * w.r.t. all of them in a single pass over their elements, rather than one evaluation per argument.
+   *
+   * @code{.cpp}
+   *     auto [value, df_darg0, df_darg1] = my_functional(t, differentiate_wrt(arg0), differentiate_wrt(arg1));
+   * @endcode
+   *
+   * @tparam T the types of the arguments passed in
+   * @param t the time
+   * @param args the trial space dofs used to carry out the calculation
+   * @return the value, followed by the gradients w.r.t. each requested argument (in increasing order)
+   */
+  template <uint32_t wrt0, uint32_t wrt1, uint32_t... wrt, typename... T>
+  auto operator()(DifferentiateWRT<wrt0, wrt1, wrt...>, double t, const T&... args)
   {
-    constexpr int num_differentiated_arguments = (std::is_same_v<T, differentiate_wrt_this> + ...);
-    static_assert(num_differentiated_arguments <= 1,
-                  "Error: Functional::operator() can only differentiate w.r.t. 1 argument a time");
-    static_assert(sizeof...(T) == num_trial_spaces,
-                  "Error: Functional::operator() must take exactly as many arguments as trial spaces");
+    const mfem::Vector* input_T[] = {&static_cast<const mfem::Vector&>(args)...};
+
+    static const std::vector<uint32_t> differentiation_indices{wrt0, wrt1, wrt...};
 
-    [[maybe_unused]] constexpr uint32_t i = index_of_differentiation<T...>();
+    evaluate(t, input_T, differentiation_indices);
 
-    return (*this)(DifferentiateWRT<i>{}, t, args...);
+    return serac::tuple<mfem::Vector&, gradient_ref<wrt0>, gradient_ref<wrt1>, gradient_ref<wrt>...>{
+        output_T_, grad_[wrt0], grad_[wrt1], grad_[wrt]...};
   }
 
   /**
-   * @brief A flag to update the quadrature data for this operator following the computation
+   * @brief evaluate the serac::Functional, and differentiate it along a linear combination of arguments
+   * (see `serac::differentiate_along`) in a single pass over the elements of each integral
    *
-   * Typically this is set to false during nonlinear solution iterations and is set to true for the
-   * final pass once equilibrium is found.
+   * @code{.cpp}
+   *     // the dynamic Jacobian of a residual r(u, a), evaluated at the predicted displacement u = u_n + c a
+   *     auto [value, J] = my_functional(t, differentiate_along(u, c), differentiate_along(a, 1.0));
+   * @endcode
    *
-   * @param update_flag A flag to update the related quadrature data
+   * @tparam T the types of the arguments passed in
+   * @param t the time
+   * @param args the trial space dofs used to carry out the calculation
+   * @return the value, and the gradient sum_i coefficient_i * d(value)/d(arg_i)
+   *
+   * @note the arguments in the linear combination must share the same trial space
    */
-  void updateQdata(bool update_flag) { update_qdata_ = update_flag; }
+  template <typename... T>
+  auto differentiateAlong(double t, const T&... args)
+  {
+    const mfem::Vector* input_T[] = {&static_cast<const mfem::Vector&>(args)...};
 
-private:
-  /// @brief flag for denoting when a residual evaluation should update the material state buffers
-  bool update_qdata_;
+    combination_.indices.clear();
+    combination_.coefficients.clear();
 
-  /**
-   * @brief mfem::Operator representing the gradient matrix that
-   * can compute the action of the gradient (with operator()),
-   * or assemble the sparse matrix representation through implicit conversion to mfem::HypreParMatrix *
-   */
-  class Gradient : public mfem::Operator {
-  public:
-    /**
-     * @brief Constructs a Gradient wrapper that references a parent @p Functional
-     * @param[in] f The @p Functional to use for gradient calculations
-     */
-    Gradient(Functional<test(trials...), exec>& f, uint32_t which = 0)
-        : mfem::Operator(f.test_space_->GetTrueVSize(), f.trial_space_[which]->GetTrueVSize()),
-          form_(f),
-          which_argument(which),
-          test_space_(f.test_space_),
-          trial_space_(f.trial_space_[which]),
-          df_(f.test_space_->GetTrueVSize())
-    {
-      SERAC_MARK_FUNCTION;
+    uint32_t i = 0;
+    (
+        [&](const auto& arg) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(arg)>, differentiate_along_this>) {
+            combination_.indices.push_back(i);
+            combination_.coefficients.push_back(arg.coefficient);
+          }
+          i++;
+        }(args),
+        ...);
+
+    uint32_t first = combination_.indices[0];
+    for (uint32_t index : combination_.indices) {
+      SLIC_ERROR_ROOT_IF(trial_space_[index]->GetTrueVSize() != trial_space_[first]->GetTrueVSize(),
+                         "Error: differentiate_along() requires arguments that share the same trial space");
     }
 
-    /**
-     * @brief implement that action of the gradient: df := df_dx * dx
-     * @param[in] dx a small perturbation in the trial space
-     * @param[in] df the resulting small perturbation in the residuals
-     */
-    virtual void Mult(const mfem::Vector& dx, mfem::Vector& df) const override
-    {
-      form_.ActionOfGradient(dx, df, which_argument);
-    }
+    evaluate(t, input_T, combination_);
 
-    /// @brief syntactic sugar:  df_dx.Mult(dx, df)  <=>  mfem::Vector df = df_dx(dx);
-    mfem::Vector& operator()(const mfem::Vector& dx)
-    {
-      form_.ActionOfGradient(dx, df_, which_argument);
-      return df_;
-    }
+    return serac::tuple<mfem::Vector&, Gradient&>{output_T_, combined_grad_[first]};
+  }
 
-    /// @brief assemble element matrices and form an mfem::HypreParMatrix
-    std::unique_ptr<mfem::HypreParMatrix> assemble()
-    {
-      // the CSR graph (sparsity pattern) is reusable, so we cache
-      // that and ask mfem to not free that memory in ~SparseMatrix()
-      constexpr bool sparse_matrix_frees_graph_ptrs = false;
+  /// @overload
+  template <typename... T>
+  decltype(auto) operator()(double t, const T&... args)
+  {
+    constexpr int num_differentiated_arguments = (std::is_same_v<T, differentiate_wrt_this> + ...);
+    constexpr int num_combined_arguments       = (std::is_same_v<T, differentiate_along_this> + ...);
+    static_assert(sizeof...(T) == num_trial_spaces,
+                  "Error: Functional::operator() must take exactly as many arguments as trial spaces");
 
-      // the CSR values are NOT reusable, so we pass ownership of
-      // them to the mfem::SparseMatrix, to be freed in ~SparseMatrix()
-      constexpr bool sparse_matrix_frees_values_ptr = true;
+    if constexpr (num_combined_arguments > 0) {
+      static_assert(num_differentiated_arguments == 0,
+                    "Error: differentiate_wrt() and differentiate_along() can not be used in the same evaluation");
+      return differentiateAlong(t, args...);
+    } else if constexpr (num_differentiated_arguments <= 1) {
+      [[maybe_unused]] constexpr uint32_t i = index_of_differentiation<T...>();
+
+      return (*this)(DifferentiateWRT<i>{}, t, args...);
+    } else {
+      return (*this)(differentiate_wrt_each<T...>(std::make_index_sequence<num_differentiated_arguments>{}), t,
+                     args...);
+    }
+  }
 
-      constexpr bool col_ind_is_sorted = true;
+  /**
+   * @brief evaluate the serac::Functional for an ensemble of inputs (e.g. several parameter samples),
+   * with a single pass over the elements of each integral
+   *
+   * Each argument is either an mfem::Vector, which is shared by every sample, or a std::vector<mfem::Vector>
+   * with one T-vector per sample. The element values of every sample are interleaved in the E-vectors,
+   * so the geometric factors and element restrictions are only traversed once for the whole ensemble.
+   *
+   * At most one argument may be tagged with `differentiate_wrt()`, in which case the q-function derivatives
+   * of every sample are computed in the same pass, and the derivative of each sample is returned as well
+   * (see `EnsembleGradient`).
+   *
+   * @code{.cpp}
+   *     std::vector<mfem::Vector> conductivities = ...;
+   *     const std::vector<mfem::Vector>& residuals = residual.evaluateEnsemble(t, temperature, conductivities);
+   *
+   *     std::vector<mfem::Vector> temperatures = ...;
+   *     auto [values, dr_dtemperature] = residual.evaluateEnsemble(t, differentiate_wrt(temperatures), conductivities);
+   *     mfem::Vector dr = dr_dtemperature[2](dtemperature);  // the directional derivative of sample 2
+   * @endcode
+   *
+   * @tparam T the types of the arguments passed in
+   * @param t the time
+   * @param args the trial space dofs used to carry out the calculation
+   * @return the residual of each sample (and their derivatives, if requested), which remain valid
+   * until the next ensemble evaluation
+   *
+   * @note quadrature point data is read by every sample, but it is never updated by an ensemble evaluation
+   * @note the samples are evaluated one after another for each element (the q-functions are evaluated with
+   * scalar, or dual number, arguments), rather than being packed into SIMD lanes
+   */
+  template <typename... T>
+  typename ensemble_return<index_of_ensemble_differentiation<T...>()>::type evaluateEnsemble(double t,
+                                                                                            const T&... args)
+  {
+    static_assert(sizeof...(T) == num_trial_spaces,
+                  "Error: Functional::evaluateEnsemble() must take exactly as many arguments as trial spaces");
+    static_assert(((std::is_same_v<T, differentiate_wrt_this> || std::is_same_v<T, differentiate_wrt_ensemble_this>) +
+                   ...) <= 1,
+                  "Error: Functional::evaluateEnsemble() can only differentiate w.r.t. one argument");
+
+    constexpr uint32_t wrt = index_of_ensemble_differentiation<T...>();
+
+    auto& ws = ensemble_;
+
+    // the T-vector(s) of each argument
+    uint32_t arg = 0;
+    (
+        [&](const auto& values) {
+          using value_type = std::decay_t<decltype(values)>;
+          ws.input_T[arg].clear();
+          if constexpr (std::is_same_v<value_type, std::vector<mfem::Vector>> ||
+                        std::is_same_v<value_type, differentiate_wrt_ensemble_this>) {
+            for (auto& value : static_cast<const std::vector<mfem::Vector>&>(values)) {
+              ws.input_T[arg].push_back(&value);
+            }
+          } else {
+            ws.input_T[arg].push_back(&static_cast<const mfem::Vector&>(values));
+          }
+          arg++;
+        }(args),
+        ...);
 
-      if (!lookup_tables.initialized) {
-        lookup_tables.init(form_.G_test_[Domain::Type::Elements],
-                           form_.G_trial_[Domain::Type::Elements][which_argument]);
-      }
+    uint32_t num_samples = 1;
+    for (auto& samples : ws.input_T) {
+      num_samples = std::max(num_samples, uint32_t(samples.size()));
+    }
 
-      double* values = new double[lookup_tables.nnz]{};
+    ws.input_samples.resize(num_trial_spaces);
+    for (uint32_t i = 0; i < num_trial_spaces; i++) {
+      ws.input_samples[i] = uint32_t(ws.input_T[i].size());
+      SLIC_ERROR_IF(ws.input_samples[i] != 1 && ws.input_samples[i] != num_samples,
+                    "every argument of an ensemble evaluation must have either 1 or `num_samples` values");
+    }
 
-      std::map<mfem::Geometry::Type, ExecArray<double, 3, exec>> element_gradients[Domain::num_types];
+    allocateEnsembleWorkspace(num_samples);
 
-      for (auto& integral : form_.integrals_) {
-        auto& K_elem             = element_gradients[integral.domain_.type_];
-        auto& test_restrictions  = form_.G_test_[integral.domain_.type_].restrictions;
-        auto& trial_restrictions = form_.G_trial_[integral.domain_.type_][which_argument].restrictions;
+    // T->L->E for each sample of each argument
+    for (uint32_t i = 0; i < num_trial_spaces; i++) {
+      for (uint32_t s = 0; s < ws.input_samples[i]; s++) {
+        P_trial_[i]->Mult(*ws.input_T[i][s], ws.input_L[i][s]);
+      }
 
-        if (K_elem.empty()) {
-          for (auto& [geom, test_restriction] : test_restrictions) {
-            auto& trial_restriction = trial_restrictions[geom];
+      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+        G_trial_[type][i].Gather(ws.input_L_ptrs[i], ws.input_E[type][i]);
+      }
+    }
 
-            K_elem[geom] = ExecArray<double, 3, exec>(test_restriction.num_elements,
-                                                      trial_restriction.nodes_per_elem * trial_restriction.components,
-                                                      test_restriction.nodes_per_elem * test_restriction.components);
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      ws.output_E[type] = 0.0;
+    }
 
-            detail::zero_out(K_elem[geom]);
-          }
-        }
+    for (auto& integral : integrals_) {
+      auto type = integral.domain_.type_;
+      integral.MultEnsemble(t, ws.input_E[type], ws.input_samples, ws.output_E[type], num_samples, wrt);
+    }
 
-        integral.ComputeElementGradients(K_elem, which_argument);
-      }
+    ws.differentiation_index = wrt;
 
-      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
-        auto& K_elem             = element_gradients[type];
-        auto& test_restrictions  = form_.G_test_[type].restrictions;
-        auto& trial_restrictions = form_.G_trial_[type][which_argument].restrictions;
+    // the samples of each element are contiguous in the interleaved E-vector, so
+    // scaling each element's values applies its weight to every sample
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      applyElementWeights(ws.output_E[type], type);
+    }
 
-        if (!K_elem.empty()) {
-          for (auto [geom, elem_matrices] : K_elem) {
-            std::vector<DoF> test_vdofs(test_restrictions[geom].nodes_per_elem * test_restrictions[geom].components);
-            std::vector<DoF> trial_vdofs(trial_restrictions[geom].nodes_per_elem * trial_restrictions[geom].components);
+    // E->L->T for each sample
+    for (uint32_t s = 0; s < num_samples; s++) {
+      ws.output_L[s] = 0.0;
+    }
 
-            for (axom::IndexType e = 0; e < elem_matrices.shape()[0]; e++) {
-              test_restrictions[geom].GetElementVDofs(e, test_vdofs);
-              trial_restrictions[geom].GetElementVDofs(e, trial_vdofs);
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      G_test_[type].ScatterAdd(ws.output_E[type], ws.output_L_ptrs, active_elements_[type]);
+    }
 
-              for (uint32_t i = 0; i < uint32_t(elem_matrices.shape()[1]); i++) {
-                int col = int(trial_vdofs[i].index());
+    for (uint32_t s = 0; s < num_samples; s++) {
+      P_test_->MultTranspose(ws.output_L[s], ws.output_T[s]);
+    }
 
-                for (uint32_t j = 0; j < uint32_t(elem_matrices.shape()[2]); j++) {
-                  int row = int(test_vdofs[j].index());
+    if constexpr (wrt == NO_DIFFERENTIATION) {
+      return ws.output_T;
+    } else {
+      return {ws.output_T, ensemble_grad_[wrt]};
+    }
+  }
 
-                  int sign = test_vdofs[j].sign() * trial_vdofs[i].sign();
+  /**
+   * @brief A flag to update the quadrature data for this operator following the computation
+   *
+   * Typically this is set to false during nonlinear solution iterations and is set to true for the
+   * final pass once equilibrium is found.
+   *
+   * @param update_flag A flag to update the related quadrature data
+   */
+  void updateQdata(bool update_flag) { update_qdata_ = update_flag; }
 
-                  // note: col / row appear backwards here, because the element matrix kernel
-                  //       is actually transposed, as a result of being row-major storage.
-                  //
-                  //       This is kind of confusing, and will be fixed in a future refactor
-                  //       of the element gradient kernel implementation
-                  [[maybe_unused]] auto nz = lookup_tables(row, col);
-                  values[lookup_tables(row, col)] += sign * elem_matrices(e, i, j);
-                }
-              }
-            }
-          }
-        }
+  /**
+   * @brief reuse the output of each integral whose inputs haven't changed since its last evaluation
+   *
+   * When enabled, each evaluation tracks a version of every trial space input, and keeps a copy of each integral's
+   * contribution to the values of its own elements. An integral is skipped when the time and the versions of its
+   * inputs match those of its memoized output, and the evaluation doesn't differentiate w.r.t. one of its arguments
+   * or update quadrature data.
+   *
+   * This pays off when evaluations only change some of the arguments, e.g. the line search of a Newton solve
+   * changes the displacement, but not the shape or parameters read by traction and pressure integrals.
+   *
+   * @param enable whether to memoize the integral outputs
+   *
+   * @note integrands that read data other than the time and their arguments (e.g. captured by reference) must
+   * call invalidateMemoizedOutputs() when that data changes
+   */
+  void memoizeIntegralOutputs(bool enable)
+  {
+    memoize_outputs_ = enable;
+    if (!enable) {
+      memoized_outputs_.clear();
+      for (auto& previous : previous_input_L_) {
+        previous.Destroy();
       }
+    }
+  }
 
-      // Copy the column indices to an auxilliary array as MFEM can mutate these during HypreParMatrix construction
-      col_ind_copy_ = lookup_tables.col_ind;
-
-      auto J_local =
-          mfem::SparseMatrix(lookup_tables.row_ptr.data(), col_ind_copy_.data(), values, form_.output_L_.Size(),
-                             form_.input_L_[which_argument].Size(), sparse_matrix_frees_graph_ptrs,
-                             sparse_matrix_frees_values_ptr, col_ind_is_sorted);
+  /// @brief discard the memoized integral outputs, so that the next evaluation recomputes every integral
+  void invalidateMemoizedOutputs()
+  {
+    for (auto& memoized : memoized_outputs_) {
+      memoized.valid = false;
+    }
+  }
+
+  /**
+   * @brief scale the contribution of each element (or boundary element) to the residual (and its derivatives)
+   * before assembly, e.g. to evaluate the weighted sum over a sample of elements used by a hyper-reduced model
+   *
+   * @param domain the elements (or boundary elements) whose contributions are scaled
+   * @param weights for each geometry, the weight of each element in `domain.get(geom)`
+   *
+   * @note this replaces any weights previously set for the same kind of domain. Elements that don't
+   * belong to `domain` keep a weight of 1.
+   */
+  void setElementWeights(const Domain& domain, const std::map<mfem::Geometry::Type, std::vector<double>>& weights)
+  {
+    auto type = domain.type_;
+    element_weights_[type].clear();
+    for (auto& [geom, w] : weights) {
+      const std::vector<int>& ids = domain.get(geom);
+      SLIC_ERROR_IF(ids.size() != w.size(), "each element in the domain must have exactly one weight");
+
+      auto& element_weights = element_weights_[type][geom];
+      element_weights.assign(G_test_[type].restrictions.at(geom)->num_elements, 1.0);
+      for (std::size_t i = 0; i < ids.size(); i++) {
+        element_weights[std::size_t(ids[i])] = w[i];
+      }
+    }
+  }
+
+  /**
+   * @brief project the contribution of each element (or boundary element) to the output of the most recent
+   * evaluation (including any element weights) onto some test-space vectors
+   *
+   * This is used to build the element sampling of a hyper-reduced model, see `energyConservingSampling()`.
+   *
+   * @param vectors the T-vectors to project onto
+   * @param type whether to project the contributions of the elements or of the boundary elements
+   * @return for each geometry, a matrix whose entry (k, e) is the contribution of element `e` to `vectors[k]^T r`.
+   * Summing these contributions over elements, boundary elements (and MPI ranks) gives the projection of the
+   * residual.
+   */
+  std::map<mfem::Geometry::Type, mfem::DenseMatrix> elementResidualProjections(
+      const std::vector<mfem::Vector>& vectors, Domain::Type type = Domain::Type::Elements) const
+  {
+    auto&             G = G_test_[type];
+    mfem::Vector      vector_L(P_test_->Height());
+    mfem::BlockVector vector_E(G.bOffsets());
+
+    std::map<mfem::Geometry::Type, mfem::DenseMatrix> projections;
+    for (auto& [geom, restriction] : G.restrictions) {
+      projections[geom].SetSize(int(vectors.size()), int(restriction->num_elements));
+      projections[geom] = 0.0;
+    }
+
+    for (std::size_t k = 0; k < vectors.size(); k++) {
+      P_test_->Mult(vectors[k], vector_L);
+      G.Gather(vector_L, vector_E);
+
+      for (auto& [geom, ids] : active_elements_[type]) {
+        auto&         restriction     = *G.restrictions.at(geom);
+        int           values_per_elem = int(restriction.nodes_per_elem * restriction.components);
+        const double* r               = output_E_[type].GetBlock(geom).GetData();
+        const double* v               = vector_E.GetBlock(geom).GetData();
+        for (int e : ids) {
+          double sum = 0.0;
+          for (int i = 0; i < values_per_elem; i++) {
+            sum += v[e * values_per_elem + i] * r[e * values_per_elem + i];
+          }
+          projections[geom](int(k), e) = sum;
+        }
+      }
+    }
+
+    return projections;
+  }
+
+  /**
+   * @brief set the reduced basis that `Gradient::reducedMatrix()` projects onto
+   *
+   * The element values of each mode are extracted here once, so that each reduced jacobian only needs
+   * the element matrices of the integrated (e.g. ECSW-sampled) elements.
+   *
+   * @param modes the T-vectors of the basis, which must belong to the test space, and to the trial space of any
+   * argument that the reduced jacobian is computed for
+   */
+  void setReducedBasis(const std::vector<mfem::Vector>& modes)
+  {
+    reduced_basis_test_L_.assign(modes.size(), mfem::Vector(P_test_->Height()));
+    for (std::size_t k = 0; k < modes.size(); k++) {
+      P_test_->Mult(modes[k], reduced_basis_test_L_[k]);
+    }
+
+    for (uint32_t i = 0; i < num_trial_spaces; i++) {
+      reduced_basis_trial_L_[i].clear();
+      if (modes.empty() || modes[0].Size() != trial_space_[i]->GetTrueVSize()) continue;
+
+      reduced_basis_trial_L_[i].assign(modes.size(), mfem::Vector(P_trial_[i]->Height()));
+      for (std::size_t k = 0; k < modes.size(); k++) {
+        P_trial_[i]->Mult(modes[k], reduced_basis_trial_L_[i][k]);
+      }
+    }
+  }
+
+private:
+  /// @brief used to return one `Gradient&` for each argument in a pack of differentiation indices
+  template <uint32_t>
+  using gradient_ref = Gradient&;
+
+  /**
+   * @brief compute the residual (stored in output_T_), and record the q-function derivatives
+   * w.r.t. the requested argument(s) for later use by grad_
+   *
+   * @tparam index_type either a single differentiation index or a std::vector of them
+   * @param t the time
+   * @param input_T the T-vectors for each trial space
+   * @param wrt which argument(s) to differentiate with respect to
+   */
+  template <typename index_type>
+  void evaluate(double t, const mfem::Vector* const input_T[], const index_type& wrt)
+  {
+    // get the values for each local processor
+    for (uint32_t i = 0; i < num_trial_spaces; i++) {
+      P_trial_[i]->Mult(*input_T[i], input_L_[i]);
+    }
+
+    if (memoize_outputs_) {
+      updateInputVersions();
+      memoized_outputs_.resize(integrals_.size());
+    }
+
+    output_L_ = 0.0;
+
+    // integrals accumulate their contributions into a shared E-vector, so we only
+    // reset the values for elements that some integral is going to write to
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      G_test_[type].ZeroElements(output_E_[type], active_elements_[type]);
+    }
+
+    // this is used to mark when operations have been performed,
+    // to avoid doing them more than once
+    bool already_computed[Domain::num_types][num_trial_spaces]{};  // default initializes to `false`
+
+    for (std::size_t k = 0; k < integrals_.size(); k++) {
+      auto& integral = integrals_[k];
+      auto  type     = integral.domain_.type_;
+
+      bool memoize = memoize_outputs_ && !update_qdata_ && !differentiates(integral, wrt);
+      if (memoize && memoized_outputs_[k].matches(t, integral.active_trial_spaces_, input_versions_)) {
+        addDomainValues(memoized_outputs_[k].values, integral.domain_, output_E_[type]);
+        if constexpr (std::is_same_v<index_type, DerivativeCombination>) {
+          // this integral doesn't depend on the linear combination
+          integral.combined_index_ = NO_DIFFERENTIATION;
+        }
+        continue;
+      }
+
+      for (auto i : integral.active_trial_spaces_) {
+        if (!already_computed[type][i]) {
+          G_trial_[type][i].Gather(input_L_[i], input_E_[type][i]);
+          already_computed[type][i] = true;
+        }
+      }
+
+      if (memoize_outputs_) {
+        // keep this integral's contribution to the values of its own elements, so that it can be reused by later
+        // evaluations (the difference of the shared E-vector before and after the integral accumulates into it)
+        auto& memoized = memoized_outputs_[k];
+        copyDomainValues(output_E_[type], integral.domain_, memoized.values, false);
+        integral.Mult(t, input_E_[type], output_E_[type], wrt, update_qdata_);
+        copyDomainValues(output_E_[type], integral.domain_, memoized.values, true);
+
+        memoized.valid = !update_qdata_;
+        memoized.t     = t;
+        memoized.versions.resize(integral.active_trial_spaces_.size());
+        for (std::size_t j = 0; j < integral.active_trial_spaces_.size(); j++) {
+          memoized.versions[j] = input_versions_[integral.active_trial_spaces_[j]];
+        }
+      } else {
+        integral.Mult(t, input_E_[type], output_E_[type], wrt, update_qdata_);
+      }
+    }
+
+    // updating the quadrature data may change the outputs of any integral with state
+    if (memoize_outputs_ && update_qdata_) {
+      invalidateMemoizedOutputs();
+    }
+
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      applyElementWeights(output_E_[type], type);
+    }
+
+    // scatter-add to compute residuals on the local processor (once per domain type, and
+    // only over the elements that were touched by at least one integral)
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      G_test_[type].ScatterAdd(output_E_[type], output_L_, active_elements_[type]);
+    }
+
+    // scatter-add to compute global residuals
+    P_test_->MultTranspose(output_L_, output_T_);
+  }
+
+  /**
+   * @brief size the work vectors of evaluateEnsemble() for `num_samples` samples, and the number of samples
+   * of each argument in `ensemble_.input_samples` (only reallocating the ones whose number of samples changed)
+   */
+  void allocateEnsembleWorkspace(uint32_t num_samples)
+  {
+    auto& ws       = ensemble_;
+    auto  mem_type = mfem::Device::GetMemoryType();
+
+    for (uint32_t i = 0; i < num_trial_spaces; i++) {
+      uint32_t n = ws.input_samples[i];
+      if (ws.input_L[i].size() == n) continue;
+
+      ws.input_L[i].resize(n);
+      ws.input_L_ptrs[i].resize(n);
+      for (uint32_t s = 0; s < n; s++) {
+        ws.input_L[i][s].SetSize(P_trial_[i]->Height(), mem_type);
+        ws.input_L_ptrs[i][s] = &ws.input_L[i][s];
+      }
+
+      // note: mfem::BlockVector keeps a pointer to its offsets, so they are stored alongside it
+      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+        ws.input_offsets[type][i] = G_trial_[type][i].bOffsets(n);
+        ws.input_E[type][i].Update(ws.input_offsets[type][i], mem_type);
+      }
+    }
+
+    if (ws.num_samples == num_samples) return;
+
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      ws.output_offsets[type] = G_test_[type].bOffsets(num_samples);
+      ws.output_E[type].Update(ws.output_offsets[type], mem_type);
+    }
+
+    ws.output_L.resize(num_samples);
+    ws.output_L_ptrs.resize(num_samples);
+    ws.output_T.resize(num_samples);
+    for (uint32_t s = 0; s < num_samples; s++) {
+      ws.output_L[s].SetSize(P_test_->Height(), mem_type);
+      ws.output_L_ptrs[s] = &ws.output_L[s];
+      ws.output_T[s].SetSize(test_space_->GetTrueVSize(), mem_type);
+    }
+
+    ws.num_samples = num_samples;
+  }
+
+  /**
+   * @brief the part of the directional derivative calculation shared by ActionOfGradient() and
+   * ActionOfEnsembleGradient(), which only differ in how each integral acts on the element values
+   *
+   * @param input_T the T-vector to apply the action of gradient to
+   * @param output_T the T-vector where the resulting values are stored
+   * @param which describes which trial space input_T corresponds to
+   * @param integral_jvp the callable that accumulates the action of an integral's gradient into an E-vector
+   */
+  template <typename jvp_type>
+  void applyGradient(const mfem::Vector& input_T, mfem::Vector& output_T, uint32_t which,
+                     const jvp_type& integral_jvp) const
+  {
+    P_trial_[which]->Mult(input_T, input_L_[which]);
+
+    output_L_ = 0.0;
+
+    // integrals accumulate their contributions into a shared E-vector, so we only
+    // reset the values for elements that some integral is going to write to
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      G_test_[type].ZeroElements(output_E_[type], active_elements_[type]);
+    }
+
+    // this is used to mark when gather operations have been performed,
+    // to avoid doing them more than once per trial space
+    bool already_computed[Domain::num_types]{};  // default initializes to `false`
+
+    for (auto& integral : integrals_) {
+      auto type = integral.domain_.type_;
+
+      if (!already_computed[type]) {
+        G_trial_[type][which].Gather(input_L_[which], input_E_[type][which]);
+        already_computed[type] = true;
+      }
+
+      integral_jvp(integral, input_E_[type][which], output_E_[type]);
+    }
+
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      applyElementWeights(output_E_[type], type);
+    }
+
+    // scatter-add to compute residuals on the local processor (once per domain type, and
+    // only over the elements that were touched by at least one integral)
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      G_test_[type].ScatterAdd(output_E_[type], output_L_, active_elements_[type]);
+    }
+
+    // scatter-add to compute global residuals
+    P_test_->MultTranspose(output_L_, output_T);
+  }
+
+  /// @brief whether an evaluation w.r.t. `wrt` needs the q-function derivatives of `integral`
+  static bool differentiates(const Integral& integral, uint32_t wrt)
+  {
+    return integral.functional_to_integral_index_.count(wrt) > 0;
+  }
+
+  /// @overload
+  static bool differentiates(const Integral& integral, const std::vector<uint32_t>& wrt)
+  {
+    return std::any_of(wrt.begin(), wrt.end(), [&](uint32_t i) { return differentiates(integral, i); });
+  }
+
+  /// @overload
+  static bool differentiates(const Integral& integral, const DerivativeCombination& combination)
+  {
+    return differentiates(integral, combination.indices);
+  }
+
+  /**
+   * @brief increment the version of each trial space input whose local values changed since the last evaluation
+   *
+   * @note this compares (and, when they changed, copies) the L-vector of each input, a single streaming pass over
+   * memory that stops at the first difference. It is much cheaper than the quadrature point work of the integrals it
+   * lets us skip, but it is not free, so memoization is off by default.
+   */
+  void updateInputVersions()
+  {
+    for (uint32_t i = 0; i < num_trial_spaces; i++) {
+      mfem::Vector& previous = previous_input_L_[i];
+
+      bool changed = (previous.Size() != input_L_[i].Size());
+      if (!changed) {
+        const double* current = input_L_[i].HostRead();
+        const double* old     = previous.HostRead();
+        changed               = !std::equal(current, current + previous.Size(), old);
+      }
+
+      if (changed) {
+        input_versions_[i]++;
+        previous = input_L_[i];
+      }
+    }
+  }
+
+  /**
+   * @brief merge the elements of a newly-added integral's Domain into the per-geometry
+   * lists of elements that are zeroed and scattered in each evaluation
+   *
+   * @param integral the integral that was just added to this Functional
+   */
+  void register_active_elements(const Integral& integral)
+  {
+    auto  type   = integral.domain_.type_;
+    auto& active = active_elements_[type];
+    for (auto& [geom, restriction] : G_test_[type].restrictions) {
+      const std::vector<int>& ids = integral.domain_.get(geom);
+      if (ids.empty()) continue;
+
+      std::vector<int> merged;
+      merged.reserve(active[geom].size() + ids.size());
+      std::set_union(active[geom].begin(), active[geom].end(), ids.begin(), ids.end(), std::back_inserter(merged));
+      active[geom] = std::move(merged);
+    }
+  }
+
+  /// @brief the values of an E-vector on the elements of a Domain, for each geometry (ordered as `domain.get(geom)`)
+  using DomainValues = std::map<mfem::Geometry::Type, mfem::Vector>;
+
+  /**
+   * @brief copy the values of an E-vector on the elements of a Domain, see DomainValues
+   *
+   * @param E_vector the E-vector of the Domain's kind
+   * @param domain the Domain whose elements are copied
+   * @param values the copied values
+   * @param relative whether to store the difference between the E-vector and the existing `values` (e.g. the
+   * contribution of an integral, when `values` holds the E-vector before that integral was evaluated)
+   */
+  void copyDomainValues(const mfem::BlockVector& E_vector, const Domain& domain, DomainValues& values,
+                        bool relative) const
+  {
+    for (auto& [geom, restriction] : G_test_[domain.type_].restrictions) {
+      const std::vector<int>& ids = domain.get(geom);
+      if (ids.empty()) continue;
+
+      std::size_t   values_per_elem = restriction->nodes_per_elem * restriction->components;
+      mfem::Vector& domain_values   = values[geom];
+      domain_values.SetSize(int(ids.size() * values_per_elem));
+
+      const double* E   = E_vector.GetBlock(geom).HostRead();
+      double*       out = domain_values.HostReadWrite();
+      for (std::size_t e = 0; e < ids.size(); e++) {
+        const double* E_e = E + std::size_t(ids[e]) * values_per_elem;
+        for (std::size_t i = 0; i < values_per_elem; i++) {
+          double& value = out[e * values_per_elem + i];
+          value         = relative ? E_e[i] - value : E_e[i];
+        }
+      }
+    }
+  }
+
+  /// @brief add values copied by copyDomainValues() back into an E-vector of the Domain's kind
+  void addDomainValues(const DomainValues& values, const Domain& domain, mfem::BlockVector& E_vector) const
+  {
+    for (auto& [geom, domain_values] : values) {
+      const std::vector<int>& ids             = domain.get(geom);
+      std::size_t             values_per_elem = std::size_t(domain_values.Size()) / ids.size();
+
+      const double* in = domain_values.HostRead();
+      double*       E  = E_vector.GetBlock(geom).HostReadWrite();
+      for (std::size_t e = 0; e < ids.size(); e++) {
+        double* E_e = E + std::size_t(ids[e]) * values_per_elem;
+        for (std::size_t i = 0; i < values_per_elem; i++) {
+          E_e[i] += in[e * values_per_elem + i];
+        }
+      }
+    }
+  }
+
+  /// @brief scale the values of each weighted element in an E-vector of the given kind, see setElementWeights()
+  void applyElementWeights(mfem::BlockVector& E_vector, Domain::Type type) const
+  {
+    for (auto& [geom, weights] : element_weights_[type]) {
+      mfem::Vector& block           = E_vector.GetBlock(geom);
+      std::size_t   values_per_elem = std::size_t(block.Size()) / weights.size();
+      double*       values          = block.ReadWrite();
+      for (std::size_t e = 0; e < weights.size(); e++) {
+        for (std::size_t i = 0; i < values_per_elem; i++) {
+          values[e * values_per_elem + i] *= weights[e];
+        }
+      }
+    }
+  }
+
+  /// @brief flag for denoting when a residual evaluation should update the material state buffers
+  bool update_qdata_;
+
+  /// @brief the output of an integral, and the inputs it was computed from, see memoizeIntegralOutputs()
+  struct MemoizedOutput {
+    DomainValues          values;         ///< the contribution of the integral to its elements' (unweighted) values
+    std::vector<uint64_t> versions;       ///< the version of each of the integral's active trial spaces
+    double                t     = 0.0;    ///< the time of the evaluation
+    bool                  valid = false;  ///< whether output_E may be reused
+
+    /// @brief whether this output was computed at time `t` from the current versions of `active_trial_spaces`
+    bool matches(double time, const std::vector<uint32_t>& active_trial_spaces, const uint64_t* current_versions) const
+    {
+      if (!valid || time != t) return false;
+      for (std::size_t j = 0; j < active_trial_spaces.size(); j++) {
+        if (versions[j] != current_versions[active_trial_spaces[j]]) return false;
+      }
+      return true;
+    }
+  };
+
+  /// @brief whether the outputs of integrals with unchanged inputs are reused, see memoizeIntegralOutputs()
+  bool memoize_outputs_ = false;
+
+  /// @brief the memoized output of each integral
+  std::vector<MemoizedOutput> memoized_outputs_;
+
+  /// @brief a counter for each trial space input, incremented whenever its values change
+  uint64_t input_versions_[num_trial_spaces]{};
+
+  /// @brief the local values of each trial space input at the last memoized evaluation
+  mfem::Vector previous_input_L_[num_trial_spaces];
+
+  /// @brief the weight of each element (for each kind of Domain), for the geometries that have been assigned weights
+  std::map<mfem::Geometry::Type, std::vector<double>> element_weights_[Domain::num_types];
+
+  /// @brief the L-vectors of the reduced basis in the test space, see setReducedBasis()
+  std::vector<mfem::Vector> reduced_basis_test_L_;
+
+  /// @brief the L-vectors of the reduced basis in each trial space (empty if the sizes differ), see setReducedBasis()
+  std::vector<mfem::Vector> reduced_basis_trial_L_[num_trial_spaces];
+
+  /// @brief the work vectors of evaluateEnsemble(), reused between ensemble evaluations of the same size
+  struct EnsembleWorkspace {
+    /// @brief the number of samples of the outputs
+    uint32_t num_samples = 0;
+
+    /// @brief the argument that the q-function derivatives of each sample were computed w.r.t.
+    uint32_t differentiation_index = NO_DIFFERENTIATION;
+
+    /// @brief the number of samples of each argument (1 for arguments shared by every sample)
+    std::vector<uint32_t> input_samples;
+
+    /// @brief the T-vector(s) of each argument
+    std::vector<const mfem::Vector*> input_T[num_trial_spaces];
+
+    /// @brief the L-vector(s) of each argument, and pointers to them
+    std::vector<mfem::Vector>        input_L[num_trial_spaces];
+    std::vector<const mfem::Vector*> input_L_ptrs[num_trial_spaces];
+
+    /// @brief the interleaved E-vectors of each argument, and their block offsets
+    std::vector<mfem::BlockVector> input_E[Domain::num_types];
+    mfem::Array<int>               input_offsets[Domain::num_types][num_trial_spaces];
+
+    /// @brief the interleaved E-vector outputs, and their block offsets
+    mfem::BlockVector output_E[Domain::num_types];
+    mfem::Array<int>  output_offsets[Domain::num_types];
+
+    /// @brief the L-vector output of each sample, and pointers to them
+    std::vector<mfem::Vector>  output_L;
+    std::vector<mfem::Vector*> output_L_ptrs;
+
+    /// @brief the T-vector output of each sample
+    std::vector<mfem::Vector> output_T;
+  };
+
+  /// @brief the work vectors (and outputs) of evaluateEnsemble()
+  EnsembleWorkspace ensemble_;
+
+  /**
+   * @brief mfem::Operator representing the gradient matrix that
+   * can compute the action of the gradient (with operator()),
+   * or assemble the sparse matrix representation through implicit conversion to mfem::HypreParMatrix *
+   */
+  class Gradient : public mfem::Operator {
+  public:
+    /**
+     * @brief Constructs a Gradient wrapper that references a parent @p Functional
+     * @param[in] f The @p Functional to use for gradient calculations
+     * @param[in] which The argument this gradient is taken with respect to
+     * @param[in] combination Whether this is instead the derivative along a linear combination of arguments
+     * (sharing the trial space of argument @p which), see `differentiate_along`
+     */
+    Gradient(Functional<test(trials...), exec>& f, uint32_t which = 0, bool combination = false)
+        : mfem::Operator(f.test_space_->GetTrueVSize(), f.trial_space_[which]->GetTrueVSize()),
+          form_(f),
+          which_argument(which),
+          combination_(combination),
+          test_space_(f.test_space_),
+          trial_space_(f.trial_space_[which]),
+          df_(f.test_space_->GetTrueVSize())
+    {
+      SERAC_MARK_FUNCTION;
+    }
+
+    /**
+     * @brief implement that action of the gradient: df := df_dx * dx
+     * @param[in] dx a small perturbation in the trial space
+     * @param[in] df the resulting small perturbation in the residuals
+     */
+    virtual void Mult(const mfem::Vector& dx, mfem::Vector& df) const override
+    {
+      form_.ActionOfGradient(dx, df, which_argument, combination_);
+    }
+
+    /// @brief syntactic sugar:  df_dx.Mult(dx, df)  <=>  mfem::Vector df = df_dx(dx);
+    mfem::Vector& operator()(const mfem::Vector& dx)
+    {
+      form_.ActionOfGradient(dx, df_, which_argument, combination_);
+      return df_;
+    }
+
+    /**
+     * @brief the local (L-vector) gradient matrix in block-CSR format, where each block couples
+     * a test node and a trial node (see BlockGradientAssemblyLookupTables), e.g. for PETSc's BAIJ matrices
+     */
+    struct BlockCSRMatrix {
+      int                  block_size;      ///< the number of rows and columns in each block
+      int                  num_block_rows;  ///< the number of test nodes
+      int                  num_block_cols;  ///< the number of trial nodes
+      const int*           row_ptr;         ///< block row offsets, num_block_rows + 1 entries
+      const int*           col_ind;         ///< the block column of each nonzero block
+      const double*        values;          ///< the (row-major) values of each nonzero block
+      mfem::Ordering::Type ordering;        ///< how the components of each node are ordered in the L-vectors
+
+      /**
+       * @brief y = A x, one block at a time
+       *
+       * @param x an L-vector of the trial space
+       * @param y an L-vector of the test space
+       */
+      void Mult(const mfem::Vector& x, mfem::Vector& y) const
+      {
+        const double* X = x.HostRead();
+        double*       Y = y.HostWrite();
+
+        // the stride between the components of a node, and between the nodes
+        int x_component_stride = (ordering == mfem::Ordering::byNODES) ? num_block_cols : 1;
+        int y_component_stride = (ordering == mfem::Ordering::byNODES) ? num_block_rows : 1;
+        int node_stride        = (ordering == mfem::Ordering::byNODES) ? 1 : block_size;
+
+        for (int r = 0; r < num_block_rows; r++) {
+          for (int a = 0; a < block_size; a++) {
+            Y[r * node_stride + a * y_component_stride] = 0.0;
+          }
+          for (int k = row_ptr[r]; k < row_ptr[r + 1]; k++) {
+            const double* block = values + k * block_size * block_size;
+            const double* X_c   = X + col_ind[k] * node_stride;
+            for (int a = 0; a < block_size; a++) {
+              double sum = 0.0;
+              for (int b = 0; b < block_size; b++) {
+                sum += block[a * block_size + b] * X_c[b * x_component_stride];
+              }
+              Y[r * node_stride + a * y_component_stride] += sum;
+            }
+          }
+        }
+      }
+    };
+
+    /**
+     * @brief whether assemble() accumulates the element matrices into node-node blocks
+     *
+     * This is the case when enabled by setBlockAssembly(), and the test and trial spaces have the same number (> 1)
+     * of components, so the lookup tables are built for pairs of nodes rather than pairs of vdofs (block_size^2 times
+     * fewer entries).
+     */
+    bool blockAssembly() const { return block_assembly_enabled_ && blockCompatible(); }
+
+    /// @brief whether the test and trial spaces have the same number (> 1) of components, see assembleBlockCSR()
+    bool blockCompatible() const
+    {
+      return test_space_->GetVDim() > 1 && test_space_->GetVDim() == trial_space_->GetVDim() &&
+             test_space_->GetOrdering() == trial_space_->GetOrdering();
+    }
+
+    /**
+     * @brief enable or disable the node-node block assembly (disabled by default)
+     *
+     * When enabled, assemble() accumulates node-node blocks and then expands them into the scalar CSR matrix that
+     * hypre needs, which trades fewer lookups for the memory of the expansion maps. The blocks themselves are used by
+     * assembleBlockCSR() and BlockCSRMatrix::Mult(), which don't need the expansion.
+     */
+    void setBlockAssembly(bool enabled) { block_assembly_enabled_ = enabled; }
+
+    /**
+     * @brief assemble element matrices into the local (L-vector) gradient matrix, in block-CSR format
+     *
+     * @note only available when the test and trial spaces have the same number (> 1) of components. The returned
+     * arrays are owned by this Gradient, and are overwritten by the next assembly.
+     */
+    BlockCSRMatrix assembleBlockCSR()
+    {
+      SLIC_ERROR_IF(!blockCompatible(), "block-CSR assembly requires test and trial spaces with the same vdim");
+
+      if (!block_lookup_tables.initialized) {
+        block_lookup_tables.init(form_.G_test_[Domain::Type::Elements],
+                                 form_.G_trial_[Domain::Type::Elements][which_argument]);
+      }
+
+      uint32_t bs = block_lookup_tables.block_size;
+      block_values_.resize(block_lookup_tables.nnzb * bs * bs);
+      std::fill(block_values_.begin(), block_values_.end(), 0.0);
+
+      computeElementGradients();
+
+      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+        auto& K_elem             = element_gradients_[type];
+        auto& test_restrictions  = form_.G_test_[type].restrictions;
+        auto& trial_restrictions = form_.G_trial_[type][which_argument].restrictions;
+
+        for (auto& [geom, elem_matrices] : K_elem) {
+          auto& test_restriction  = *test_restrictions.at(geom);
+          auto& trial_restriction = *trial_restrictions.at(geom);
+
+          auto test_nodes  = uint32_t(test_restriction.nodes_per_elem);
+          auto trial_nodes = uint32_t(trial_restriction.nodes_per_elem);
+
+          for (axom::IndexType e = 0; e < elem_matrices.shape()[0]; e++) {
+            for (uint32_t i = 0; i < trial_nodes; i++) {
+              DoF trial_node = trial_restriction.dof_info(e, i);
+
+              for (uint32_t j = 0; j < test_nodes; j++) {
+                DoF test_node = test_restriction.dof_info(e, j);
+
+                int     sign  = test_node.sign() * trial_node.sign();
+                double* block = &block_values_[block_lookup_tables(int(test_node.index()), int(trial_node.index())) *
+                                               bs * bs];
+
+                // note: the element matrices are transposed and their vdofs are numbered component-major,
+                //       see GetElementVDofs() and the comment in assemble()
+                for (uint32_t a = 0; a < bs; a++) {
+                  for (uint32_t b = 0; b < bs; b++) {
+                    block[a * bs + b] += sign * elem_matrices(e, b * trial_nodes + i, a * test_nodes + j);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      return BlockCSRMatrix{int(bs),
+                            int(block_lookup_tables.row_ptr.size() - 1),
+                            int(trial_space_->GetNDofs()),
+                            block_lookup_tables.row_ptr.data(),
+                            block_lookup_tables.col_ind.data(),
+                            block_values_.data(),
+                            block_lookup_tables.ordering};
+    }
+
+    /// @brief assemble element matrices and form an mfem::HypreParMatrix
+    std::unique_ptr<mfem::HypreParMatrix> assemble()
+    {
+      // the CSR graph (sparsity pattern) is reusable, so we cache
+      // that and ask mfem to not free that memory in ~SparseMatrix()
+      constexpr bool sparse_matrix_frees_graph_ptrs = false;
+
+      // the CSR values are copied into the mfem::HypreParMatrix below, so
+      // the buffer is owned by this Gradient and reused between assemblies
+      constexpr bool sparse_matrix_frees_values_ptr = false;
+
+      constexpr bool col_ind_is_sorted = true;
+
+      int* row_ptr = nullptr;
+
+      if (blockAssembly()) {
+        // accumulate node-node blocks, and then expand them into the scalar CSR values
+        assembleBlockCSR();
+        if (!block_lookup_tables.scalar_initialized) {
+          block_lookup_tables.initScalarExpansion();
+        }
+
+        const auto& scalar_to_block = block_lookup_tables.scalar_to_block;
+        values_.resize(scalar_to_block.size());
+        for (std::size_t k = 0; k < scalar_to_block.size(); k++) {
+          values_[k] = block_values_[scalar_to_block[k]];
+        }
+
+        row_ptr       = block_lookup_tables.scalar_row_ptr.data();
+        col_ind_copy_ = block_lookup_tables.scalar_col_ind;
+      } else {
+        if (!lookup_tables.initialized) {
+          lookup_tables.init(form_.G_test_[Domain::Type::Elements],
+                             form_.G_trial_[Domain::Type::Elements][which_argument]);
+        }
+
+        values_.resize(lookup_tables.nnz);
+        std::fill(values_.begin(), values_.end(), 0.0);
+
+        computeElementGradients();
+
+        for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+          auto& K_elem             = element_gradients_[type];
+          auto& test_restrictions  = form_.G_test_[type].restrictions;
+          auto& trial_restrictions = form_.G_trial_[type][which_argument].restrictions;
+
+          for (auto& [geom, elem_matrices] : K_elem) {
+            auto& test_restriction  = *test_restrictions.at(geom);
+            auto& trial_restriction = *trial_restrictions.at(geom);
+
+            test_vdofs_.resize(test_restriction.nodes_per_elem * test_restriction.components);
+            trial_vdofs_.resize(trial_restriction.nodes_per_elem * trial_restriction.components);
+
+            for (axom::IndexType e = 0; e < elem_matrices.shape()[0]; e++) {
+              test_restriction.GetElementVDofs(e, test_vdofs_);
+              trial_restriction.GetElementVDofs(e, trial_vdofs_);
+
+              for (uint32_t i = 0; i < uint32_t(elem_matrices.shape()[1]); i++) {
+                int col = int(trial_vdofs_[i].index());
+
+                for (uint32_t j = 0; j < uint32_t(elem_matrices.shape()[2]); j++) {
+                  int row = int(test_vdofs_[j].index());
+
+                  int sign = test_vdofs_[j].sign() * trial_vdofs_[i].sign();
+
+                  // note: col / row appear backwards here, because the element matrix kernel
+                  //       is actually transposed, as a result of being row-major storage.
+                  //
+                  //       This is kind of confusing, and will be fixed in a future refactor
+                  //       of the element gradient kernel implementation
+                  values_[lookup_tables(row, col)] += sign * elem_matrices(e, i, j);
+                }
+              }
+            }
+          }
+        }
+
+        row_ptr = lookup_tables.row_ptr.data();
+
+        // Copy the column indices to an auxilliary array as MFEM can mutate these during HypreParMatrix construction
+        col_ind_copy_ = lookup_tables.col_ind;
+      }
+
+      auto J_local = mfem::SparseMatrix(row_ptr, col_ind_copy_.data(), values_.data(), form_.output_L_.Size(),
+                                        form_.input_L_[which_argument].Size(), sparse_matrix_frees_graph_ptrs,
+                                        sparse_matrix_frees_values_ptr, col_ind_is_sorted);
 
       auto* R = form_.test_space_->Dof_TrueDof_Matrix();
 
@@ -668,7 +1617,142 @@ private:
 
     friend auto assemble(Gradient& g) { return g.assemble(); }
 
+    /**
+     * @brief compute the reduced jacobian Phi^T J Phi, where Phi is the basis set with Functional::setReducedBasis()
+     *
+     * Only the element matrices of the elements integrated by this Functional are computed and projected,
+     * so the cost of a hyper-reduced jacobian scales with the number of sampled elements, rather than with
+     * the size of the mesh.
+     *
+     * @return the (global) reduced jacobian, on every rank
+     */
+    mfem::DenseMatrix reducedMatrix()
+    {
+      const auto& test_modes  = form_.reduced_basis_test_L_;
+      const auto& trial_modes = form_.reduced_basis_trial_L_[which_argument];
+      SLIC_ERROR_IF(test_modes.empty() || trial_modes.size() != test_modes.size(),
+                    "reducedMatrix() requires a reduced basis in the test and trial spaces, see setReducedBasis()");
+
+      computeElementGradients();
+
+      int               num_modes = int(test_modes.size());
+      mfem::DenseMatrix J_reduced(num_modes);
+      J_reduced = 0.0;
+
+      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+        for (auto& [geom, ids] : form_.active_elements_[type]) {
+          auto& elem_matrices     = element_gradients_[type].at(geom);
+          auto& test_restriction  = *form_.G_test_[type].restrictions.at(geom);
+          auto& trial_restriction = *form_.G_trial_[type][which_argument].restrictions.at(geom);
+
+          int num_trial_vdofs = int(elem_matrices.shape()[1]);
+          int num_test_vdofs  = int(elem_matrices.shape()[2]);
+          test_vdofs_.resize(std::size_t(num_test_vdofs));
+          trial_vdofs_.resize(std::size_t(num_trial_vdofs));
+
+          // the values of each mode on an element, and the action of the element matrix on the trial modes
+          mfem::DenseMatrix phi_test(num_test_vdofs, num_modes);
+          mfem::DenseMatrix phi_trial(num_trial_vdofs, num_modes);
+          mfem::DenseMatrix K_phi(num_test_vdofs, num_modes);
+
+          for (int e : ids) {
+            test_restriction.GetElementVDofs(e, test_vdofs_);
+            trial_restriction.GetElementVDofs(e, trial_vdofs_);
+
+            for (int m = 0; m < num_modes; m++) {
+              const mfem::Vector& test_mode  = test_modes[std::size_t(m)];
+              const mfem::Vector& trial_mode = trial_modes[std::size_t(m)];
+              for (int j = 0; j < num_test_vdofs; j++) {
+                DoF dof        = test_vdofs_[std::size_t(j)];
+                phi_test(j, m) = dof.sign() * test_mode[int(dof.index())];
+              }
+              for (int i = 0; i < num_trial_vdofs; i++) {
+                DoF dof         = trial_vdofs_[std::size_t(i)];
+                phi_trial(i, m) = dof.sign() * trial_mode[int(dof.index())];
+              }
+            }
+
+            // note: the element matrices are transposed, see the comment in assemble()
+            K_phi = 0.0;
+            for (int m = 0; m < num_modes; m++) {
+              for (int i = 0; i < num_trial_vdofs; i++) {
+                for (int j = 0; j < num_test_vdofs; j++) {
+                  K_phi(j, m) += elem_matrices(e, i, j) * phi_trial(i, m);
+                }
+              }
+            }
+
+            for (int n = 0; n < num_modes; n++) {
+              for (int m = 0; m < num_modes; m++) {
+                for (int j = 0; j < num_test_vdofs; j++) {
+                  J_reduced(m, n) += phi_test(j, m) * K_phi(j, n);
+                }
+              }
+            }
+          }
+        }
+      }
+
+      MPI_Allreduce(MPI_IN_PLACE, J_reduced.GetData(), num_modes * num_modes, MPI_DOUBLE, MPI_SUM,
+                    test_space_->GetComm());
+      return J_reduced;
+    }
+
   private:
+    /// @brief compute the element gradient matrices of every integral (allocating them on the first call)
+    void computeElementGradients()
+    {
+      for (auto& integral : form_.integrals_) {
+        auto& K_elem             = element_gradients_[integral.domain_.type_];
+        auto& test_restrictions  = form_.G_test_[integral.domain_.type_].restrictions;
+        auto& trial_restrictions = form_.G_trial_[integral.domain_.type_][which_argument].restrictions;
+
+        if (K_elem.empty()) {
+          for (auto& [geom, test_restriction] : test_restrictions) {
+            auto& trial_restriction = trial_restrictions.at(geom);
+
+            K_elem[geom] = ExecArray<double, 3, exec>(test_restriction->num_elements,
+                                                      trial_restriction->nodes_per_elem * trial_restriction->components,
+                                                      test_restriction->nodes_per_elem * test_restriction->components);
+            detail::zero_out(K_elem[geom]);
+          }
+        }
+      }
+
+      // the kernels only write to the elements of their integral's domain, so the other
+      // element matrices stay zero, and only the active ones need to be cleared
+      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+        for (auto& [geom, ids] : form_.active_elements_[type]) {
+          auto& elem_matrices = element_gradients_[type].at(geom);
+          for (int e : ids) {
+            for (axom::IndexType i = 0; i < elem_matrices.shape()[1]; i++) {
+              for (axom::IndexType j = 0; j < elem_matrices.shape()[2]; j++) {
+                elem_matrices(e, i, j) = 0.0;
+              }
+            }
+          }
+        }
+      }
+
+      for (auto& integral : form_.integrals_) {
+        integral.ComputeElementGradients(element_gradients_[integral.domain_.type_],
+                                         combination_ ? integral.combined_index_ : which_argument);
+      }
+
+      for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+        for (auto& [geom, weights] : form_.element_weights_[type]) {
+          auto& elem_matrices = element_gradients_[type].at(geom);
+          for (int e : form_.active_elements_[type][geom]) {
+            for (axom::IndexType i = 0; i < elem_matrices.shape()[1]; i++) {
+              for (axom::IndexType j = 0; j < elem_matrices.shape()[2]; j++) {
+                elem_matrices(e, i, j) *= weights[std::size_t(e)];
+              }
+            }
+          }
+        }
+      }
+    }
+
     /// @brief The "parent" @p Functional to calculate gradients with
     Functional<test(trials...), exec>& form_;
 
@@ -679,12 +1763,30 @@ private:
      */
     GradientAssemblyLookupTables lookup_tables;
 
+    /// @brief lookup tables for where to place each node-node block, used when blockAssembly() is true
+    BlockGradientAssemblyLookupTables block_lookup_tables;
+
+    /// @brief whether assemble() may use node-node blocks, see setBlockAssembly()
+    bool block_assembly_enabled_ = false;
+
     /**
      * @brief Copy of the column indices for sparse matrix assembly
      * @note These are mutated by MFEM during HypreParMatrix construction
      */
     std::vector<int> col_ind_copy_;
 
+    /// @brief the nonzero values of the local sparse matrix, reused between assemblies
+    std::vector<double> values_;
+
+    /// @brief the nonzero values of the local block-CSR matrix, reused between assemblies
+    std::vector<double> block_values_;
+
+    /// @brief element gradient storage (for each kind of Domain and element geometry), reused between assemblies
+    std::map<mfem::Geometry::Type, ExecArray<double, 3, exec>> element_gradients_[Domain::num_types];
+
+    /// @brief scratch space for the test/trial dofs of each element, reused between assemblies
+    std::vector<DoF> test_vdofs_, trial_vdofs_;
+
     /**
      * @brief this member variable tells us which argument the associated Functional this gradient
      *  corresponds to:
@@ -697,6 +1799,9 @@ private:
      */
     uint32_t which_argument;
 
+    /// @brief whether this is the derivative along the linear combination of the last `differentiate_along` evaluation
+    bool combination_;
+
     /// @brief shallow copy of the test space from the associated Functional
     const mfem::ParFiniteElementSpace* test_space_;
 
@@ -707,6 +1812,111 @@ private:
     mfem::Vector df_;
   };
 
+  /**
+   * @brief the derivatives (w.r.t. one argument) of each sample of the last ensemble evaluation, see
+   * evaluateEnsemble()
+   *
+   * Each sample is differentiated about its own inputs, and `operator[](s)` is an mfem::Operator
+   * that computes the action of the gradient of sample `s` (e.g. for the linear solves of each
+   * sample in a batched Newton method, see EnsembleNewtonSolver)
+   */
+  class EnsembleGradient {
+  public:
+    /// @brief the gradient of one sample of the ensemble
+    class Sample : public mfem::Operator {
+    public:
+      /**
+       * @brief Constructs the gradient of one sample of the ensemble evaluations of a @p Functional
+       * @param[in] f The @p Functional to use for gradient calculations
+       * @param[in] which The argument this gradient is taken with respect to
+       * @param[in] sample Which sample of the ensemble this gradient belongs to
+       */
+      Sample(const Functional<test(trials...), exec>& f, uint32_t which, uint32_t sample)
+          : mfem::Operator(f.test_space_->GetTrueVSize(), f.trial_space_[which]->GetTrueVSize()),
+            form_(f),
+            which_argument(which),
+            sample_(sample),
+            df_(f.test_space_->GetTrueVSize())
+      {
+      }
+
+      /**
+       * @brief implement that action of the gradient: df := df_dx * dx
+       * @param[in] dx a small perturbation in the trial space
+       * @param[in] df the resulting small perturbation in the residuals of this sample
+       */
+      virtual void Mult(const mfem::Vector& dx, mfem::Vector& df) const override
+      {
+        form_.ActionOfEnsembleGradient(dx, df, which_argument, sample_);
+      }
+
+      /// @brief syntactic sugar:  df_dx.Mult(dx, df)  <=>  mfem::Vector df = df_dx(dx);
+      mfem::Vector& operator()(const mfem::Vector& dx)
+      {
+        form_.ActionOfEnsembleGradient(dx, df_, which_argument, sample_);
+        return df_;
+      }
+
+    private:
+      /// @brief The "parent" @p Functional to calculate gradients with
+      const Functional<test(trials...), exec>& form_;
+
+      /// @brief which argument of the Functional this gradient corresponds to
+      uint32_t which_argument;
+
+      /// @brief which sample of the ensemble this gradient corresponds to
+      uint32_t sample_;
+
+      /// @brief storage for computing the action-of-gradient output
+      mfem::Vector df_;
+    };
+
+    /**
+     * @brief Constructs the derivatives of the ensemble evaluations of a @p Functional
+     * @param[in] f The @p Functional to use for gradient calculations
+     * @param[in] which The argument this gradient is taken with respect to
+     */
+    EnsembleGradient(Functional<test(trials...), exec>& f, uint32_t which) : form_(f), which_argument(which) {}
+
+    /// @brief the number of samples of the last ensemble evaluation
+    uint32_t size() const { return form_.ensemble_.num_samples; }
+
+    /// @brief the gradient of sample `s` of the last ensemble evaluation
+    Sample& operator[](uint32_t s)
+    {
+      SLIC_ERROR_IF(s >= size(), axom::fmt::format("sample {} is not part of the last ensemble evaluation", s));
+      for (uint32_t i = uint32_t(samples_.size()); i <= s; i++) {
+        samples_.emplace_back(form_, which_argument, i);
+      }
+      return samples_[s];
+    }
+
+    /**
+     * @brief the action of the gradient of every sample: df[s] := df_dx[s] * dx[s]
+     * @param[in] dx a small perturbation in the trial space, for each sample
+     * @param[out] df the resulting small perturbation in the residuals of each sample
+     */
+    void Mult(const std::vector<mfem::Vector>& dx, std::vector<mfem::Vector>& df) const
+    {
+      SLIC_ERROR_IF(dx.size() != size(), "Error: EnsembleGradient::Mult() needs one perturbation for each sample");
+      df.resize(dx.size());
+      for (uint32_t s = 0; s < size(); s++) {
+        df[s].SetSize(form_.test_space_->GetTrueVSize());
+        form_.ActionOfEnsembleGradient(dx[s], df[s], which_argument, s);
+      }
+    }
+
+  private:
+    /// @brief The "parent" @p Functional to calculate gradients with
+    Functional<test(trials...), exec>& form_;
+
+    /// @brief which argument of the Functional this gradient corresponds to
+    uint32_t which_argument;
+
+    /// @brief the gradient of each sample, created on first use (a deque, so that references to them stay valid)
+    std::deque<Sample> samples_;
+  };
+
   /// @brief Manages DOFs for the test space
   const mfem::ParFiniteElementSpace* test_space_;
 
@@ -730,6 +1940,9 @@ private:
 
   mutable mfem::BlockVector output_E_[Domain::num_types];
 
+  /// @brief (sorted) lists of the elements of each geometry that belong to the Domain of at least one integral
+  std::map<mfem::Geometry::Type, std::vector<int>> active_elements_[Domain::num_types];
+
   BlockElementRestriction G_test_[Domain::num_types];
 
   /// @brief The output set of local DOF values (i.e., on the current rank)
@@ -742,6 +1955,18 @@ private:
 
   /// @brief The objects representing the gradients w.r.t. each input argument of the Functional
   mutable std::vector<Gradient> grad_;
+
+  /**
+   * @brief The objects representing the derivatives along a linear combination of arguments,
+   * indexed by the first argument of the combination
+   */
+  mutable std::vector<Gradient> combined_grad_;
+
+  /// @brief The objects representing the derivatives of each sample of an ensemble evaluation w.r.t. each argument
+  mutable std::vector<EnsembleGradient> ensemble_grad_;
+
+  /// @brief the arguments and coefficients of the last `differentiate_along` evaluation, reused between evaluations
+  DerivativeCombination combination_;
 };
 
 }  // namespace serac
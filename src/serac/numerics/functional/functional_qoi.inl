@@ -285,6 +285,11 @@ public:
 
     output_L_ = 0.0;
 
+    // integrals accumulate their contributions into these E-vectors
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      output_E_[type] = 0.0;
+    }
+
     // this is used to mark when gather operations have been performed,
     // to avoid doing them more than once per trial space
     bool already_computed[Domain::num_types]{};  // default initializes to `false`
@@ -298,8 +303,10 @@ public:
       }
 
       integral.GradientMult(input_E_[type][which], output_E_[type], which);
+    }
 
-      // scatter-add to compute residuals on the local processor
+    // scatter-add to compute residuals on the local processor
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
       G_test_.ScatterAdd(output_E_[type], output_L_);
     }
 
@@ -331,6 +338,11 @@ public:
 
     output_L_ = 0.0;
 
+    // integrals accumulate their contributions into these E-vectors
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
+      output_E_[type] = 0.0;
+    }
+
     // this is used to mark when operations have been performed,
     // to avoid doing them more than once
     bool already_computed[Domain::num_types][num_trial_spaces]{};  // default initializes to `false`
@@ -347,8 +359,10 @@ public:
 
       const bool update_state = false;
       integral.Mult(t, input_E_[type], output_E_[type], wrt, update_state);
+    }
 
-      // scatter-add to compute residuals on the local processor
+    // scatter-add to compute residuals on the local processor
+    for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
       G_test_.ScatterAdd(output_E_[type], output_L_);
     }
 
@@ -427,40 +441,47 @@ private:
 
       gradient_L_ = 0.0;
 
-      std::map<mfem::Geometry::Type, ExecArray<double, 3, exec>> element_gradients[Domain::num_types];
-
+      // the element gradient buffers are allocated on the first assembly, and only zeroed afterwards
       for (auto& integral : form_.integrals_) {
-        auto& K_elem             = element_gradients[integral.domain_.type_];
+        auto& K_elem             = element_gradients_[integral.domain_.type_];
         auto& trial_restrictions = form_.G_trial_[integral.domain_.type_][which_argument].restrictions;
 
         if (K_elem.empty()) {
           for (auto& [geom, trial_restriction] : trial_restrictions) {
-            K_elem[geom] = ExecArray<double, 3, exec>(trial_restriction.num_elements, 1,
-                                                      trial_restriction.nodes_per_elem * trial_restriction.components);
-
-            detail::zero_out(K_elem[geom]);
+            K_elem[geom] = ExecArray<double, 3, exec>(trial_restriction->num_elements, 1,
+                                                      trial_restriction->nodes_per_elem * trial_restriction->components);
           }
         }
+      }
+
+      for (auto& K_elem : element_gradients_) {
+        for (auto& [geom, elem_matrices] : K_elem) {
+          detail::zero_out(elem_matrices);
+        }
+      }
 
-        integral.ComputeElementGradients(K_elem, which_argument);
+      for (auto& integral : form_.integrals_) {
+        integral.ComputeElementGradients(element_gradients_[integral.domain_.type_], which_argument);
       }
 
       for (auto type : {Domain::Type::Elements, Domain::Type::BoundaryElements}) {
-        auto& K_elem             = element_gradients[type];
+        auto& K_elem             = element_gradients_[type];
         auto& trial_restrictions = form_.G_trial_[type][which_argument].restrictions;
 
         if (!K_elem.empty()) {
-          for (auto [geom, elem_matrices] : K_elem) {
-            std::vector<DoF> trial_vdofs(trial_restrictions[geom].nodes_per_elem * trial_restrictions[geom].components);
+          for (auto& [geom, elem_matrices] : K_elem) {
+            auto& trial_restriction = *trial_restrictions.at(geom);
+
+            trial_vdofs_.resize(trial_restriction.nodes_per_elem * trial_restriction.components);
 
             for (axom::IndexType e = 0; e < elem_matrices.shape()[0]; e++) {
-              trial_restrictions[geom].GetElementVDofs(e, trial_vdofs);
+              trial_restriction.GetElementVDofs(e, trial_vdofs_);
 
               // note: elem_matrices.shape()[1] is 1 for a QoI
               for (axom::IndexType i = 0; i < elem_matrices.shape()[1]; i++) {
                 for (axom::IndexType j = 0; j < elem_matrices.shape()[2]; j++) {
-                  int sign = trial_vdofs[uint32_t(j)].sign();
-                  int col  = int(trial_vdofs[uint32_t(j)].index());
+                  int sign = trial_vdofs_[uint32_t(j)].sign();
+                  int col  = int(trial_vdofs_[uint32_t(j)].index());
                   gradient_L_[col] += sign * elem_matrices(e, i, j);
                 }
               }
@@ -485,6 +506,12 @@ private:
     uint32_t which_argument;
 
     mfem::Vector gradient_L_;
+
+    /// @brief element gradient storage (for each kind of Domain and element geometry), reused between assemblies
+    std::map<mfem::Geometry::Type, ExecArray<double, 3, exec>> element_gradients_[Domain::num_types];
+
+    /// @brief scratch space for the trial dofs of each element, reused between assemblies
+    std::vector<DoF> trial_vdofs_;
   };
 
   /// @brief Manages DOFs for the test space
@@ -0,0 +1,124 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file fused_qfunction.hpp
+ *
+ * @brief q-function combinators that let several integrands over the same Domain share a single element sweep
+ *
+ * `Functional` erases the type of each q-function when an integral is registered, so integrals that were added
+ * separately can't be merged afterwards. Instead, integrands with identical Domains and `DependsOn<...>` arguments
+ * can be fused before they are registered:
+ *
+ * @code{.cpp}
+ * // two element sweeps: trial interpolation, geometric factors and test integration are all repeated
+ * residual.AddDomainIntegral(Dimension<3>{}, DependsOn<0>{}, material, domain);
+ * residual.AddDomainIntegral(Dimension<3>{}, DependsOn<0>{}, body_force, domain);
+ *
+ * // one element sweep: the q-function outputs are summed at each quadrature point
+ * residual.AddDomainIntegral(Dimension<3>{}, DependsOn<0>{}, fuse(material, body_force), domain);
+ * @endcode
+ */
+
+#pragma once
+
+#include <utility>
+
+#include "serac/infrastructure/accelerator.hpp"
+#include "serac/numerics/functional/tuple.hpp"
+
+namespace serac {
+
+/**
+ * @brief a q-function whose output is the sum of the outputs of several (stateless) q-functions
+ *
+ * @tparam qfunctions the types of the q-functions being fused, all of which must accept the same arguments
+ * and return types that can be added together (e.g. `tuple{source, flux}` with `zero` entries where appropriate)
+ */
+template <typename... qfunctions>
+struct FusedQFunction {
+  static_assert(sizeof...(qfunctions) > 0, "FusedQFunction requires at least one q-function");
+
+  /// @brief the q-functions being fused
+  serac::tuple<qfunctions...> qfs;
+
+  /// @brief evaluate each q-function with the same arguments, and sum their outputs
+  template <typename Position, typename... T>
+  SERAC_HOST_DEVICE auto operator()(double t, const Position& X, const T&... args) const
+  {
+    return evaluate(std::make_integer_sequence<int, int(sizeof...(qfunctions))>{}, t, X, args...);
+  }
+
+private:
+  /// @cond
+  template <int... i, typename Position, typename... T>
+  SERAC_HOST_DEVICE auto evaluate(std::integer_sequence<int, i...>, double t, const Position& X,
+                                  const T&... args) const
+  {
+    return (serac::get<i>(qfs)(t, X, args...) + ...);
+  }
+  /// @endcond
+};
+
+/**
+ * @brief a q-function whose output is the sum of the outputs of one q-function with internal
+ * variables (e.g. a material with plastic state) and any number of stateless q-functions
+ *
+ * @tparam stateful_qfunction the q-function that receives the quadrature point data
+ * @tparam qfunctions the stateless q-functions being fused, which are called without the quadrature point data
+ */
+template <typename stateful_qfunction, typename... qfunctions>
+struct FusedQFunctionWithState {
+  /// @brief the q-function that receives the quadrature point data
+  stateful_qfunction stateful_qf;
+
+  /// @brief the q-functions that do not use quadrature point data
+  serac::tuple<qfunctions...> qfs;
+
+  /// @brief evaluate each q-function with the same arguments, and sum their outputs
+  template <typename Position, typename State, typename... T>
+  SERAC_HOST_DEVICE auto operator()(double t, const Position& X, State& state, const T&... args) const
+  {
+    return evaluate(std::make_integer_sequence<int, int(sizeof...(qfunctions))>{}, t, X, state, args...);
+  }
+
+private:
+  /// @cond
+  template <int... i, typename Position, typename State, typename... T>
+  SERAC_HOST_DEVICE auto evaluate(std::integer_sequence<int, i...>, double t, const Position& X, State& state,
+                                  const T&... args) const
+  {
+    return (stateful_qf(t, X, state, args...) + ... + serac::get<i>(qfs)(t, X, args...));
+  }
+  /// @endcond
+};
+
+/**
+ * @brief combine several stateless q-functions into a single q-function that
+ * evaluates all of them in one pass over the elements of a Domain
+ *
+ * @param qfs the q-functions to fuse
+ */
+template <typename... qfunctions>
+auto fuse(const qfunctions&... qfs)
+{
+  return FusedQFunction<qfunctions...>{serac::tuple<qfunctions...>{qfs...}};
+}
+
+/**
+ * @brief combine a q-function with internal variables and several stateless q-functions
+ * into a single q-function that evaluates all of them in one pass over the elements of a Domain
+ *
+ * @param stateful_qf the q-function that will receive the quadrature point data
+ * @param qfs the stateless q-functions to fuse
+ */
+template <typename stateful_qfunction, typename... qfunctions>
+auto fuse_with_state(const stateful_qfunction& stateful_qf, const qfunctions&... qfs)
+{
+  return FusedQFunctionWithState<stateful_qfunction, qfunctions...>{stateful_qf, serac::tuple<qfunctions...>{qfs...}};
+}
+
+}  // namespace serac
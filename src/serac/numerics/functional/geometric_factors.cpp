@@ -64,9 +64,9 @@ GeometricFactors::GeometricFactors(const Domain& d, int q, mfem::Geometry::Type
   auto* nodes = d.mesh_.GetNodes();
   auto* fes   = nodes->FESpace();
 
-  auto         restriction = serac::ElementRestriction(fes, g);
-  mfem::Vector X_e(int(restriction.ESize()));
-  restriction.Gather(*nodes, X_e);
+  auto         restriction = serac::get_shared_restriction(fes, g);
+  mfem::Vector X_e(int(restriction->ESize()));
+  restriction->Gather(*nodes, X_e);
 
   // assumes all elements are the same order
   int p = fes->GetElementOrder(0);
@@ -142,9 +142,9 @@ GeometricFactors::GeometricFactors(const Domain& d, int q, mfem::Geometry::Type
   auto* nodes = d.mesh_.GetNodes();
   auto* fes   = nodes->FESpace();
 
-  auto         restriction = serac::ElementRestriction(fes, g, type);
-  mfem::Vector X_e(int(restriction.ESize()));
-  restriction.Gather(*nodes, X_e);
+  auto         restriction = serac::get_shared_restriction(fes, g, type);
+  mfem::Vector X_e(int(restriction->ESize()));
+  restriction->Gather(*nodes, X_e);
 
   // assumes all elements are the same order
   int p = fes->GetElementOrder(0);
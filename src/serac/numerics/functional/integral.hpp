@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <memory>
+#include <tuple>
+#include <vector>
 
 #include "mfem.hpp"
 
@@ -20,6 +23,26 @@
 
 namespace serac {
 
+/**
+ * @brief the index of the first type in a list that is the same as its `i`th type
+ *
+ * e.g. the arguments of a linear combination of derivatives can share one set of q-function derivatives
+ * if they have the same trial space, see `Integral::Mult(..., const DerivativeCombination&, ...)`
+ */
+template <uint32_t i, typename... T>
+constexpr uint32_t first_index_of_same_type()
+{
+  using target = std::tuple_element_t<i, std::tuple<T...>>;
+
+  bool matching[] = {std::is_same_v<T, target>...};
+  for (uint32_t j = 0; j < i; j++) {
+    if (matching[j]) {
+      return j;
+    }
+  }
+  return i;
+}
+
 /// @brief a class for representing a Integral calculations and their derivatives
 struct Integral {
   /// @brief the number of different kinds of integration domains
@@ -38,7 +61,14 @@ struct Integral {
       : domain_(d), active_trial_spaces_(trial_space_indices)
   {
     std::size_t num_trial_spaces = trial_space_indices.size();
+    inputs_.resize(num_trial_spaces);
+    input_samples_.resize(num_trial_spaces);
     evaluation_with_AD_.resize(num_trial_spaces);
+    evaluation_with_combined_AD_.resize(num_trial_spaces);
+    ensemble_evaluation_with_AD_.resize(num_trial_spaces);
+    ensemble_jvp_.resize(num_trial_spaces);
+    combination_coefficients_ = std::make_shared<std::vector<double> >(num_trial_spaces, 0.0);
+    representative_.resize(num_trial_spaces);
     jvp_.resize(num_trial_spaces);
     element_gradient_.resize(num_trial_spaces);
 
@@ -55,7 +85,8 @@ struct Integral {
    * @param input_E a collection (one for each trial space) of block vectors (block index corresponds to the element
    * geometry) containing input values for each element.
    * @param output_E a block vector (block index corresponds to the element geometry) of the output values for each
-   * element.
+   * element. The contributions from this integral are added to the existing values in `output_E`, so that several
+   * integrals over the same kind of Domain may accumulate into a single E-vector before scattering.
    * @param differentiation_index a non-negative value indicates differentiation with respect to the trial space with
    * that index. A value of -1 indicates no differentiation will occur.
    * @param update_state whether or not to store the updated state values computed in the q-function. For plasticity and
@@ -65,18 +96,151 @@ struct Integral {
   void Mult(double t, const std::vector<mfem::BlockVector>& input_E, mfem::BlockVector& output_E,
             uint32_t differentiation_index, bool update_state) const
   {
-    output_E = 0.0;
-
     bool with_AD =
         (functional_to_integral_index_.count(differentiation_index) > 0 && differentiation_index != NO_DIFFERENTIATION);
     auto& kernels =
         (with_AD) ? evaluation_with_AD_[functional_to_integral_index_.at(differentiation_index)] : evaluation_;
     for (auto& [geometry, func] : kernels) {
-      std::vector<const double*> inputs(active_trial_spaces_.size());
       for (std::size_t i = 0; i < active_trial_spaces_.size(); i++) {
-        inputs[i] = input_E[uint32_t(active_trial_spaces_[i])].GetBlock(geometry).Read();
+        inputs_[i] = input_E[uint32_t(active_trial_spaces_[i])].GetBlock(geometry).Read();
+      }
+      func(t, inputs_, output_E.GetBlock(geometry).ReadWrite(), update_state);
+    }
+  }
+
+  /**
+   * @brief evaluate the integral, and store q-function derivatives with respect to several trial spaces
+   *        in a single pass over the elements
+   *
+   * @param t the time
+   * @param input_E a collection (one for each trial space) of block vectors (block index corresponds to the element
+   * geometry) containing input values for each element.
+   * @param output_E a block vector (block index corresponds to the element geometry) of the output values for each
+   * element. The contributions from this integral are added to the existing values in `output_E`.
+   * @param differentiation_indices the (`Functional`) indices of the trial spaces to differentiate with respect to
+   * @param update_state whether or not to store the updated state values computed in the q-function
+   *
+   * @note if this integral depends on more than one of the requested trial spaces, the derivatives w.r.t. every
+   * argument of the integrand are computed together (even those that weren't requested), which is still cheaper
+   * than evaluating the integral once per argument.
+   */
+  void Mult(double t, const std::vector<mfem::BlockVector>& input_E, mfem::BlockVector& output_E,
+            const std::vector<uint32_t>& differentiation_indices, bool update_state) const
+  {
+    uint32_t num_relevant = 0;
+    uint32_t first        = NO_DIFFERENTIATION;
+    for (uint32_t index : differentiation_indices) {
+      if (functional_to_integral_index_.count(index) > 0) {
+        if (num_relevant++ == 0) first = index;
+      }
+    }
+
+    if (num_relevant <= 1 || evaluation_with_joint_AD_.empty()) {
+      Mult(t, input_E, output_E, first, update_state);
+
+      // no joint kernel available (e.g. too many arguments), so the remaining
+      // derivatives are recorded by additional passes whose outputs are discarded
+      if (num_relevant > 1) {
+        scratch_offsets_.SetSize(output_E.NumBlocks() + 1);
+        scratch_offsets_[0] = 0;
+        for (int b = 0; b < output_E.NumBlocks(); b++) {
+          scratch_offsets_[b + 1] = scratch_offsets_[b] + output_E.BlockSize(b);
+        }
+        scratch_E_.SetSize(output_E.Size());  // only reallocates when the outputs grow
+        mfem::BlockVector unused(scratch_E_.GetData(), scratch_offsets_);
+        for (uint32_t index : differentiation_indices) {
+          if (index != first && functional_to_integral_index_.count(index) > 0) {
+            Mult(t, input_E, unused, index, false);
+          }
+        }
+      }
+      return;
+    }
+
+    for (auto& [geometry, func] : evaluation_with_joint_AD_) {
+      for (std::size_t i = 0; i < active_trial_spaces_.size(); i++) {
+        inputs_[i] = input_E[uint32_t(active_trial_spaces_[i])].GetBlock(geometry).Read();
+      }
+      func(t, inputs_, output_E.GetBlock(geometry).ReadWrite(), update_state);
+    }
+  }
+
+  /**
+   * @brief evaluate the integral, and store the q-function derivatives along a linear combination of trial spaces
+   *        (e.g. the c * du + da that gives the dynamic Jacobian M + c K) in a single pass over the elements
+   *
+   * The combined derivatives are stored in the buffer of the trial space with index `combined_index_`,
+   * so that `GradientMult` and `ComputeElementGradients` with that index act with the linear combination.
+   *
+   * @param t the time
+   * @param input_E a collection (one for each trial space) of block vectors (block index corresponds to the element
+   * geometry) containing input values for each element.
+   * @param output_E a block vector (block index corresponds to the element geometry) of the output values for each
+   * element. The contributions from this integral are added to the existing values in `output_E`.
+   * @param combination the (`Functional`) indices of the trial spaces in the linear combination, and their coefficients
+   * @param update_state whether or not to store the updated state values computed in the q-function
+   */
+  void Mult(double t, const std::vector<mfem::BlockVector>& input_E, mfem::BlockVector& output_E,
+            const DerivativeCombination& combination, bool update_state) const
+  {
+    std::fill(combination_coefficients_->begin(), combination_coefficients_->end(), 0.0);
+
+    uint32_t representative = NO_DIFFERENTIATION;
+    for (std::size_t k = 0; k < combination.indices.size(); k++) {
+      if (functional_to_integral_index_.count(combination.indices[k]) == 0) continue;
+
+      uint32_t i                      = functional_to_integral_index_.at(combination.indices[k]);
+      (*combination_coefficients_)[i] = combination.coefficients[k];
+
+      SLIC_ERROR_IF(representative != NO_DIFFERENTIATION && representative != representative_[i],
+                    "Error: differentiating along a linear combination of arguments with different trial spaces");
+      representative = representative_[i];
+    }
+
+    if (representative == NO_DIFFERENTIATION || evaluation_with_combined_AD_[representative].empty()) {
+      combined_index_ = NO_DIFFERENTIATION;
+      Mult(t, input_E, output_E, NO_DIFFERENTIATION, update_state);
+      return;
+    }
+
+    combined_index_ = active_trial_spaces_[representative];
+    for (auto& [geometry, func] : evaluation_with_combined_AD_[representative]) {
+      for (std::size_t i = 0; i < active_trial_spaces_.size(); i++) {
+        inputs_[i] = input_E[uint32_t(active_trial_spaces_[i])].GetBlock(geometry).Read();
+      }
+      func(t, inputs_, output_E.GetBlock(geometry).ReadWrite(), update_state);
+    }
+  }
+
+  /**
+   * @brief evaluate the integral for an ensemble of inputs, in a single pass over the elements
+   *
+   * @param t the time
+   * @param input_E a collection (one for each trial space) of block vectors that interleave the element values of
+   * each sample (see `BlockElementRestriction::Gather`)
+   * @param input_samples how many samples each of the block vectors in `input_E` holds (either 1, for inputs shared
+   * by every sample, or `num_samples`)
+   * @param output_E a block vector that interleaves the output values of each sample. As with `Mult`, the
+   * contributions from this integral are added to the existing values in `output_E`.
+   * @param num_samples the number of samples in the ensemble
+   * @param differentiation_index a non-negative value indicates that the q-function derivatives of each sample
+   * w.r.t. the trial space with that index are stored, for use by `GradientMultEnsemble`
+   *
+   * @note quadrature point data is not updated by ensemble evaluations
+   */
+  void MultEnsemble(double t, const std::vector<mfem::BlockVector>& input_E, const std::vector<uint32_t>& input_samples,
+                    mfem::BlockVector& output_E, uint32_t num_samples, uint32_t differentiation_index) const
+  {
+    bool with_AD =
+        (functional_to_integral_index_.count(differentiation_index) > 0 && differentiation_index != NO_DIFFERENTIATION);
+    auto& kernels = (with_AD) ? ensemble_evaluation_with_AD_[functional_to_integral_index_.at(differentiation_index)]
+                              : ensemble_evaluation_;
+    for (auto& [geometry, func] : kernels) {
+      for (std::size_t i = 0; i < active_trial_spaces_.size(); i++) {
+        inputs_[i]        = input_E[uint32_t(active_trial_spaces_[i])].GetBlock(geometry).Read();
+        input_samples_[i] = input_samples[uint32_t(active_trial_spaces_[i])];
       }
-      func(t, inputs, output_E.GetBlock(geometry).ReadWrite(), update_state);
+      func(t, inputs_, input_samples_, output_E.GetBlock(geometry).ReadWrite(), num_samples);
     }
   }
 
@@ -86,14 +250,12 @@ struct Integral {
    * @param input_E a block vector (block index corresponds to the element geometry) of a specific trial space element
    * values
    * @param output_E a block vector (block index corresponds to the element geometry) of the output values for each
-   * element.
+   * element. As with `Mult`, the contributions from this integral are added to the existing values in `output_E`.
    * @param differentiation_index a non-negative value indicates directional derivative with respect to the trial space
    * with that index.
    */
   void GradientMult(const mfem::BlockVector& input_E, mfem::BlockVector& output_E, uint32_t differentiation_index) const
   {
-    output_E = 0.0;
-
     // if this integral actually depends on the specified variable
     if (functional_to_integral_index_.count(differentiation_index) > 0) {
       for (auto& [geometry, func] : jvp_[functional_to_integral_index_.at(differentiation_index)]) {
@@ -102,6 +264,27 @@ struct Integral {
     }
   }
 
+  /**
+   * @brief evaluate the jacobian-vector product of one sample of the last ensemble evaluation
+   * (see `MultEnsemble`) of this integral
+   *
+   * @param input_E a block vector of a specific trial space element values (for that sample only)
+   * @param output_E a block vector of the output values for each element. As with `Mult`, the contributions from this
+   * integral are added to the existing values in `output_E`.
+   * @param differentiation_index the index of the trial space that the ensemble evaluation was differentiated w.r.t.
+   * @param sample which sample of the ensemble to differentiate
+   */
+  void GradientMultEnsemble(const mfem::BlockVector& input_E, mfem::BlockVector& output_E,
+                            uint32_t differentiation_index, uint32_t sample) const
+  {
+    // if this integral actually depends on the specified variable
+    if (functional_to_integral_index_.count(differentiation_index) > 0) {
+      for (auto& [geometry, func] : ensemble_jvp_[functional_to_integral_index_.at(differentiation_index)]) {
+        func(input_E.GetBlock(geometry).Read(), output_E.GetBlock(geometry).ReadWrite(), sample);
+      }
+    }
+  }
+
   /**
    * @brief evaluate the jacobian (with respect to some trial space) of this integral
    *
@@ -132,6 +315,52 @@ struct Integral {
   /// @brief kernels for integral evaluation + derivative w.r.t. specified argument over each type of element
   std::vector<std::map<mfem::Geometry::Type, eval_func> > evaluation_with_AD_;
 
+  /**
+   * @brief kernels for integral evaluation + derivatives w.r.t. all arguments over each type of element
+   *
+   * @note only generated for integrands with more than one argument
+   */
+  std::map<mfem::Geometry::Type, eval_func> evaluation_with_joint_AD_;
+
+  /**
+   * @brief kernels for integral evaluation + derivative along a linear combination of the arguments that share
+   * the trial space of each argument over each type of element
+   *
+   * @note only generated for the first argument of each trial space (see `representative_`)
+   */
+  std::vector<std::map<mfem::Geometry::Type, eval_func> > evaluation_with_combined_AD_;
+
+  /// @brief the coefficient of each argument in the linear combination of the last call to the combined `Mult`
+  std::shared_ptr<std::vector<double> > combination_coefficients_;
+
+  /// @brief the index of the first argument with the same trial space as each argument
+  std::vector<uint32_t> representative_;
+
+  /**
+   * @brief the (`Functional`) index of the trial space whose q-function derivatives hold the linear combination
+   * computed by the last call to the combined `Mult` (`NO_DIFFERENTIATION` if this integral didn't depend on it)
+   */
+  mutable uint32_t combined_index_ = NO_DIFFERENTIATION;
+
+  /// @brief signature of ensemble integral evaluation kernel
+  using ensemble_eval_func =
+      std::function<void(double, const std::vector<const double*>&, const std::vector<uint32_t>&, double*, uint32_t)>;
+
+  /// @brief kernels for integral evaluation of an ensemble of inputs over each type of element
+  std::map<mfem::Geometry::Type, ensemble_eval_func> ensemble_evaluation_;
+
+  /**
+   * @brief kernels for integral evaluation of an ensemble of inputs + the derivative of each sample w.r.t. specified
+   * argument over each type of element
+   */
+  std::vector<std::map<mfem::Geometry::Type, ensemble_eval_func> > ensemble_evaluation_with_AD_;
+
+  /// @brief signature of the element jvp kernel of one sample of an ensemble
+  using ensemble_jacobian_vector_product_func = std::function<void(const double*, double*, uint32_t)>;
+
+  /// @brief kernels for the jacobian-vector product of each sample of the last ensemble evaluation
+  std::vector<std::map<mfem::Geometry::Type, ensemble_jacobian_vector_product_func> > ensemble_jvp_;
+
   /// @brief signature of element jvp kernel
   using jacobian_vector_product_func = std::function<void(const double*, double*)>;
 
@@ -147,6 +376,18 @@ struct Integral {
   /// @brief a list of the trial spaces that take part in this integrand
   std::vector<uint32_t> active_trial_spaces_;
 
+  /// @brief scratch space for the element input pointers passed to the evaluation kernels (avoids allocating per call)
+  mutable std::vector<const double*> inputs_;
+
+  /// @brief scratch space for the number of samples held by each input of the ensemble evaluation kernels
+  mutable std::vector<uint32_t> input_samples_;
+
+  /// @brief scratch space for the discarded outputs of the extra passes of the multiple-derivative `Mult` fallback
+  mutable mfem::Vector scratch_E_;
+
+  /// @brief block offsets of `scratch_E_`, matching those of the element outputs
+  mutable mfem::Array<int> scratch_offsets_;
+
   /**
    * @brief a way of translating between the indices used by `Functional` and `Integral` to refer to the same
    *        trial space.
@@ -200,24 +441,57 @@ void generate_kernels(FunctionSignature<test(trials...)> s, Integral& integral,
   integral.evaluation_[geom] = domain_integral::evaluation_kernel<NO_DIFFERENTIATION, Q, geom>(
       s, qf, positions, jacobians, qdata, dummy_derivatives, elements, num_elements);
 
+  std::shared_ptr<std::vector<zero> > dummy_ensemble_derivatives;
+  integral.ensemble_evaluation_[geom] = domain_integral::ensemble_evaluation_kernel<NO_DIFFERENTIATION, Q, geom>(
+      s, qf, positions, jacobians, qdata, dummy_ensemble_derivatives, elements, num_elements);
+
   constexpr std::size_t                 num_args = s.num_args;
   [[maybe_unused]] static constexpr int dim      = dimension_of(geom);
+
+  // allocate memory for the derivatives of the q-function w.r.t. each argument at each quadrature point
+  //
+  // Note: ptrs' lifetime is managed in an unusual way! They are captured by-value in the
+  // action_of_gradient functors below to augment the reference count, and extend their lifetime to match
+  // that of the DomainIntegral that allocated them.
+  auto qf_derivatives = domain_integral::allocate_qf_derivatives<dim, trials...>(
+      qf, qpt_data_type{}, num_elements * qpts_per_element, std::make_integer_sequence<int, int(num_args)>{});
+
+  if constexpr (num_args > 1 && num_args <= 4 && !std::is_same_v<test, double>) {
+    integral.evaluation_with_joint_AD_[geom] = domain_integral::joint_evaluation_kernel<Q, geom>(
+        s, qf, positions, jacobians, qdata, qf_derivatives, elements, num_elements);
+  }
+
   for_constexpr<num_args>([&](auto index) {
-    // allocate memory for the derivatives of the q-function at each quadrature point
-    //
-    // Note: ptrs' lifetime is managed in an unusual way! It is captured by-value in the
-    // action_of_gradient functor below to augment the reference count, and extend its lifetime to match
-    // that of the DomainIntegral that allocated it.
-    using derivative_type = decltype(domain_integral::get_derivative_type<index, dim, trials...>(qf, qpt_data_type{}));
-    auto ptr = accelerator::make_shared_array<ExecutionSpace::CPU, derivative_type>(num_elements * qpts_per_element);
+    auto ptr = get<index>(qf_derivatives);
 
     integral.evaluation_with_AD_[index][geom] = domain_integral::evaluation_kernel<index, Q, geom>(
         s, qf, positions, jacobians, qdata, ptr, elements, num_elements);
 
+    constexpr uint32_t representative = first_index_of_same_type<index, trials...>();
+    integral.representative_[index]   = representative;
+    if constexpr (representative == index && !std::is_same_v<test, double>) {
+      integral.evaluation_with_combined_AD_[index][geom] =
+          domain_integral::combined_evaluation_kernel<representative, Q, geom>(
+              s, qf, positions, jacobians, qdata, ptr, integral.combination_coefficients_, elements, num_elements);
+    }
+
     integral.jvp_[index][geom] =
         domain_integral::jacobian_vector_product_kernel<index, Q, geom>(s, ptr, elements, num_elements);
     integral.element_gradient_[index][geom] =
         domain_integral::element_gradient_kernel<index, Q, geom>(s, ptr, elements, num_elements);
+
+    // the derivatives of each sample of an ensemble evaluation are stored separately, since
+    // their number (and hence the size of the buffer) is only known when the ensemble is evaluated
+    if constexpr (!std::is_same_v<test, double>) {
+      using derivative_type = typename decltype(ptr)::element_type;
+      auto ensemble_ptr     = std::make_shared<std::vector<derivative_type> >();
+
+      integral.ensemble_evaluation_with_AD_[index][geom] = domain_integral::ensemble_evaluation_kernel<index, Q, geom>(
+          s, qf, positions, jacobians, qdata, ensemble_ptr, elements, num_elements);
+      integral.ensemble_jvp_[index][geom] =
+          domain_integral::ensemble_jacobian_vector_product_kernel<index, Q, geom>(s, ensemble_ptr, elements,
+                                                                                  num_elements);
+    }
   });
 }
 
@@ -289,24 +563,57 @@ void generate_bdr_kernels(FunctionSignature<test(trials...)> s, Integral& integr
   integral.evaluation_[geom] = boundary_integral::evaluation_kernel<NO_DIFFERENTIATION, Q, geom>(
       s, qf, positions, jacobians, dummy_derivatives, elements, num_elements);
 
+  std::shared_ptr<std::vector<zero> > dummy_ensemble_derivatives;
+  integral.ensemble_evaluation_[geom] = boundary_integral::ensemble_evaluation_kernel<NO_DIFFERENTIATION, Q, geom>(
+      s, qf, positions, jacobians, dummy_ensemble_derivatives, elements, num_elements);
+
   constexpr std::size_t                 num_args = s.num_args;
   [[maybe_unused]] static constexpr int dim      = dimension_of(geom);
+
+  // allocate memory for the derivatives of the q-function w.r.t. each argument at each quadrature point
+  //
+  // Note: ptrs' lifetime is managed in an unusual way! They are captured by-value in the
+  // action_of_gradient functors below to augment the reference count, and extend their lifetime to match
+  // that of the boundaryIntegral that allocated them.
+  auto qf_derivatives = boundary_integral::allocate_qf_derivatives<dim, trials...>(
+      qf, num_elements * qpts_per_element, std::make_integer_sequence<int, int(num_args)>{});
+
+  if constexpr (num_args > 1 && num_args <= 4 && !std::is_same_v<test, double>) {
+    integral.evaluation_with_joint_AD_[geom] = boundary_integral::joint_evaluation_kernel<Q, geom>(
+        s, qf, positions, jacobians, qf_derivatives, elements, num_elements);
+  }
+
   for_constexpr<num_args>([&](auto index) {
-    // allocate memory for the derivatives of the q-function at each quadrature point
-    //
-    // Note: ptrs' lifetime is managed in an unusual way! It is captured by-value in the
-    // action_of_gradient functor below to augment the reference count, and extend its lifetime to match
-    // that of the boundaryIntegral that allocated it.
-    using derivative_type = decltype(boundary_integral::get_derivative_type<index, dim, trials...>(qf));
-    auto ptr = accelerator::make_shared_array<ExecutionSpace::CPU, derivative_type>(num_elements * qpts_per_element);
+    auto ptr = get<index>(qf_derivatives);
 
     integral.evaluation_with_AD_[index][geom] =
         boundary_integral::evaluation_kernel<index, Q, geom>(s, qf, positions, jacobians, ptr, elements, num_elements);
 
+    constexpr uint32_t representative = first_index_of_same_type<index, trials...>();
+    integral.representative_[index]   = representative;
+    if constexpr (representative == index && !std::is_same_v<test, double>) {
+      integral.evaluation_with_combined_AD_[index][geom] =
+          boundary_integral::combined_evaluation_kernel<representative, Q, geom>(
+              s, qf, positions, jacobians, ptr, integral.combination_coefficients_, elements, num_elements);
+    }
+
     integral.jvp_[index][geom] =
         boundary_integral::jacobian_vector_product_kernel<index, Q, geom>(s, ptr, elements, num_elements);
     integral.element_gradient_[index][geom] =
         boundary_integral::element_gradient_kernel<index, Q, geom>(s, ptr, elements, num_elements);
+
+    // see generate_kernels
+    if constexpr (!std::is_same_v<test, double>) {
+      using derivative_type = typename decltype(ptr)::element_type;
+      auto ensemble_ptr     = std::make_shared<std::vector<derivative_type> >();
+
+      integral.ensemble_evaluation_with_AD_[index][geom] =
+          boundary_integral::ensemble_evaluation_kernel<index, Q, geom>(s, qf, positions, jacobians, ensemble_ptr,
+                                                                        elements, num_elements);
+      integral.ensemble_jvp_[index][geom] =
+          boundary_integral::ensemble_jacobian_vector_product_kernel<index, Q, geom>(s, ensemble_ptr, elements,
+                                                                                    num_elements);
+    }
   });
 }
 
@@ -12,6 +12,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 #include "mfem.hpp"
 
 #include "axom/core.hpp"
@@ -19,6 +25,7 @@
 #include "serac/serac_config.hpp"
 
 #include "serac/infrastructure/accelerator.hpp"
+#include "serac/infrastructure/logger.hpp"
 
 namespace serac {
 
@@ -100,6 +107,195 @@ public:
 
 namespace serac {
 
+/// @brief how a QuadratureData buffer stores the values at each quadrature point
+enum class QuadratureDataStorage
+{
+  Dense,  ///< every quadrature point has its own copy of the data
+  Sparse  ///< quadrature points share a single default value until they are modified
+};
+
+/**
+ * @brief quadrature point data for elements of a single geometry, where elements whose
+ * quadrature points all have the default value share a single copy of that value.
+ *
+ * Storage for an element's quadrature points is allocated the first time one of them is
+ * assigned a value that differs from the default. This is intended for internal variables that
+ * only change in a small part of the mesh (e.g. plastic deformation, damage).
+ *
+ * Each element's storage is only ever touched when that element is processed, so separate
+ * elements may be read and written concurrently without any synchronization.
+ *
+ * @tparam T the data type to be stored at each quadrature point
+ */
+template <typename T>
+class SparseQuadratureArray {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "sparse quadrature data compares values bitwise, so the data type must be trivially copyable");
+
+public:
+  /**
+   * @brief create a sparse array where every quadrature point has the default value
+   *
+   * @param num_elements how many elements have data in this array
+   * @param qpts_per_element how many quadrature points are in each element
+   * @param value the default value
+   */
+  SparseQuadratureArray(uint32_t num_elements, uint32_t qpts_per_element, const T& value)
+      : qpts_per_element_(qpts_per_element), default_value_(value), blocks_(num_elements)
+  {
+  }
+
+  /// @brief create a deep copy of another sparse array, duplicating the storage of its materialized elements
+  SparseQuadratureArray(const SparseQuadratureArray& other)
+      : qpts_per_element_(other.qpts_per_element_), default_value_(other.default_value_), blocks_(other.blocks_.size())
+  {
+    copy_blocks(other);
+  }
+
+  /// @brief make this array a deep copy of another sparse array
+  SparseQuadratureArray& operator=(const SparseQuadratureArray& other)
+  {
+    if (this != &other) {
+      if (qpts_per_element_ != other.qpts_per_element_) {
+        blocks_.clear();  // existing storage has the wrong size
+      }
+      qpts_per_element_ = other.qpts_per_element_;
+      default_value_    = other.default_value_;
+      blocks_.resize(other.blocks_.size());
+      copy_blocks(other);
+    }
+    return *this;
+  }
+
+  /// @brief move constructor
+  SparseQuadratureArray(SparseQuadratureArray&&) = default;
+
+  /// @brief move assignment
+  SparseQuadratureArray& operator=(SparseQuadratureArray&&) = default;
+
+  /// @brief return the value at quadrature point q of element e
+  const T& operator()(uint32_t e, uint32_t q) const { return blocks_[e] ? blocks_[e][q] : default_value_; }
+
+  /**
+   * @brief assign a value to quadrature point q of element e
+   *
+   * @note assigning the default value to an element that has no storage of its own is a no-op
+   */
+  void store(uint32_t e, uint32_t q, const T& value)
+  {
+    if (!blocks_[e]) {
+      if (std::memcmp(&value, &default_value_, sizeof(T)) == 0) {
+        return;
+      }
+      blocks_[e] = std::make_unique<T[]>(qpts_per_element_);
+      std::fill_n(blocks_[e].get(), qpts_per_element_, default_value_);
+    }
+    blocks_[e][q] = value;
+  }
+
+  /// @brief the number of elements in this array
+  uint32_t num_elements() const { return uint32_t(blocks_.size()); }
+
+  /// @brief the number of quadrature points in each element
+  uint32_t qpts_per_element() const { return qpts_per_element_; }
+
+  /// @brief the number of elements that have their own storage
+  uint32_t num_materialized_elements() const
+  {
+    return uint32_t(std::count_if(blocks_.begin(), blocks_.end(), [](auto& block) { return block != nullptr; }));
+  }
+
+  /// @brief the (approximate) number of bytes used by this array
+  std::size_t memory_footprint() const
+  {
+    return sizeof(*this) + blocks_.size() * sizeof(std::unique_ptr<T[]>) +
+           num_materialized_elements() * qpts_per_element_ * sizeof(T);
+  }
+
+private:
+  /**
+   * @brief copy the values of every element from `other` (which must have as many elements as this array),
+   * reusing this array's storage where both arrays have materialized an element
+   */
+  void copy_blocks(const SparseQuadratureArray& other)
+  {
+    for (std::size_t e = 0; e < blocks_.size(); e++) {
+      if (!other.blocks_[e]) {
+        blocks_[e].reset();
+        continue;
+      }
+      if (!blocks_[e]) {
+        blocks_[e] = std::make_unique<T[]>(qpts_per_element_);
+      }
+      std::copy_n(other.blocks_[e].get(), qpts_per_element_, blocks_[e].get());
+    }
+  }
+
+  /// @brief the number of quadrature points in each element
+  uint32_t qpts_per_element_;
+
+  /// @brief the value of every quadrature point in elements without their own storage
+  T default_value_;
+
+  /// @brief the storage for each element's quadrature points (or nullptr, if they all have the default value)
+  std::vector<std::unique_ptr<T[]> > blocks_;
+};
+
+/**
+ * @brief non-owning access to the quadrature point data for elements of a single geometry,
+ * regardless of whether that data is stored densely or sparsely
+ *
+ * @tparam T the data type stored at each quadrature point
+ */
+template <typename T>
+class QuadratureDataView {
+public:
+  /// @brief create a view of densely stored data
+  QuadratureDataView(axom::ArrayView<T, 2> dense) : dense_(dense.data()), stride_(uint32_t(dense.shape()[1])) {}
+
+  /// @brief create a view of sparsely stored data
+  QuadratureDataView(SparseQuadratureArray<T>& sparse) : sparse_(&sparse), stride_(sparse.qpts_per_element()) {}
+
+  /// @brief return the value at quadrature point q of element e
+  const T& operator()(uint32_t e, uint32_t q) const { return sparse_ ? (*sparse_)(e, q) : dense_[e * stride_ + q]; }
+
+  /// @brief assign a value to quadrature point q of element e
+  void store(uint32_t e, uint32_t q, const T& value)
+  {
+    if (sparse_) {
+      sparse_->store(e, q, value);
+    } else {
+      dense_[e * stride_ + q] = value;
+    }
+  }
+
+  /// @brief the number of quadrature points in each element
+  uint32_t qpts_per_element() const { return stride_; }
+
+private:
+  T*                        dense_  = nullptr;  ///< densely stored data, or nullptr
+  SparseQuadratureArray<T>* sparse_ = nullptr;  ///< sparsely stored data, or nullptr
+  uint32_t                  stride_;            ///< the number of quadrature points in each element
+};
+
+/// @cond
+template <>
+class QuadratureDataView<Nothing> {
+public:
+  const Nothing& operator()(uint32_t, uint32_t) const { return data; }
+  void           store(uint32_t, uint32_t, const Nothing&) {}
+  Nothing        data;
+};
+
+template <>
+class QuadratureDataView<Empty> {
+public:
+  const Empty& operator()(uint32_t, uint32_t) const { return data; }
+  void         store(uint32_t, uint32_t, const Empty&) {}
+  Empty        data;
+};
+/// @endcond
+
 /**
  * @brief A class for storing and access user-defined types at quadrature points
  *
@@ -119,16 +315,29 @@ struct QuadratureData {
    * @param elements the number of elements of each geometry
    * @param qpts_per_element how many quadrature points are present in each kind of element
    * @param value (optional) value used to initialize the buffer
+   * @param storage_type (optional) whether every quadrature point gets its own storage up front (Dense),
+   *        or only when it is first assigned a value other than `value` (Sparse)
    */
-  QuadratureData(geom_array_t elements, geom_array_t qpts_per_element, T value = T{})
+  QuadratureData(geom_array_t elements, geom_array_t qpts_per_element, T value = T{},
+                 QuadratureDataStorage storage_type = QuadratureDataStorage::Dense)
+      : storage(storage_type)
   {
     constexpr std::array geometries = {mfem::Geometry::SEGMENT, mfem::Geometry::TRIANGLE, mfem::Geometry::SQUARE,
                                        mfem::Geometry::TETRAHEDRON, mfem::Geometry::CUBE};
 
     for (auto geom : geometries) {
       if (elements[uint32_t(geom)] > 0) {
-        data[geom] = axom::Array<T, 2>(elements[uint32_t(geom)], qpts_per_element[uint32_t(geom)]);
-        data[geom].fill(value);
+        if (storage == QuadratureDataStorage::Sparse) {
+          if constexpr (std::is_trivially_copyable_v<T>) {
+            sparse_data.emplace(geom, SparseQuadratureArray<T>(elements[uint32_t(geom)],
+                                                               qpts_per_element[uint32_t(geom)], value));
+          } else {
+            SLIC_ERROR("sparse quadrature data requires a trivially copyable data type");
+          }
+        } else {
+          data[geom] = axom::Array<T, 2>(elements[uint32_t(geom)], qpts_per_element[uint32_t(geom)]);
+          data[geom].fill(value);
+        }
       }
     }
   }
@@ -136,11 +345,78 @@ struct QuadratureData {
   /**
    * @brief return the 2D array of quadrature point values for elements of the specified geometry
    * @param geom which element geometry's data to return
+   *
+   * @note only available for densely stored data, see view()
+   */
+  axom::ArrayView<T, 2> operator[](mfem::Geometry::Type geom)
+  {
+    SLIC_ERROR_IF(storage == QuadratureDataStorage::Sparse, "sparse quadrature data must be accessed through view()");
+    return axom::ArrayView<T, 2>(data.at(geom));
+  }
+
+  /**
+   * @brief return a view of the quadrature point values for elements of the specified geometry
+   * @param geom which element geometry's data to return
    */
-  axom::ArrayView<T, 2> operator[](mfem::Geometry::Type geom) { return axom::ArrayView<T, 2>(data.at(geom)); }
+  QuadratureDataView<T> view(mfem::Geometry::Type geom)
+  {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if (storage == QuadratureDataStorage::Sparse) {
+        return QuadratureDataView<T>(sparse_data.at(geom));
+      }
+    }
+    return QuadratureDataView<T>(axom::ArrayView<T, 2>(data.at(geom)));
+  }
+
+  /**
+   * @brief overwrite the quadrature point values of this buffer with those of `other`, e.g. to save or restore
+   * material state when a timestep is repeated
+   *
+   * @param other a buffer with the same storage type and number of elements / quadrature points of each geometry
+   *
+   * @note unlike copy assignment, the existing storage of this buffer is reused wherever possible
+   */
+  void copy_from(const QuadratureData& other)
+  {
+    SLIC_ERROR_IF(storage != other.storage, "quadrature data buffers must have the same storage type");
+
+    for (auto& [geom, values] : other.data) {
+      auto& target = data.at(geom);
+      SLIC_ERROR_IF(target.size() != values.size(), "quadrature data buffers must have the same size");
+      std::copy_n(values.data(), values.size(), target.data());
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      for (auto& [geom, values] : other.sparse_data) {
+        sparse_data.at(geom) = values;
+      }
+    }
+  }
+
+  /// @brief the (approximate) number of bytes used to store the quadrature point values
+  std::size_t memory_footprint() const
+  {
+    std::size_t total = 0;
+    for (auto& [geom, values] : data) {
+      total += std::size_t(values.size()) * sizeof(T);
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      for (auto& [geom, values] : sparse_data) {
+        total += values.memory_footprint();
+      }
+    }
+    return total;
+  }
+
+  /// @brief how the quadrature point values are stored
+  QuadratureDataStorage storage;
 
   /// @brief a 3D array indexed by (which geometry, which element, which quadrature point)
   std::map<mfem::Geometry::Type, axom::Array<T, 2> > data;
+
+  /// @brief the sparsely stored values for each geometry, when `storage == QuadratureDataStorage::Sparse`
+  std::map<mfem::Geometry::Type, std::conditional_t<std::is_trivially_copyable_v<T>, SparseQuadratureArray<T>, Empty> >
+      sparse_data;
 };
 
 /// @cond
@@ -152,6 +428,10 @@ struct QuadratureData<Nothing> {
 
   axom::ArrayView<Nothing, 2> operator[](mfem::Geometry::Type) { return axom::ArrayView<Nothing, 2>(data); }
 
+  QuadratureDataView<Nothing> view(mfem::Geometry::Type) { return {}; }
+
+  void copy_from(const QuadratureData&) {}
+
   axom::Array<Nothing, 2, axom::MemorySpace::Dynamic> data;
 };
 
@@ -163,6 +443,10 @@ struct QuadratureData<Empty> {
 
   axom::ArrayView<Empty, 2> operator[](mfem::Geometry::Type) { return axom::ArrayView<Empty, 2>(data); }
 
+  QuadratureDataView<Empty> view(mfem::Geometry::Type) { return {}; }
+
+  void copy_from(const QuadratureData&) {}
+
   axom::Array<Empty, 2, axom::MemorySpace::Dynamic> data;
 };
 /// @endcond
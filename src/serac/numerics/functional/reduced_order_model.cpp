@@ -0,0 +1,441 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/functional/reduced_order_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace serac {
+
+namespace {
+
+/**
+ * @brief eigendecomposition of a small symmetric matrix with cyclic Jacobi rotations
+ *
+ * The snapshot correlation matrices here are (number of snapshots) x (number of snapshots),
+ * so this avoids a dependency on LAPACK-enabled mfem builds.
+ *
+ * @param A (input: symmetric matrix, overwritten)
+ * @param eigenvalues the eigenvalues, in descending order
+ * @param eigenvectors the corresponding eigenvectors, stored as columns
+ */
+void symmetricEigensystem(mfem::DenseMatrix& A, mfem::Vector& eigenvalues, mfem::DenseMatrix& eigenvectors)
+{
+  int               n = A.Height();
+  mfem::DenseMatrix V(n);
+  V = 0.0;
+  for (int i = 0; i < n; i++) {
+    V(i, i) = 1.0;
+  }
+
+  constexpr int max_sweeps = 100;
+  for (int sweep = 0; sweep < max_sweeps; sweep++) {
+    double off_diagonal = 0.0;
+    double diagonal     = 0.0;
+    for (int i = 0; i < n; i++) {
+      diagonal += A(i, i) * A(i, i);
+      for (int j = i + 1; j < n; j++) {
+        off_diagonal += A(i, j) * A(i, j);
+      }
+    }
+    if (off_diagonal <= 1.0e-30 * diagonal) {
+      break;
+    }
+
+    for (int p = 0; p < n; p++) {
+      for (int q = p + 1; q < n; q++) {
+        if (A(p, q) == 0.0) continue;
+
+        double theta = (A(q, q) - A(p, p)) / (2.0 * A(p, q));
+        double t     = std::copysign(1.0, theta) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        double c     = 1.0 / std::sqrt(t * t + 1.0);
+        double s     = t * c;
+
+        for (int k = 0; k < n; k++) {
+          double Akp = A(k, p);
+          double Akq = A(k, q);
+          A(k, p)    = c * Akp - s * Akq;
+          A(k, q)    = s * Akp + c * Akq;
+        }
+        for (int k = 0; k < n; k++) {
+          double Apk = A(p, k);
+          double Aqk = A(q, k);
+          A(p, k)    = c * Apk - s * Aqk;
+          A(q, k)    = s * Apk + c * Aqk;
+        }
+        for (int k = 0; k < n; k++) {
+          double Vkp = V(k, p);
+          double Vkq = V(k, q);
+          V(k, p)    = c * Vkp - s * Vkq;
+          V(k, q)    = s * Vkp + c * Vkq;
+        }
+      }
+    }
+  }
+
+  std::vector<int> order(std::size_t(n));
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](int i, int j) { return A(i, i) > A(j, j); });
+
+  eigenvalues.SetSize(n);
+  eigenvectors.SetSize(n);
+  for (int j = 0; j < n; j++) {
+    eigenvalues[j] = A(order[std::size_t(j)], order[std::size_t(j)]);
+    for (int i = 0; i < n; i++) {
+      eigenvectors(i, j) = V(i, order[std::size_t(j)]);
+    }
+  }
+}
+
+/// @brief solve the unconstrained least squares problem min ||A_P z_P - b|| over the columns in P
+mfem::Vector passiveSetLeastSquares(const mfem::DenseMatrix& A, const mfem::Vector& b, const std::vector<int>& P)
+{
+  int               m = A.Height();
+  int               p = int(P.size());
+  mfem::DenseMatrix AtA(p);
+  mfem::Vector      Atb(p);
+  for (int i = 0; i < p; i++) {
+    const double* ai = A.GetColumn(P[std::size_t(i)]);
+    Atb[i]           = std::inner_product(ai, ai + m, b.GetData(), 0.0);
+    for (int j = i; j < p; j++) {
+      const double* aj = A.GetColumn(P[std::size_t(j)]);
+      AtA(i, j) = AtA(j, i) = std::inner_product(ai, ai + m, aj, 0.0);
+    }
+  }
+
+  mfem::Vector             z(p);
+  mfem::DenseMatrixInverse AtA_inv(AtA);
+  AtA_inv.Mult(Atb, z);
+  return z;
+}
+
+}  // namespace
+
+ReducedBasis::ReducedBasis(std::vector<mfem::Vector> modes, MPI_Comm comm) : modes_(std::move(modes)), comm_(comm)
+{
+  for (auto& mode : modes_) {
+    SLIC_ERROR_IF(mode.Size() != modes_[0].Size(), "all modes must have the same size");
+  }
+}
+
+void ReducedBasis::expand(const mfem::Vector& q, mfem::Vector& u) const
+{
+  SLIC_ERROR_IF(q.Size() != size(), "reduced coordinates must have one entry per mode");
+  u.SetSize(modes_.empty() ? 0 : modes_[0].Size());
+  u = 0.0;
+  for (int k = 0; k < size(); k++) {
+    u.Add(q[k], modes_[std::size_t(k)]);
+  }
+}
+
+void ReducedBasis::project(const mfem::Vector& r, mfem::Vector& q) const
+{
+  // compute the local contributions first, so that only one reduction is needed
+  q.SetSize(size());
+  for (int k = 0; k < size(); k++) {
+    q[k] = mfem::InnerProduct(modes_[std::size_t(k)], r);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, q.GetData(), size(), MPI_DOUBLE, MPI_SUM, comm_);
+}
+
+mfem::DenseMatrix ReducedBasis::project(const mfem::Operator& J) const
+{
+  mfem::DenseMatrix J_reduced(size());
+  mfem::Vector      J_mode(J.Height());
+  mfem::Vector      column;
+  for (int j = 0; j < size(); j++) {
+    J.Mult(modes_[std::size_t(j)], J_mode);
+    project(J_mode, column);
+    J_reduced.SetCol(j, column);
+  }
+  return J_reduced;
+}
+
+double ReducedBasis::projectionError(const mfem::Vector& u) const
+{
+  mfem::Vector q;
+  mfem::Vector u_projected;
+  project(u, q);
+  expand(q, u_projected);
+  u_projected -= u;
+
+  double norms[2] = {mfem::InnerProduct(u_projected, u_projected), mfem::InnerProduct(u, u)};
+  MPI_Allreduce(MPI_IN_PLACE, norms, 2, MPI_DOUBLE, MPI_SUM, comm_);
+  return (norms[1] > 0.0) ? std::sqrt(norms[0] / norms[1]) : 0.0;
+}
+
+ReducedBasis properOrthogonalDecomposition(const std::vector<mfem::Vector>& snapshots, MPI_Comm comm,
+                                           double energy_tolerance, int max_modes)
+{
+  SLIC_ERROR_IF(snapshots.empty(), "properOrthogonalDecomposition requires at least one snapshot");
+
+  // method of snapshots: the left singular vectors of S = [s_0, s_1, ...] are S V / sigma,
+  // where (V, sigma^2) are the eigenpairs of the (small) correlation matrix C = S^T S
+  int               n = int(snapshots.size());
+  mfem::DenseMatrix C(n);
+  for (int i = 0; i < n; i++) {
+    for (int j = i; j < n; j++) {
+      C(i, j) = C(j, i) = mfem::InnerProduct(snapshots[std::size_t(i)], snapshots[std::size_t(j)]);
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, C.GetData(), n * n, MPI_DOUBLE, MPI_SUM, comm);
+
+  mfem::Vector      eigenvalues;
+  mfem::DenseMatrix eigenvectors;
+  symmetricEigensystem(C, eigenvalues, eigenvectors);
+
+  double total_energy = 0.0;
+  for (int i = 0; i < n; i++) {
+    total_energy += std::max(eigenvalues[i], 0.0);
+  }
+
+  // keep the fewest modes whose discarded energy is within tolerance
+  int    num_modes        = 0;
+  double discarded_energy = total_energy;
+  while (num_modes < n && discarded_energy > energy_tolerance * total_energy) {
+    if (eigenvalues[num_modes] <= 0.0) break;
+    discarded_energy -= eigenvalues[num_modes];
+    num_modes++;
+  }
+  if (max_modes >= 0) {
+    num_modes = std::min(num_modes, max_modes);
+  }
+
+  std::vector<mfem::Vector> modes(std::size_t(num_modes));
+  for (int k = 0; k < num_modes; k++) {
+    auto& mode = modes[std::size_t(k)];
+    mode.SetSize(snapshots[0].Size());
+    mode = 0.0;
+    for (int i = 0; i < n; i++) {
+      mode.Add(eigenvectors(i, k), snapshots[std::size_t(i)]);
+    }
+
+    // the correlation matrix squares the condition number of S, so one pass of
+    // (modified) Gram-Schmidt is used to restore orthogonality of the trailing modes
+    for (int j = 0; j < k; j++) {
+      double overlap = mfem::InnerProduct(comm, modes[std::size_t(j)], mode);
+      mode.Add(-overlap, modes[std::size_t(j)]);
+    }
+    mode /= std::sqrt(mfem::InnerProduct(comm, mode, mode));
+  }
+
+  return ReducedBasis(std::move(modes), comm);
+}
+
+mfem::Vector nonnegativeLeastSquares(const mfem::DenseMatrix& A, const mfem::Vector& b, double relative_tolerance,
+                                     int max_iterations)
+{
+  int m = A.Height();
+  int n = A.Width();
+  SLIC_ERROR_IF(b.Size() != m, "incompatible dimensions in nonnegativeLeastSquares");
+
+  if (max_iterations < 0) {
+    max_iterations = n;
+  }
+
+  mfem::Vector      x(n);
+  mfem::Vector      residual(m);
+  mfem::Vector      w(n);
+  std::vector<bool> passive(std::size_t(n), false);
+  std::vector<int>  P;
+  x = 0.0;
+
+  auto update_residual = [&]() {
+    A.Mult(x, residual);
+    subtract(b, residual, residual);
+    A.MultTranspose(residual, w);
+  };
+
+  double target = relative_tolerance * b.Norml2();
+  update_residual();
+
+  for (int iteration = 0; iteration < max_iterations && residual.Norml2() > target; iteration++) {
+    // add the column most correlated with the residual to the passive set
+    int    j_max = -1;
+    double w_max = 0.0;
+    for (int j = 0; j < n; j++) {
+      if (!passive[std::size_t(j)] && w[j] > w_max) {
+        j_max = j;
+        w_max = w[j];
+      }
+    }
+    if (j_max == -1) break;
+
+    passive[std::size_t(j_max)] = true;
+    P.push_back(j_max);
+
+    // solve the unconstrained problem on the passive set, stepping back toward
+    // the feasible region (and dropping columns) until the solution is positive
+    while (true) {
+      mfem::Vector z = passiveSetLeastSquares(A, b, P);
+
+      double alpha = 1.0;
+      for (std::size_t i = 0; i < P.size(); i++) {
+        double xi = x[P[i]];
+        if (z[int(i)] <= 0.0 && xi > z[int(i)]) {
+          alpha = std::min(alpha, xi / (xi - z[int(i)]));
+        }
+      }
+
+      for (std::size_t i = 0; i < P.size(); i++) {
+        x[P[i]] += alpha * (z[int(i)] - x[P[i]]);
+      }
+
+      if (alpha == 1.0) break;
+
+      std::vector<int> still_passive;
+      for (int j : P) {
+        if (x[j] <= 1.0e-15 * w_max) {
+          x[j]                    = 0.0;
+          passive[std::size_t(j)] = false;
+        } else {
+          still_passive.push_back(j);
+        }
+      }
+      P = still_passive;
+      if (P.empty()) break;
+    }
+
+    update_residual();
+  }
+
+  return x;
+}
+
+ElementSampling energyConservingSampling(
+    const mfem::Mesh& mesh, const std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>>& projections,
+    const std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>>& boundary_projections, MPI_Comm comm,
+    double tolerance)
+{
+  SLIC_ERROR_IF(projections.empty(), "energyConservingSampling requires at least one training snapshot");
+  SLIC_ERROR_IF(!boundary_projections.empty() && boundary_projections.size() != projections.size(),
+                "the element and boundary element projections must come from the same training snapshots");
+
+  // the element and boundary element projections are treated alike, as two lists of candidate columns
+  std::vector<const std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>>*> candidates = {&projections};
+  if (!boundary_projections.empty()) {
+    candidates.push_back(&boundary_projections);
+  }
+
+  // the columns of the local part of the ECSW matrix, ordered by kind, then geometry and then element.
+  // The number of rows is the same on every rank, but ranks without elements can't tell what it is.
+  int rows       = 0;
+  int local_cols = 0;
+  for (auto* kind : candidates) {
+    for (auto& [geom, matrix] : (*kind)[0]) {
+      local_cols += matrix.Width();
+    }
+  }
+  for (auto& snapshot : projections) {
+    rows += snapshot.empty() ? 0 : snapshot.begin()->second.Height();
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &rows, 1, MPI_INT, MPI_MAX, comm);
+
+  std::vector<double> local_columns(std::size_t(rows * local_cols));
+  {
+    int col = 0;
+    for (auto* kind : candidates) {
+      for (auto& [geom, matrix] : (*kind)[0]) {
+        for (int e = 0; e < matrix.Width(); e++, col++) {
+          int row = 0;
+          for (auto& snapshot : *kind) {
+            const mfem::DenseMatrix& P = snapshot.at(geom);
+            for (int k = 0; k < P.Height(); k++, row++) {
+              local_columns[std::size_t(col * rows + row)] = P(k, e);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // every rank assembles (and solves) the global problem, which is small in the
+  // number of rows, so that the weights don't have to be communicated afterward
+  int num_ranks, rank;
+  MPI_Comm_size(comm, &num_ranks);
+  MPI_Comm_rank(comm, &rank);
+
+  std::vector<int> counts(std::size_t(num_ranks));
+  std::vector<int> displacements(std::size_t(num_ranks), 0);
+  int              local_count = rows * local_cols;
+  MPI_Allgather(&local_count, 1, MPI_INT, counts.data(), 1, MPI_INT, comm);
+  std::partial_sum(counts.begin(), counts.end() - 1, displacements.begin() + 1);
+
+  int               global_cols = (displacements.back() + counts.back()) / std::max(rows, 1);
+  mfem::DenseMatrix A(rows, global_cols);
+  MPI_Allgatherv(local_columns.data(), local_count, MPI_DOUBLE, A.GetData(), counts.data(), displacements.data(),
+                 MPI_DOUBLE, comm);
+
+  // with unit weights, the sampled sum reproduces the projected residuals exactly
+  mfem::Vector b(rows);
+  mfem::Vector ones(global_cols);
+  ones = 1.0;
+  A.Mult(ones, b);
+
+  mfem::Vector weights = nonnegativeLeastSquares(A, b, tolerance);
+
+  std::map<mfem::Geometry::Type, std::vector<int>>    sampled_elements[2];
+  std::map<mfem::Geometry::Type, std::vector<double>> sampled_weights[2];
+  int                                                 col = displacements[std::size_t(rank)] / std::max(rows, 1);
+  for (std::size_t kind = 0; kind < candidates.size(); kind++) {
+    for (auto& [geom, matrix] : (*candidates[kind])[0]) {
+      auto& ids = sampled_elements[kind][geom];
+      auto& w   = sampled_weights[kind][geom];
+      for (int e = 0; e < matrix.Width(); e++, col++) {
+        if (weights[col] > 0.0) {
+          ids.push_back(e);
+          w.push_back(weights[col]);
+        }
+      }
+    }
+  }
+
+  return ElementSampling{Domain::ofElementsByIndex(mesh, sampled_elements[0]), std::move(sampled_weights[0]),
+                         Domain::ofBoundaryElementsByIndex(mesh, sampled_elements[1]), std::move(sampled_weights[1])};
+}
+
+ElementSampling energyConservingSampling(
+    const mfem::Mesh& mesh, const std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>>& projections,
+    MPI_Comm comm, double tolerance)
+{
+  return energyConservingSampling(mesh, projections, {}, comm, tolerance);
+}
+
+ReducedOrderError fullOrderError(const ReducedBasis& basis, const mfem::Vector& offset, const mfem::Vector& q,
+                                 const mfem::Vector& u_full, int print_level)
+{
+  mfem::Vector u_reduced;
+  basis.expand(q, u_reduced);
+  u_reduced += offset;
+  u_reduced -= u_full;
+
+  // the best approximation of u_full in the affine space u_0 + span(Phi)
+  mfem::Vector du(u_full);
+  mfem::Vector q_best;
+  mfem::Vector u_best;
+  du -= offset;
+  basis.project(du, q_best);
+  basis.expand(q_best, u_best);
+  u_best -= du;
+
+  double norms[3] = {mfem::InnerProduct(u_reduced, u_reduced), mfem::InnerProduct(u_best, u_best),
+                     mfem::InnerProduct(u_full, u_full)};
+  MPI_Allreduce(MPI_IN_PLACE, norms, 3, MPI_DOUBLE, MPI_SUM, basis.comm());
+
+  double            scale = (norms[2] > 0.0) ? 1.0 / std::sqrt(norms[2]) : 1.0;
+  ReducedOrderError error{std::sqrt(norms[0]) * scale, std::sqrt(norms[1]) * scale};
+
+  if (print_level > 0) {
+    SLIC_INFO_ROOT(axom::fmt::format("reduced order model: relative error {:.6e} (projection error {:.6e})",
+                                     error.solution_error, error.projection_error));
+  }
+
+  return error;
+}
+
+}  // namespace serac
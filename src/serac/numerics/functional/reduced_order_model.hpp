@@ -0,0 +1,270 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file reduced_order_model.hpp
+ *
+ * @brief Tools for building hyper-reduced models (POD + ECSW) on top of `Functional`
+ *
+ * Offline:
+ *   1. collect solution snapshots from the full model (e.g. with collectSnapshots(), see reduced_order_snapshots.hpp)
+ *   2. compress them into a ReducedBasis with properOrthogonalDecomposition()
+ *   3. evaluate the full residual at each snapshot, and record the projected contribution of each element
+ *      and boundary element with Functional::elementResidualProjections()
+ *   4. select a weighted subset of the elements and boundary elements with energyConservingSampling()
+ *
+ * Online:
+ *   1. build a Functional whose domain integrals only cover `sampling.domain` and whose boundary integrals only
+ *      cover `sampling.boundary_domain`, call `setElementWeights()` with each of them, and `setReducedBasis()`
+ *   2. solve the reduced equations with solveReducedNewton()
+ *   3. compare with the full model where it is available, with fullOrderError()
+ */
+
+#pragma once
+
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+#include "serac/numerics/functional/domain.hpp"
+
+namespace serac {
+
+/// @brief a basis for a subspace of the T-vectors of a finite element space, whose modes are (globally) orthonormal
+class ReducedBasis {
+public:
+  /**
+   * @brief create a basis from a list of orthonormal modes
+   *
+   * @param modes the T-vectors of each mode (distributed, like any other T-vector)
+   * @param comm the communicator the T-vectors are distributed over
+   */
+  ReducedBasis(std::vector<mfem::Vector> modes, MPI_Comm comm);
+
+  /// @brief the number of modes in the basis
+  int size() const { return int(modes_.size()); }
+
+  /// @brief the T-vector of each mode
+  const std::vector<mfem::Vector>& modes() const { return modes_; }
+
+  /// @brief the communicator the T-vectors are distributed over
+  MPI_Comm comm() const { return comm_; }
+
+  /// @brief compute u = Phi * q, the T-vector with reduced coordinates q
+  void expand(const mfem::Vector& q, mfem::Vector& u) const;
+
+  /// @brief compute q = Phi^T * r, the projection of a residual onto the basis
+  void project(const mfem::Vector& r, mfem::Vector& q) const;
+
+  /// @brief compute Phi^T * J * Phi, the projection of a Jacobian onto the basis (using `size()` actions of J)
+  mfem::DenseMatrix project(const mfem::Operator& J) const;
+
+  /**
+   * @brief the relative error of the best approximation to u in the span of the basis, ||u - Phi Phi^T u|| / ||u||
+   *
+   * This is a lower bound on the error of any reduced solution, and is a useful estimate of whether
+   * the basis is rich enough to represent a given full-model solution.
+   */
+  double projectionError(const mfem::Vector& u) const;
+
+private:
+  /// @brief the T-vector of each mode
+  std::vector<mfem::Vector> modes_;
+
+  /// @brief the communicator the T-vectors are distributed over
+  MPI_Comm comm_;
+};
+
+/**
+ * @brief compute a proper orthogonal decomposition (POD) basis for a set of snapshots, with the method of snapshots
+ *
+ * @param snapshots the T-vectors of each snapshot
+ * @param comm the communicator the T-vectors are distributed over
+ * @param energy_tolerance the fraction of the snapshots' energy (sum of squared singular values) that may be discarded
+ * @param max_modes (optional) an upper limit on the number of modes
+ * @return the leading left singular vectors of the snapshot matrix
+ */
+ReducedBasis properOrthogonalDecomposition(const std::vector<mfem::Vector>& snapshots, MPI_Comm comm,
+                                           double energy_tolerance = 1.0e-8, int max_modes = -1);
+
+/**
+ * @brief solve min ||A x - b|| subject to x >= 0, with the Lawson-Hanson active set method
+ *
+ * @param A the matrix
+ * @param b the right hand side
+ * @param relative_tolerance the iteration stops once ||A x - b|| <= relative_tolerance * ||b||
+ * @param max_iterations (optional) an upper limit on the number of outer iterations, defaults to the number of columns
+ * @return the (sparse) nonnegative solution
+ */
+mfem::Vector nonnegativeLeastSquares(const mfem::DenseMatrix& A, const mfem::Vector& b, double relative_tolerance,
+                                     int max_iterations = -1);
+
+/// @brief a weighted subset of the elements (and boundary elements) of a mesh, used to approximate sums over them
+struct ElementSampling {
+  /// @brief the sampled elements
+  Domain domain;
+
+  /// @brief for each geometry, the weight of each element in `domain.get(geom)`
+  std::map<mfem::Geometry::Type, std::vector<double>> weights;
+
+  /// @brief the sampled boundary elements
+  Domain boundary_domain;
+
+  /// @brief for each geometry, the weight of each boundary element in `boundary_domain.get(geom)`
+  std::map<mfem::Geometry::Type, std::vector<double>> boundary_weights;
+};
+
+/**
+ * @brief select a weighted subset of the elements and boundary elements with energy-conserving sampling and
+ * weighting (ECSW)
+ *
+ * The weights are the (sparse) nonnegative least squares solution that reproduces the projected
+ * residual of each training snapshot from the projected contributions of the sampled elements
+ * and boundary elements, which are selected together.
+ *
+ * @param mesh the mesh
+ * @param projections for each training snapshot, the projected contribution of each element to the residual
+ *        (see Functional::elementResidualProjections)
+ * @param boundary_projections for each training snapshot, the projected contribution of each boundary element
+ *        to the residual (empty, if the residual has no boundary integrals)
+ * @param comm the communicator the mesh is distributed over
+ * @param tolerance the relative error allowed when reproducing the training residuals
+ * @return the elements and boundary elements (on this rank) with nonzero weights
+ */
+ElementSampling energyConservingSampling(
+    const mfem::Mesh& mesh, const std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>>& projections,
+    const std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>>& boundary_projections, MPI_Comm comm,
+    double tolerance);
+
+/**
+ * @overload
+ *
+ * for residuals without boundary integrals, in which case `boundary_domain` is empty
+ */
+ElementSampling energyConservingSampling(
+    const mfem::Mesh& mesh, const std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>>& projections,
+    MPI_Comm comm, double tolerance);
+
+namespace detail {
+
+/// @brief whether a jacobian can compute its own projection onto a reduced basis, see Functional::setReducedBasis()
+template <typename T, typename = void>
+struct has_reduced_matrix : std::false_type {
+};
+
+/// @overload
+template <typename T>
+struct has_reduced_matrix<T, std::void_t<decltype(std::declval<T&>().reducedMatrix())>> : std::true_type {
+};
+
+}  // namespace detail
+
+/**
+ * @brief compute the reduced jacobian Phi^T J Phi
+ *
+ * The gradients of a Functional project their element matrices directly (so only the sampled elements
+ * of a hyper-reduced Functional are visited), which requires calling `setReducedBasis(basis.modes())` on
+ * that Functional beforehand. Any other operator is projected with `basis.size()` actions of J.
+ *
+ * @param basis the reduced basis
+ * @param J the jacobian
+ */
+template <typename jacobian_type>
+mfem::DenseMatrix reducedJacobian(const ReducedBasis& basis, jacobian_type& J)
+{
+  if constexpr (detail::has_reduced_matrix<jacobian_type>::value) {
+    mfem::DenseMatrix J_reduced = J.reducedMatrix();
+    SLIC_ERROR_IF(J_reduced.Height() != basis.size(), "the Functional's reduced basis differs from the given basis");
+    return J_reduced;
+  } else {
+    return basis.project(J);
+  }
+}
+
+/**
+ * @brief solve the reduced equations Phi^T r(u_0 + Phi q) = 0 with Newton's method
+ *
+ * @code{.cpp}
+ * int iterations = solveReducedNewton(basis, u0, q, [&](const mfem::Vector& u) {
+ *   return reduced_residual(t, differentiate_wrt(u));
+ * });
+ * @endcode
+ *
+ * @param basis the reduced basis
+ * @param offset the T-vector u_0 (e.g. a reference configuration, or an essential boundary condition lift)
+ * @param q (input: initial guess, output: solution) the reduced coordinates
+ * @param evaluate callable that returns the residual and its gradient (an mfem::Operator) at a given T-vector.
+ *        The gradient is projected with reducedJacobian().
+ * @param relative_tolerance the iteration stops once ||Phi^T r|| <= relative_tolerance * ||Phi^T r(initial guess)||
+ * @param absolute_tolerance the iteration stops once ||Phi^T r|| <= absolute_tolerance
+ * @param max_iterations an upper limit on the number of Newton iterations
+ * @return the number of Newton iterations performed
+ */
+template <typename callable>
+int solveReducedNewton(const ReducedBasis& basis, const mfem::Vector& offset, mfem::Vector& q,
+                       const callable& evaluate, double relative_tolerance = 1.0e-10,
+                       double absolute_tolerance = 1.0e-12, int max_iterations = 20)
+{
+  mfem::Vector u(offset.Size());
+  mfem::Vector r_reduced(basis.size());
+  mfem::Vector dq(basis.size());
+
+  double initial_norm = -1.0;
+  for (int iteration = 0; iteration < max_iterations; iteration++) {
+    basis.expand(q, u);
+    u += offset;
+
+    auto [r, J] = evaluate(u);
+    basis.project(r, r_reduced);
+
+    double norm = r_reduced.Norml2();
+    if (initial_norm < 0.0) {
+      initial_norm = norm;
+    }
+    if (norm <= absolute_tolerance || norm <= relative_tolerance * initial_norm) {
+      return iteration;
+    }
+
+    mfem::DenseMatrix        J_reduced = reducedJacobian(basis, J);
+    mfem::DenseMatrixInverse J_inv(J_reduced);
+    J_inv.Mult(r_reduced, dq);
+    q -= dq;
+  }
+
+  SLIC_WARNING_ROOT("solveReducedNewton did not converge");
+  return max_iterations;
+}
+
+/// @brief the error of a reduced solution, relative to the corresponding solution of the full model
+struct ReducedOrderError {
+  /// @brief ||(u_0 + Phi q) - u|| / ||u||, the relative error of the reduced solution
+  double solution_error;
+
+  /// @brief ||Phi Phi^T (u - u_0) - (u - u_0)|| / ||u||, the smallest error that any reduced solution could have
+  double projection_error;
+};
+
+/**
+ * @brief compare a reduced solution with the full model's solution, and report the error
+ *
+ * A solution error much larger than the projection error indicates that the reduced equations
+ * (e.g. the element sampling) are inaccurate, rather than the basis.
+ *
+ * @param basis the reduced basis
+ * @param offset the T-vector u_0
+ * @param q the reduced coordinates of the reduced solution
+ * @param u_full the T-vector of the full model's solution
+ * @param print_level print the errors (1), or nothing (0)
+ * @return the relative errors, on every rank
+ */
+ReducedOrderError fullOrderError(const ReducedBasis& basis, const mfem::Vector& offset, const mfem::Vector& q,
+                                 const mfem::Vector& u_full, int print_level = 1);
+
+}  // namespace serac
@@ -173,6 +173,32 @@ SERAC_HOST_DEVICE auto compute_boundary_area_correction(const position_type& X,
   return area_correction;
 }
 
+/**
+ * @brief Whether the shape displacement at a quadrature point is a constant (i.e. not a dual number), for which
+ * the zero-shape fast path of the shape-aware integrands applies
+ *
+ * @tparam shape_type The type of the shape displacement argument
+ */
+template <typename shape_type>
+inline constexpr bool is_constant_shape =
+    std::is_same_v<decltype(squared_norm(get<VALUE>(std::declval<shape_type>()))), double>;
+
+/**
+ * @brief Check whether the shape displacement (value and gradient) vanishes at a quadrature point, in which case
+ * the shape correction is the identity, and the integrand can be evaluated with its unmodified arguments
+ *
+ * @tparam shape_type The type of the shape displacement argument (not dual, see `is_constant_shape`)
+ *
+ * @param shape The shape displacement at the quadrature point
+ *
+ * @return true if the shape displacement and its gradient are exactly zero
+ */
+template <typename shape_type>
+SERAC_HOST_DEVICE bool is_zero_shape(const shape_type& shape)
+{
+  return squared_norm(get<VALUE>(shape)) == 0.0 && squared_norm(get<DERIVATIVE>(shape)) == 0.0;
+}
+
 /**
  * @brief A helper function to modify all of the trial function input derivatives according to the given shape
  * displacement for integrands without state variables
@@ -383,16 +409,28 @@ public:
     SERAC_HOST_DEVICE auto operator()(double time, PositionType x, ShapeValueType shape_val,
                                       QFuncArgs... qfunc_args) const
     {
-      auto qfunc_tuple               = make_tuple(qfunc_args...);
-      auto reduced_trial_space_tuple = make_tuple(get<args>(trial_spaces)...);
-
-      detail::ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
-      // TODO(CUDA): When this is compiled to device code, the below make_integer_sequence will
-      // need to change to a camp integer sequence.
-      auto unmodified_qf_return = detail::apply_shape_aware_qf_helper(
-          integrand_, time, x, shape_val, reduced_trial_space_tuple, qfunc_tuple, shape_correction,
-          std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
-      return shape_correction.modify_shape_aware_qf_return(test_space, unmodified_qf_return);
+      auto shape_aware_qf = [&]() {
+        auto qfunc_tuple               = make_tuple(qfunc_args...);
+        auto reduced_trial_space_tuple = make_tuple(get<args>(trial_spaces)...);
+
+        detail::ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
+        // TODO(CUDA): When this is compiled to device code, the below make_integer_sequence will
+        // need to change to a camp integer sequence.
+        auto unmodified_qf_return = detail::apply_shape_aware_qf_helper(
+            integrand_, time, x, shape_val, reduced_trial_space_tuple, qfunc_tuple, shape_correction,
+            std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
+        return shape_correction.modify_shape_aware_qf_return(test_space, unmodified_qf_return);
+      };
+
+      // the shape correction is the identity where the shape displacement vanishes, so skip it (unless
+      // the shape displacement is being differentiated, since its derivatives don't vanish)
+      if constexpr (detail::is_constant_shape<ShapeValueType> &&
+                    std::is_same_v<decltype(shape_aware_qf()), decltype(integrand_(time, x, qfunc_args...))>) {
+        if (detail::is_zero_shape(shape_val)) {
+          return integrand_(time, x, qfunc_args...);
+        }
+      }
+      return shape_aware_qf();
     }
   };
 
@@ -424,16 +462,27 @@ public:
     SERAC_HOST_DEVICE auto operator()(double time, PositionType x, StateType& state, ShapeValueType shape_val,
                                       QFuncArgs... qfunc_args) const
     {
-      auto qfunc_tuple               = make_tuple(qfunc_args...);
-      auto reduced_trial_space_tuple = make_tuple(get<args>(trial_spaces)...);
-
-      detail::ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
-      // TODO(CUDA): When this is compiled to device code, the below make_integer_sequence will
-      // need to change to a camp integer sequence.
-      auto unmodified_qf_return = detail::apply_shape_aware_qf_helper_with_state(
-          integrand_, time, x, state, shape_val, reduced_trial_space_tuple, qfunc_tuple, shape_correction,
-          std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
-      return shape_correction.modify_shape_aware_qf_return(test_space, unmodified_qf_return);
+      auto shape_aware_qf = [&]() {
+        auto qfunc_tuple               = make_tuple(qfunc_args...);
+        auto reduced_trial_space_tuple = make_tuple(get<args>(trial_spaces)...);
+
+        detail::ShapeCorrection shape_correction(Dimension<dim>{}, shape_val);
+        // TODO(CUDA): When this is compiled to device code, the below make_integer_sequence will
+        // need to change to a camp integer sequence.
+        auto unmodified_qf_return = detail::apply_shape_aware_qf_helper_with_state(
+            integrand_, time, x, state, shape_val, reduced_trial_space_tuple, qfunc_tuple, shape_correction,
+            std::make_integer_sequence<int, sizeof...(qfunc_args)>{});
+        return shape_correction.modify_shape_aware_qf_return(test_space, unmodified_qf_return);
+      };
+
+      // zero-shape fast path, see ShapeAwareIntegrandWrapper
+      if constexpr (detail::is_constant_shape<ShapeValueType> &&
+                    std::is_same_v<decltype(shape_aware_qf()), decltype(integrand_(time, x, state, qfunc_args...))>) {
+        if (detail::is_zero_shape(shape_val)) {
+          return integrand_(time, x, state, qfunc_args...);
+        }
+      }
+      return shape_aware_qf();
     }
   };
 
@@ -493,8 +542,19 @@ public:
     SERAC_HOST_DEVICE auto operator()(double time, PositionType x, ShapeValueType shape_val,
                                       QFuncArgs... qfunc_args) const
     {
-      auto unmodified_qf_return = integrand_(time, x + shape_val, qfunc_args...);
-      return unmodified_qf_return * detail::compute_boundary_area_correction(x, shape_val);
+      auto shape_aware_qf = [&]() {
+        auto unmodified_qf_return = integrand_(time, x + shape_val, qfunc_args...);
+        return unmodified_qf_return * detail::compute_boundary_area_correction(x, shape_val);
+      };
+
+      // zero-shape fast path, see ShapeAwareIntegrandWrapper
+      if constexpr (detail::is_constant_shape<ShapeValueType> &&
+                    std::is_same_v<decltype(shape_aware_qf()), decltype(integrand_(time, x, qfunc_args...))>) {
+        if (detail::is_zero_shape(shape_val)) {
+          return integrand_(time, x, qfunc_args...);
+        }
+      }
+      return shape_aware_qf();
     }
   };
 
@@ -534,10 +594,10 @@ public:
    *
    * @return Either the evaluated integral value or a tuple of the integral value and the requested derivative.
    */
-  template <uint32_t wrt, typename... T>
-  auto operator()(DifferentiateWRT<wrt>, double t, const T&... args)
+  template <uint32_t... wrt, typename... T>
+  decltype(auto) operator()(DifferentiateWRT<wrt...>, double t, const T&... args)
   {
-    return (*functional_)(DifferentiateWRT<wrt>{}, t, args...);
+    return (*functional_)(DifferentiateWRT<wrt...>{}, t, args...);
   }
 
   /**
@@ -549,12 +609,13 @@ public:
    *
    * @param t The time
    * @param args The trial space dofs used to carry out the calculation. The first argument is always the shape
-   * displacement. To compute a derivative, at most one argument can be of type `differentiate_wrt_this(mfem::Vector)`.
+   * displacement. To compute derivatives, one or more arguments can be of type `differentiate_wrt_this(mfem::Vector)`,
+   * or of type `differentiate_along_this` to differentiate along a linear combination of arguments.
    *
    * @return Either the evaluated integral value or a tuple of the integral value and the requested derivative.
    */
   template <typename... T>
-  auto operator()(double t, const T&... args)
+  decltype(auto) operator()(double t, const T&... args)
   {
     return (*functional_)(t, args...);
   }
@@ -569,6 +630,18 @@ public:
    */
   void updateQdata(bool update_flag) { functional_->updateQdata(update_flag); }
 
+  /**
+   * @brief reuse the output of each integral whose inputs haven't changed since its last evaluation
+   *
+   * @param enable whether to memoize the integral outputs
+   *
+   * @see Functional::memoizeIntegralOutputs
+   */
+  void memoizeIntegralOutputs(bool enable) { functional_->memoizeIntegralOutputs(enable); }
+
+  /// @brief discard the memoized integral outputs, see Functional::invalidateMemoizedOutputs
+  void invalidateMemoizedOutputs() { functional_->invalidateMemoizedOutputs(); }
+
 private:
   /// @brief The underlying pure Functional object
   std::unique_ptr<Functional<test(shape, trials...), exec>> functional_;
@@ -336,6 +336,73 @@ TEST(domain, of_elements)
   }
 }
 
+TEST(domain, batched_and_attribute_predicates_match_per_element_predicates)
+{
+  {
+    constexpr int dim  = 3;
+    auto          mesh = import_mesh("patch3D_tets_and_hexes.mesh");
+
+    Domain d0 = Domain::ofElements(mesh, std::function([](std::vector<vec3> vertices, int /*attr*/) {
+                                     return average(vertices)[1] < 0.75;
+                                   }));
+
+    BatchPredicate<dim> center_below = [](const EntityBatch<dim>& batch, bool* selected) {
+      for (int e = 0; e < batch.size; e++) {
+        vec3 center{};
+        for (int v = 0; v < batch.vertices_per_entity; v++) {
+          center += batch.vertex(e, v);
+        }
+        selected[e] = center[1] / batch.vertices_per_entity < 0.75;
+      }
+    };
+    Domain d1 = Domain::ofElementsInBatches(mesh, center_below);
+
+    EXPECT_EQ(d0.tet_ids_, d1.tet_ids_);
+    EXPECT_EQ(d0.hex_ids_, d1.hex_ids_);
+    EXPECT_EQ(d0.mfem_tet_ids_, d1.mfem_tet_ids_);
+    EXPECT_EQ(d0.mfem_hex_ids_, d1.mfem_hex_ids_);
+
+    Domain d2 = Domain::ofElements(mesh, by_attr<dim>(1));
+    Domain d3 = Domain::ofElementsWithAttributes(mesh, {1});
+    EXPECT_EQ(d2.tet_ids_, d3.tet_ids_);
+    EXPECT_EQ(d2.hex_ids_, d3.hex_ids_);
+    EXPECT_EQ(d2.mfem_tet_ids_, d3.mfem_tet_ids_);
+    EXPECT_EQ(d2.mfem_hex_ids_, d3.mfem_hex_ids_);
+
+    Domain d4 = Domain::ofBoundaryElements(mesh, by_attr<dim>(1));
+    Domain d5 = Domain::ofBoundaryElementsWithAttributes(mesh, {1});
+    EXPECT_EQ(d4.tri_ids_, d5.tri_ids_);
+    EXPECT_EQ(d4.quad_ids_, d5.quad_ids_);
+    EXPECT_EQ(d5.type_, Domain::Type::BoundaryElements);
+
+    // set operations keep track of the mfem ids of the result
+    Domain d6 = d0 - d2;
+    EXPECT_EQ(d6.mfem_tet_ids_.size(), d6.tet_ids_.size());
+    for (auto elem_id : d6.mfem_tet_ids_) {
+      EXPECT_NE(mesh.GetAttribute(elem_id), 1);
+    }
+    EXPECT_EQ((d0 | d2).hex_ids_.size() + (d0 & d2).hex_ids_.size(), d0.hex_ids_.size() + d2.hex_ids_.size());
+  }
+
+  {
+    constexpr int dim  = 2;
+    auto          mesh = import_mesh("patch2D_tris_and_quads.mesh");
+
+    Domain d0 = Domain::ofBoundaryElements(
+        mesh, std::function([](std::vector<vec2> vertices, int /* attr */) { return average(vertices)[0] < 0.5; }));
+
+    Domain d1 = Domain::ofBoundaryElementsInBatches(
+        mesh, BatchPredicate<dim>([](const EntityBatch<dim>& batch, bool* selected) {
+          for (int e = 0; e < batch.size; e++) {
+            selected[e] = 0.5 * (batch.vertex(e, 0)[0] + batch.vertex(e, 1)[0]) < 0.5;
+          }
+        }));
+
+    EXPECT_EQ(d0.edge_ids_, d1.edge_ids_);
+    EXPECT_EQ(d0.mfem_edge_ids_, d1.mfem_edge_ids_);
+  }
+}
+
 int main(int argc, char* argv[])
 {
   int num_procs, myid;
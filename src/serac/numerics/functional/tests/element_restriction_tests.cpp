@@ -0,0 +1,122 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils_base.hpp"
+#include "serac/numerics/functional/element_restriction.hpp"
+#include "serac/numerics/functional/functional.hpp"
+
+using namespace serac;
+
+constexpr int p   = 2;
+constexpr int dim = 2;
+
+using space = H1<p>;
+
+std::unique_ptr<mfem::ParMesh> patch_mesh()
+{
+  std::string meshfile = SERAC_REPO_DIR "/data/meshes/patch2D_tris_and_quads.mesh";
+  return mesh::refineAndDistribute(buildMeshFromFile(meshfile), 1);
+}
+
+TEST(ElementRestriction, FunctionalsShareElementRestrictions)
+{
+  auto mesh           = patch_mesh();
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  auto make_functional = [&]() {
+    auto f = std::make_unique<Functional<space(space)> >(
+        fespace.get(), std::array<const mfem::ParFiniteElementSpace*, 1>{fespace.get()});
+    f->AddDomainIntegral(
+        Dimension<dim>{}, DependsOn<0>{},
+        [](double /*t*/, auto /*x*/, auto temperature) {
+          auto [u, du_dx] = temperature;
+          return serac::tuple{u, du_dx};
+        },
+        *mesh);
+    return f;
+  };
+
+  // number of references to the quadrilateral restriction of `fespace` held by Functionals
+  auto num_users = [&]() { return get_shared_restriction(fespace.get(), mfem::Geometry::SQUARE).use_count() - 1; };
+
+  auto first           = make_functional();
+  auto users_per_first = num_users();
+  EXPECT_GT(users_per_first, 0);
+
+  // a second Functional on the same space reuses the restriction held by the first, instead of building its own
+  auto second = make_functional();
+  EXPECT_EQ(num_users(), 2 * users_per_first);
+  EXPECT_EQ(get_shared_restriction(fespace.get(), mfem::Geometry::SQUARE),
+            get_shared_restriction(fespace.get(), mfem::Geometry::SQUARE));
+
+  // once every user is gone, the restriction is freed
+  first.reset();
+  second.reset();
+  EXPECT_EQ(num_users(), 0);
+}
+
+TEST(ElementRestriction, UpdatedSpacesGetNewRestrictions)
+{
+  auto mesh           = patch_mesh();
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  auto before = get_shared_restriction(fespace.get(), mfem::Geometry::SQUARE);
+
+  // refining the mesh changes the space in place (same address), so the old restriction must not be reused
+  mesh->UniformRefinement();
+  fespace->Update();
+
+  auto after = get_shared_restriction(fespace.get(), mfem::Geometry::SQUARE);
+  EXPECT_NE(before, after);
+  EXPECT_GT(after->ESize(), before->ESize());
+  EXPECT_EQ(after, get_shared_restriction(fespace.get(), mfem::Geometry::SQUARE));
+}
+
+TEST(ElementRestriction, ConcurrentLookupsShareOneRestriction)
+{
+  auto mesh           = patch_mesh();
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  constexpr int num_threads = 8;
+
+  std::vector<std::shared_ptr<const ElementRestriction> > restrictions(num_threads);
+  std::vector<std::thread>                                threads;
+  for (int i = 0; i < num_threads; i++) {
+    threads.emplace_back([&, i]() {
+      restrictions[std::size_t(i)] = get_shared_restriction(fespace.get(), mfem::Geometry::SEGMENT, FaceType::BOUNDARY);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& restriction : restrictions) {
+    EXPECT_EQ(restriction, restrictions[0]);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
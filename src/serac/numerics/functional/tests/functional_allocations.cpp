@@ -0,0 +1,225 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/numerics/functional/tensor.hpp"
+#include "serac/physics/heat_transfer.hpp"
+#include "serac/physics/materials/solid_material.hpp"
+#include "serac/physics/materials/thermal_material.hpp"
+#include "serac/physics/solid_mechanics.hpp"
+#include "serac/physics/state/state_manager.hpp"
+
+using namespace serac;
+
+// this test replaces the global allocation functions so that it can count how many
+// times the C++ heap is used while evaluating a Functional (or a physics module's residual) and its derivatives
+//
+// note: allocations made by C libraries (e.g. hypre's internal `malloc` calls) are not counted
+namespace {
+bool        counting_allocations = false;
+std::size_t num_allocations      = 0;
+
+/// @brief return the number of C++ heap allocations made while calling f()
+template <typename callable>
+std::size_t count_allocations(const callable& f)
+{
+  num_allocations      = 0;
+  counting_allocations = true;
+  f();
+  counting_allocations = false;
+  return num_allocations;
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  if (counting_allocations) {
+    num_allocations++;
+  }
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+TEST(Functional, SteadyStateEvaluationDoesNotAllocate)
+{
+  constexpr int p   = 2;
+  constexpr int dim = 2;
+
+  std::string meshfile = SERAC_REPO_DIR "/data/meshes/patch2D_tris_and_quads.mesh";
+  auto        mesh     = mesh::refineAndDistribute(buildMeshFromFile(meshfile), 1);
+
+  using space = H1<p>;
+
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  Functional<space(space)> residual(fespace.get(), {fespace.get()});
+
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto /*x*/, auto temperature) {
+        auto [u, du_dx] = temperature;
+        return serac::tuple{u * u, (1.0 + u) * du_dx};
+      },
+      *mesh);
+
+  residual.AddBoundaryIntegral(
+      Dimension<dim - 1>{}, DependsOn<0>{},
+      [](double /*t*/, auto /*x*/, auto temperature) { return sin(get<0>(temperature)); }, *mesh);
+
+  mfem::Vector U(fespace->TrueVSize());
+  mfem::Vector dU(fespace->TrueVSize());
+  U.Randomize(0);
+  dU.Randomize(1);
+
+  double t = 0.0;
+
+  // the first "Newton iteration" is allowed to set up any persistent storage
+  auto [value, dr_dU] = residual(t, differentiate_wrt(U));
+  dr_dU(dU);
+  std::unique_ptr<mfem::HypreParMatrix> J = assemble(dr_dU);
+
+  // ... but afterwards, the residual, its derivatives, and their action should not allocate
+  EXPECT_EQ(count_allocations([&]() { residual(t, U); }), 0u);
+  EXPECT_EQ(count_allocations([&]() { residual(t, differentiate_wrt(U)); }), 0u);
+  EXPECT_EQ(count_allocations([&]() { dr_dU(dU); }), 0u);
+}
+
+TEST(Functional, SteadyStateAssemblyOnlyAllocatesTheReturnedMatrix)
+{
+  constexpr int p   = 2;
+  constexpr int dim = 2;
+
+  using space = H1<p>;
+
+  std::string meshfile = SERAC_REPO_DIR "/data/meshes/patch2D_tris_and_quads.mesh";
+
+  // the number of C++ heap allocations made by the second and third assemble() calls
+  auto steady_state_allocations = [&](int refinements) {
+    auto mesh           = mesh::refineAndDistribute(buildMeshFromFile(meshfile), refinements);
+    auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+    Functional<space(space)> residual(fespace.get(), {fespace.get()});
+
+    residual.AddDomainIntegral(
+        Dimension<dim>{}, DependsOn<0>{},
+        [](double /*t*/, auto /*x*/, auto temperature) {
+          auto [u, du_dx] = temperature;
+          return serac::tuple{u * u, (1.0 + u) * du_dx};
+        },
+        *mesh);
+
+    mfem::Vector U(fespace->TrueVSize());
+    U.Randomize(0);
+
+    auto [value, dr_dU] = residual(0.0, differentiate_wrt(U));
+    std::unique_ptr<mfem::HypreParMatrix> J = assemble(dr_dU);
+
+    std::array<std::size_t, 2> counts;
+    for (auto& count : counts) {
+      count = count_allocations([&]() { J = assemble(dr_dU); });
+    }
+    return counts;
+  };
+
+  // assemble() has to allocate the mfem::HypreParMatrix it returns (and mfem's intermediate matrices), but
+  // the element gradients, lookup tables, and CSR arrays are reused, so the count doesn't grow between
+  // assemblies or with the size of the mesh
+  auto coarse = steady_state_allocations(1);
+  auto fine   = steady_state_allocations(2);
+  EXPECT_EQ(coarse[0], coarse[1]);
+  EXPECT_EQ(coarse[0], fine[0]);
+}
+
+/// @brief gives the tests access to the residual operator that a physics module hands to its nonlinear solver
+template <typename Physics>
+class ResidualAccess : public Physics {
+public:
+  using Physics::Physics;
+  using Physics::residual_with_bcs_;
+};
+
+TEST(HeatTransfer, SteadyStateResidualEvaluationDoesNotAllocate)
+{
+  axom::sidre::DataStore datastore;
+  StateManager::initialize(datastore, "functional_allocations");
+
+  std::string mesh_tag{"mesh"};
+  StateManager::setMesh(std::make_unique<mfem::ParMesh>(MPI_COMM_WORLD, buildRectangleMesh(8, 8, 1.0, 1.0)), mesh_tag);
+
+  ResidualAccess<HeatTransfer<2, 2>> thermal(heat_transfer::default_nonlinear_options,
+                                             heat_transfer::default_linear_options,
+                                             heat_transfer::default_static_options, "thermal", mesh_tag);
+  thermal.setMaterial(heat_transfer::LinearIsotropicConductor{1.0, 1.0, 1.0});
+  thermal.setTemperatureBCs({1}, [](const mfem::Vector&, double) { return 0.0; });
+  thermal.completeSetup();
+
+  mfem::Vector U(thermal.temperature().Size());
+  mfem::Vector R(thermal.temperature().Size());
+  U.Randomize(0);
+
+  // the first evaluation is allowed to set up any persistent storage
+  thermal.residual_with_bcs_.Mult(U, R);
+  EXPECT_EQ(count_allocations([&]() { thermal.residual_with_bcs_.Mult(U, R); }), 0u);
+
+  StateManager::reset();
+}
+
+TEST(SolidMechanics, SteadyStateResidualEvaluationDoesNotAllocate)
+{
+  axom::sidre::DataStore datastore;
+  StateManager::initialize(datastore, "functional_allocations");
+
+  std::string mesh_tag{"mesh"};
+  StateManager::setMesh(std::make_unique<mfem::ParMesh>(MPI_COMM_WORLD, buildRectangleMesh(8, 8, 1.0, 1.0)), mesh_tag);
+
+  ResidualAccess<SolidMechanics<2, 2>> solid(solid_mechanics::default_nonlinear_options,
+                                             solid_mechanics::default_linear_options,
+                                             solid_mechanics::default_quasistatic_options, GeometricNonlinearities::On,
+                                             "solid", mesh_tag);
+  solid.setMaterial(solid_mechanics::NeoHookean{.density = 1.0, .K = 1.0, .G = 0.5});
+  solid.setDisplacementBCs({1}, [](const mfem::Vector&, mfem::Vector& u) { u = 0.0; });
+  solid.completeSetup();
+
+  mfem::Vector U(solid.displacement().Size());
+  mfem::Vector R(solid.displacement().Size());
+  U.Randomize(0);
+  U *= 1.0e-2;
+
+  // the first evaluation is allowed to set up any persistent storage
+  solid.residual_with_bcs_->Mult(U, R);
+  EXPECT_EQ(count_allocations([&]() { solid.residual_with_bcs_->Mult(U, R); }), 0u);
+
+  StateManager::reset();
+}
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
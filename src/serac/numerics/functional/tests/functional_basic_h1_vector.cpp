@@ -108,6 +108,9 @@ void weird_mixed_test(std::unique_ptr<mfem::ParMesh>& mesh)
 
   double t = 0.0;
   check_gradient(residual, t, U);
+
+  auto [value, dfdU] = residual(t, differentiate_wrt(U));
+  EXPECT_FALSE(dfdU.blockAssembly());
 }
 
 template <int p, int dim>
@@ -133,6 +136,53 @@ void elasticity_test(std::unique_ptr<mfem::ParMesh>& mesh)
 
   double t = 0.0;
   check_gradient(residual, t, U);
+
+  // test and trial spaces with the same number of components can be assembled in (dim x dim) node-node blocks
+  auto [value, dfdU] = residual(t, differentiate_wrt(U));
+  EXPECT_FALSE(dfdU.blockAssembly());
+  std::unique_ptr<mfem::HypreParMatrix> J_scalar = assemble(dfdU);
+
+  auto bsr = dfdU.assembleBlockCSR();
+  EXPECT_EQ(bsr.block_size, dim);
+  EXPECT_EQ(bsr.num_block_rows, test_fes->GetNDofs());
+  EXPECT_EQ(bsr.num_block_cols, trial_fes->GetNDofs());
+
+  // the block matrix-vector product (on L-vectors) should agree with the assembled matrix (on T-vectors)
+  mfem::Vector dU(trial_fes->TrueVSize());
+  dU.Randomize();
+  mfem::Vector dU_L(trial_fes->GetVSize());
+  mfem::Vector dR_L(test_fes->GetVSize());
+  mfem::Vector dR_block(test_fes->TrueVSize());
+  mfem::Vector dR_scalar(test_fes->TrueVSize());
+  trial_fes->GetProlongationMatrix()->Mult(dU, dU_L);
+  bsr.Mult(dU_L, dR_L);
+  test_fes->GetProlongationMatrix()->MultTranspose(dR_L, dR_block);
+  J_scalar->Mult(dU, dR_scalar);
+  dR_block -= dR_scalar;
+  EXPECT_LT(dR_block.Normlinf(), 1.0e-12 * std::max(dR_scalar.Normlinf(), 1.0));
+
+  // the block assembly should agree entry by entry with the scalar CSR assembly
+  dfdU.setBlockAssembly(true);
+  EXPECT_TRUE(dfdU.blockAssembly());
+  std::unique_ptr<mfem::HypreParMatrix> J_block = assemble(dfdU);
+
+  mfem::SparseMatrix block_entries, scalar_entries;
+  J_block->MergeDiagAndOffd(block_entries);
+  J_scalar->MergeDiagAndOffd(scalar_entries);
+  block_entries.SortColumnIndices();
+  scalar_entries.SortColumnIndices();
+
+  ASSERT_EQ(block_entries.Height(), scalar_entries.Height());
+  ASSERT_EQ(block_entries.NumNonZeroElems(), scalar_entries.NumNonZeroElems());
+
+  double tolerance = 1.0e-12 * scalar_entries.MaxNorm();
+  for (int row = 0; row < scalar_entries.Height(); row++) {
+    ASSERT_EQ(block_entries.RowSize(row), scalar_entries.RowSize(row));
+    for (int k = scalar_entries.GetI()[row]; k < scalar_entries.GetI()[row + 1]; k++) {
+      EXPECT_EQ(block_entries.GetJ()[k], scalar_entries.GetJ()[k]);
+      EXPECT_NEAR(block_entries.GetData()[k], scalar_entries.GetData()[k], tolerance);
+    }
+  }
 }
 
 void test_suite(std::string meshfile)
@@ -78,6 +78,261 @@ TEST(FunctionalMultiphysics, NonlinearThermalTest3D)
   mfem::Vector r = residual(t, U, dU_dt);
 
   check_gradient(residual, t, U, dU_dt);
+
+  // differentiating w.r.t. both arguments in a single evaluation should
+  // agree with differentiating w.r.t. each argument separately
+  mfem::Vector dU(fespace->TrueVSize());
+  dU.Randomize(seed + 2);
+
+  mfem::Vector separate_value, separate_dr_dU, separate_dr_dUdt;
+  {
+    auto [value, dr_dU] = residual(t, differentiate_wrt(U), dU_dt);
+    separate_value      = value;
+    separate_dr_dU      = dr_dU(dU);
+  }
+  {
+    auto [value, dr_dUdt] = residual(t, U, differentiate_wrt(dU_dt));
+    separate_dr_dUdt      = dr_dUdt(dU);
+  }
+
+  auto [value, dr_dU, dr_dUdt] = residual(t, differentiate_wrt(U), differentiate_wrt(dU_dt));
+
+  mfem::Vector joint_value   = value;
+  mfem::Vector joint_dr_dU   = dr_dU(dU);
+  mfem::Vector joint_dr_dUdt = dr_dUdt(dU);
+
+  joint_value -= separate_value;
+  joint_dr_dU -= separate_dr_dU;
+  joint_dr_dUdt -= separate_dr_dUdt;
+
+  EXPECT_NEAR(joint_value.Norml2() / separate_value.Norml2(), 0.0, 1.0e-12);
+  EXPECT_NEAR(joint_dr_dU.Norml2() / separate_dr_dU.Norml2(), 0.0, 1.0e-12);
+  EXPECT_NEAR(joint_dr_dUdt.Norml2() / separate_dr_dUdt.Norml2(), 0.0, 1.0e-12);
+
+  // evaluating an ensemble of samples in one pass should agree with evaluating each sample separately
+  std::vector<mfem::Vector> dU_dt_samples(3, mfem::Vector(fespace->TrueVSize()));
+  for (int s = 0; s < 3; s++) {
+    dU_dt_samples[std::size_t(s)].Randomize(seed + 3 + s);
+  }
+
+  std::vector<mfem::Vector> ensemble_values = residual.evaluateEnsemble(t, U, dU_dt_samples);
+  ASSERT_EQ(ensemble_values.size(), 3u);
+
+  for (std::size_t s = 0; s < 3; s++) {
+    mfem::Vector separate = residual(t, U, dU_dt_samples[s]);
+    mfem::Vector error    = ensemble_values[s];
+    error -= separate;
+    EXPECT_NEAR(error.Norml2() / separate.Norml2(), 0.0, 1.0e-12);
+  }
+
+  // differentiating along the linear combination (c dU, dU_dt) should agree with
+  // the combination dr_dUdt + c dr_dU of the separate derivatives, both in action and assembled
+  double c = 0.25;
+
+  mfem::Vector expected_dJ(separate_dr_dUdt);
+  expected_dJ.Add(c, separate_dr_dU);
+
+  std::unique_ptr<mfem::HypreParMatrix> expected_J;
+  {
+    auto [value_U, K]   = residual(t, differentiate_wrt(U), dU_dt);
+    auto k_mat          = assemble(K);
+    auto [value_Udt, M] = residual(t, U, differentiate_wrt(dU_dt));
+    auto m_mat          = assemble(M);
+    expected_J.reset(mfem::Add(1.0, *m_mat, c, *k_mat));
+  }
+
+  auto [combined_value, J] = residual(t, differentiate_along(U, c), differentiate_along(dU_dt, 1.0));
+
+  mfem::Vector value_error = combined_value;
+  value_error -= separate_value;
+  EXPECT_NEAR(value_error.Norml2() / separate_value.Norml2(), 0.0, 1.0e-12);
+
+  mfem::Vector dJ = J(dU);
+  dJ -= expected_dJ;
+  EXPECT_NEAR(dJ.Norml2() / expected_dJ.Norml2(), 0.0, 1.0e-12);
+
+  auto         J_mat = assemble(J);
+  mfem::Vector J_dU(fespace->TrueVSize());
+  mfem::Vector expected_J_dU(fespace->TrueVSize());
+  J_mat->Mult(dU, J_dU);
+  expected_J->Mult(dU, expected_J_dU);
+  J_dU -= expected_J_dU;
+  EXPECT_NEAR(J_dU.Norml2() / expected_J_dU.Norml2(), 0.0, 1.0e-12);
+}
+
+TEST(FunctionalMultiphysics, MemoizesIntegralsWithUnchangedInputs)
+{
+  auto mesh2D = mesh::refineAndDistribute(mfem::Mesh::MakeCartesian2D(4, 4, mfem::Element::QUADRILATERAL), 0, 0);
+
+  constexpr auto p = 2;
+
+  using space = H1<p>;
+
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh2D.get());
+
+  mfem::Vector U(fespace->TrueVSize());
+  mfem::Vector V(fespace->TrueVSize());
+  U.Randomize(0);
+  V.Randomize(1);
+
+  // count how many times each integrand is evaluated
+  int volume_evaluations  = 0;
+  int surface_evaluations = 0;
+
+  Functional<space(space, space)> memoized(fespace.get(), {fespace.get(), fespace.get()});
+  Functional<space(space, space)> reference(fespace.get(), {fespace.get(), fespace.get()});
+
+  for (auto* residual : {&memoized, &reference}) {
+    residual->AddVolumeIntegral(
+        DependsOn<0>{},
+        [&volume_evaluations](double /*t*/, auto /*position*/, auto u) {
+          volume_evaluations++;
+          auto [value, gradient] = u;
+          return serac::tuple{value * value, gradient};
+        },
+        *mesh2D);
+
+    residual->AddSurfaceIntegral(
+        DependsOn<1>{},
+        [&surface_evaluations](double t, auto /*position*/, auto v) {
+          surface_evaluations++;
+          auto [value, _] = v;
+          return t * sin(value);
+        },
+        *mesh2D);
+  }
+
+  memoized.memoizeIntegralOutputs(true);
+
+  auto expect_same_residual = [&](double t) {
+    mfem::Vector expected = reference(t, U, V);
+    mfem::Vector error    = memoized(t, U, V);
+    error -= expected;
+    EXPECT_NEAR(error.Norml2() / expected.Norml2(), 0.0, 1.0e-14);
+  };
+
+  expect_same_residual(1.0);
+
+  // changing only U should skip the surface integral, which only depends on V
+  volume_evaluations  = 0;
+  surface_evaluations = 0;
+  U.Randomize(2);
+  memoized(1.0, U, V);
+  EXPECT_GT(volume_evaluations, 0);
+  EXPECT_EQ(surface_evaluations, 0);
+  expect_same_residual(1.0);
+
+  // nothing changed, so both integrals are skipped
+  volume_evaluations  = 0;
+  surface_evaluations = 0;
+  memoized(1.0, U, V);
+  EXPECT_EQ(volume_evaluations, 0);
+  EXPECT_EQ(surface_evaluations, 0);
+
+  // a different time, or an explicit invalidation, recomputes every integral
+  for (bool invalidate : {false, true}) {
+    if (invalidate) memoized.invalidateMemoizedOutputs();
+    volume_evaluations  = 0;
+    surface_evaluations = 0;
+    memoized(2.0, U, V);
+    EXPECT_GT(volume_evaluations, 0);
+    EXPECT_GT(surface_evaluations, 0);
+  }
+  expect_same_residual(2.0);
+
+  // differentiation w.r.t. V recomputes the surface integral (for its derivatives), but not the volume integral
+  volume_evaluations                   = 0;
+  surface_evaluations                  = 0;
+  [[maybe_unused]] auto [value, dr_dV] = memoized(2.0, U, differentiate_wrt(V));
+  EXPECT_EQ(volume_evaluations, 0);
+  EXPECT_GT(surface_evaluations, 0);
+}
+
+TEST(FunctionalMultiphysics, EnsembleMatchesSeparateEvaluationsWithElementWeights)
+{
+  auto mesh2D = mesh::refineAndDistribute(mfem::Mesh::MakeCartesian2D(4, 4, mfem::Element::QUADRILATERAL), 0, 0);
+
+  constexpr auto p = 2;
+
+  using space = H1<p>;
+
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh2D.get());
+
+  Functional<space(space, space)> residual(fespace.get(), {fespace.get(), fespace.get()});
+
+  residual.AddDomainIntegral(
+      Dimension<2>{}, DependsOn<0, 1>{},
+      [](double t, auto /*position*/, auto u, auto v) {
+        auto [u_value, du_dx] = u;
+        auto [v_value, dv_dx] = v;
+        return serac::tuple{t * u_value * u_value * v_value, (1.0 + u_value * u_value) * du_dx + dv_dx};
+      },
+      *mesh2D);
+
+  residual.AddBoundaryIntegral(
+      Dimension<1>{}, DependsOn<0>{},
+      [](double /*t*/, auto /*position*/, auto u) {
+        auto [value, _] = u;
+        return sin(value);
+      },
+      *mesh2D);
+
+  // scale the elements on the left half of the mesh by arbitrary weights, as a hyper-reduced model would
+  Domain left = Domain::ofElements(*mesh2D, std::function([](std::vector<vec2> vertices, int /* attr */) {
+                                     vec2 center{};
+                                     for (auto& x : vertices) {
+                                       center += x / double(vertices.size());
+                                     }
+                                     return center[0] < 0.5;
+                                   }));
+
+  std::map<mfem::Geometry::Type, std::vector<double>> weights;
+  for (std::size_t i = 0; i < left.get(mfem::Geometry::SQUARE).size(); i++) {
+    weights[mfem::Geometry::SQUARE].push_back(0.5 + 0.25 * double(i));
+  }
+  residual.setElementWeights(left, weights);
+
+  constexpr std::size_t     num_samples = 3;
+  std::vector<mfem::Vector> U(num_samples, mfem::Vector(fespace->TrueVSize()));
+  std::vector<mfem::Vector> V(num_samples, mfem::Vector(fespace->TrueVSize()));
+  for (std::size_t s = 0; s < num_samples; s++) {
+    U[s].Randomize(int(2 * s));
+    V[s].Randomize(int(2 * s + 1));
+  }
+
+  mfem::Vector dU(fespace->TrueVSize());
+  dU.Randomize(7);
+
+  double t = 0.5;
+
+  // evaluate twice, to make sure that reusing the cached work vectors gives the same answer
+  for (int repeat = 0; repeat < 2; repeat++) {
+    auto [values, dr_dU] = residual.evaluateEnsemble(t, differentiate_wrt(U), V);
+    ASSERT_EQ(values.size(), num_samples);
+    ASSERT_EQ(dr_dU.size(), num_samples);
+
+    std::vector<mfem::Vector> dU_samples(num_samples, dU);
+    std::vector<mfem::Vector> ensemble_dr(num_samples);
+    dr_dU.Mult(dU_samples, ensemble_dr);
+
+    for (std::size_t s = 0; s < num_samples; s++) {
+      auto [value, gradient] = residual(t, differentiate_wrt(U[s]), V[s]);
+
+      mfem::Vector value_error = values[s];
+      value_error -= value;
+      EXPECT_NEAR(value_error.Norml2() / value.Norml2(), 0.0, 1.0e-12);
+
+      mfem::Vector expected_dr = gradient(dU);
+
+      mfem::Vector dr_error = dr_dU[uint32_t(s)](dU);
+      dr_error -= expected_dr;
+      EXPECT_NEAR(dr_error.Norml2() / expected_dr.Norml2(), 0.0, 1.0e-12);
+
+      dr_error = ensemble_dr[s];
+      dr_error -= expected_dr;
+      EXPECT_NEAR(dr_error.Norml2() / expected_dr.Norml2(), 0.0, 1.0e-12);
+    }
+  }
 }
 
 int main(int argc, char* argv[])
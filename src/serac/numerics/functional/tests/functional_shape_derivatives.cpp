@@ -345,6 +345,60 @@ void functional_test_3D(mfem::ParMesh& mesh, double tolerance)
   EXPECT_NEAR(mfem::InnerProduct(ones, dr), 0.0, tolerance);
 }
 
+// with a vanishing shape displacement, ShapeAwareFunctional skips the shape correction at each quadrature point,
+// so check that it still agrees with an equivalent Functional, and that the shape derivative is still exact there
+template <int p, int dim>
+void zero_shape_test(mfem::ParMesh& mesh, double tolerance)
+{
+  using test_space  = H1<p>;
+  using trial_space = H1<p>;
+  using shape_space = H1<p, dim>;
+
+  auto [fespace1, fec1] = serac::generateParFiniteElementSpace<test_space>(&mesh);
+
+  auto [fespace2, fec2] = serac::generateParFiniteElementSpace<shape_space>(&mesh);
+
+  mfem::Vector U1(fespace1->TrueVSize());
+  U1.Randomize();
+
+  mfem::Vector U2(fespace2->TrueVSize());
+  U2 = 0.0;
+
+  mfem::Vector dU2(fespace2->TrueVSize());
+  dU2.Randomize();
+
+  ShapeAwareFunctional<shape_space, test_space(trial_space)> residual(fespace2.get(), fespace1.get(), {fespace1.get()});
+  residual.AddDomainIntegral(Dimension<dim>{}, DependsOn<>{}, TestFunctorOne<dim, p>{}, mesh);
+  residual.AddBoundaryIntegral(Dimension<dim - 1>{}, DependsOn<>{}, TestFunctorTwo<dim, p>{}, mesh);
+
+  Functional<test_space(trial_space)> reference(fespace1.get(), {fespace1.get()});
+  reference.AddDomainIntegral(Dimension<dim>{}, DependsOn<>{}, TestFunctorOne<dim, p>{}, mesh);
+  reference.AddBoundaryIntegral(Dimension<dim - 1>{}, DependsOn<>{}, TestFunctorTwo<dim, p>{}, mesh);
+
+  double       t     = 0.0;
+  mfem::Vector r     = residual(t, U2, U1);
+  mfem::Vector r_ref = reference(t, U1);
+  r_ref -= r;
+  EXPECT_NEAR(r_ref.Norml2(), 0.0, tolerance);
+
+  auto [r2, drdU2] = residual(t, serac::differentiate_wrt(U2), U1);
+  mfem::Vector dr  = drdU2(dU2);
+
+  // central finite difference of the residual about the zero shape
+  double       epsilon = 1.0e-6;
+  mfem::Vector shape_plus(dU2);
+  shape_plus *= epsilon;
+  mfem::Vector shape_minus(dU2);
+  shape_minus *= -epsilon;
+
+  mfem::Vector dr_fd = residual(t, shape_plus, U1);
+  dr_fd -= residual(t, shape_minus, U1);
+  dr_fd *= 1.0 / (2.0 * epsilon);
+
+  dr_fd -= dr;
+  EXPECT_NEAR(dr_fd.Norml2() / dr.Norml2(), 0.0, 1.0e-6);
+}
+
 TEST(ShapeDerivative, 2DLinear) { functional_test_2D<1>(*mesh2D, 3.0e-14); }
 TEST(ShapeDerivative, 2DQuadratic) { functional_test_2D<2>(*mesh2D, 3.0e-14); }
 
@@ -353,6 +407,9 @@ TEST(ShapeDerivative, 3DLinear) { functional_test_3D<1>(*mesh3D, 2.0e-13); }
 // note: see description at top of file
 TEST(ShapeDerivative, 3DQuadratic) { functional_test_3D<2>(*mesh3D, 1.5e-2); }
 
+TEST(ShapeDerivative, 2DZeroShape) { zero_shape_test<2, 2>(*mesh2D, 1.0e-14); }
+TEST(ShapeDerivative, 3DZeroShape) { zero_shape_test<1, 3>(*mesh3D, 1.0e-13); }
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
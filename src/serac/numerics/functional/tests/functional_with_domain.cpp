@@ -317,6 +317,56 @@ TEST(qoi, partial_domain)
   EXPECT_NEAR(volume, 4.0, 1.0e-14);
 }
 
+template <int dim>
+void fused_integral_comparison_test_impl(std::unique_ptr<mfem::ParMesh>& mesh)
+{
+  using test_space  = H1<1>;
+  using trial_space = H1<1>;
+
+  auto [test_fespace, test_fec]   = serac::generateParFiniteElementSpace<test_space>(mesh.get());
+  auto [trial_fespace, trial_fec] = serac::generateParFiniteElementSpace<trial_space>(mesh.get());
+
+  mfem::Vector U(trial_fespace->TrueVSize());
+
+  mfem::ParGridFunction     U_gf(trial_fespace.get());
+  mfem::FunctionCoefficient x_squared([](mfem::Vector x) { return x[0] * x[0]; });
+  U_gf.ProjectCoefficient(x_squared);
+  U_gf.GetTrueDofs(U);
+
+  auto   on_left = [](std::vector<tensor<double, dim>> X, int /* attr */) { return average(X)[0] < 4.0; };
+  Domain left    = Domain::ofElements(*mesh, on_left);
+
+  // two separate element sweeps over the same domain
+  Functional<test_space(trial_space)> separate(test_fespace.get(), {trial_fespace.get()});
+  separate.AddDomainIntegral(Dimension<dim>{}, DependsOn<0>{}, TestThermalIntegratorOne<dim>{}, left);
+  separate.AddDomainIntegral(Dimension<dim>{}, DependsOn<0>{}, TestThermalIntegratorOne<dim, true>{}, left);
+
+  // a single element sweep that sums the q-function outputs at each quadrature point
+  Functional<test_space(trial_space)> fused(test_fespace.get(), {trial_fespace.get()});
+  fused.AddDomainIntegral(Dimension<dim>{}, DependsOn<0>{},
+                          fuse(TestThermalIntegratorOne<dim>{}, TestThermalIntegratorOne<dim, true>{}), left);
+
+  double t = 0.0;
+  check_gradient(fused, t, U);
+
+  mfem::Vector r0 = separate(t, U);
+  mfem::Vector r1 = fused(t, U);
+
+  EXPECT_LT(r0.DistanceTo(r1.GetData()), 1.0e-12 * r0.Norml2());
+}
+
+TEST(fused, comparison_quads)
+{
+  auto mesh = mesh::refineAndDistribute(buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/beam-quad.mesh"), 1);
+  fused_integral_comparison_test_impl<2>(mesh);
+}
+
+TEST(fused, comparison_hexes)
+{
+  auto mesh = mesh::refineAndDistribute(buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/beam-hex.mesh"), 1);
+  fused_integral_comparison_test_impl<3>(mesh);
+}
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,173 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils_base.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/numerics/functional/geometry.hpp"
+#include "serac/numerics/functional/quadrature_data.hpp"
+#include "serac/numerics/functional/tensor.hpp"
+
+using namespace serac;
+
+TEST(QuadratureData, SparseStorageOnlyMaterializesModifiedElements)
+{
+  struct State {
+    tensor<double, 3, 3> Fpinv = DenseIdentity<3>();
+    double               accumulated_plastic_strain;
+  };
+
+  SparseQuadratureArray<State> values(100, 8, State{});
+  EXPECT_EQ(values.num_materialized_elements(), 0u);
+
+  // assigning the default value doesn't require any storage
+  values.store(3, 2, State{});
+  EXPECT_EQ(values.num_materialized_elements(), 0u);
+
+  State yielded{};
+  yielded.accumulated_plastic_strain = 0.1;
+  values.store(7, 5, yielded);
+  EXPECT_EQ(values.num_materialized_elements(), 1u);
+
+  EXPECT_EQ(values(7, 5).accumulated_plastic_strain, 0.1);
+  EXPECT_EQ(values(7, 4).accumulated_plastic_strain, 0.0);
+  EXPECT_EQ(values(6, 5).accumulated_plastic_strain, 0.0);
+  EXPECT_EQ(values(6, 5).Fpinv[1][1], 1.0);
+
+  EXPECT_LT(values.memory_footprint(), 100 * 8 * sizeof(State));
+}
+
+TEST(QuadratureData, SparseStorageIsDeepCopied)
+{
+  SparseQuadratureArray<double> values(10, 4, 0.0);
+  values.store(2, 1, 1.0);
+  values.store(5, 3, 2.0);
+
+  // copies have storage of their own, so modifying them doesn't affect the original
+  SparseQuadratureArray<double> copy(values);
+  EXPECT_EQ(copy.num_materialized_elements(), 2u);
+  EXPECT_EQ(copy(2, 1), 1.0);
+  EXPECT_EQ(copy(5, 3), 2.0);
+
+  copy.store(2, 1, 3.0);
+  copy.store(8, 0, 4.0);
+  EXPECT_EQ(values(2, 1), 1.0);
+  EXPECT_EQ(values(8, 0), 0.0);
+  EXPECT_EQ(values.num_materialized_elements(), 2u);
+
+  // assignment replaces the values of every element, including those only materialized in the target
+  values = copy;
+  EXPECT_EQ(values.num_materialized_elements(), 3u);
+  EXPECT_EQ(values(2, 1), 3.0);
+  EXPECT_EQ(values(8, 0), 4.0);
+
+  copy = SparseQuadratureArray<double>(10, 4, 0.0);
+  values.store(5, 3, 5.0);
+  EXPECT_EQ(copy.num_materialized_elements(), 0u);
+  EXPECT_EQ(copy(5, 3), 0.0);
+  EXPECT_EQ(values(5, 3), 5.0);
+
+  // the same goes for whole buffers with sparse storage
+  QuadratureData<double>::geom_array_t elements{}, qpts_per_element{};
+  elements[mfem::Geometry::SQUARE]         = 10;
+  qpts_per_element[mfem::Geometry::SQUARE] = 4;
+
+  QuadratureData<double> buffer(elements, qpts_per_element, 0.0, QuadratureDataStorage::Sparse);
+  buffer.view(mfem::Geometry::SQUARE).store(1, 2, 1.0);
+
+  QuadratureData<double> buffer_copy(buffer);
+  buffer_copy.view(mfem::Geometry::SQUARE).store(1, 2, 2.0);
+  EXPECT_EQ(buffer.view(mfem::Geometry::SQUARE)(1, 2), 1.0);
+
+  buffer = buffer_copy;
+  EXPECT_EQ(buffer.view(mfem::Geometry::SQUARE)(1, 2), 2.0);
+  buffer.view(mfem::Geometry::SQUARE).store(1, 2, 3.0);
+  EXPECT_EQ(buffer_copy.view(mfem::Geometry::SQUARE)(1, 2), 2.0);
+}
+
+TEST(QuadratureData, SparseAndDenseStorageGiveTheSameResults)
+{
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  std::string meshfile = SERAC_REPO_DIR "/data/meshes/patch2D_tris_and_quads.mesh";
+  auto        mesh     = mesh::refineAndDistribute(buildMeshFromFile(meshfile), 1);
+
+  using space = H1<p>;
+
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  auto elements = geometry_counts(*mesh);
+
+  QuadratureData<double>::geom_array_t qpts_per_element{};
+  qpts_per_element[mfem::Geometry::TRIANGLE] = uint32_t(num_quadrature_points(mfem::Geometry::TRIANGLE, p + 1));
+  qpts_per_element[mfem::Geometry::SQUARE]   = uint32_t(num_quadrature_points(mfem::Geometry::SQUARE, p + 1));
+
+  auto dense = std::make_shared<QuadratureData<double>>(elements, qpts_per_element, 0.0);
+  auto sparse =
+      std::make_shared<QuadratureData<double>>(elements, qpts_per_element, 0.0, QuadratureDataStorage::Sparse);
+
+  mfem::Vector U(fespace->TrueVSize());
+  U.Randomize(0);
+
+  mfem::Vector r[2];
+  int          i = 0;
+  for (auto qdata : {dense, sparse}) {
+    Functional<space(space)> residual(fespace.get(), {fespace.get()});
+
+    // only the quadrature points near the left edge of the mesh ever change their state
+    residual.AddDomainIntegral(
+        Dimension<dim>{}, DependsOn<0>{},
+        [](double /*t*/, auto position, auto& state, auto temperature) {
+          auto [X, dX_dxi] = position;
+          auto [u, du_dx]  = temperature;
+          if (X[0] < 0.25) {
+            state += 1.0;
+          }
+          return serac::tuple{u * (1.0 + state), du_dx};
+        },
+        *mesh, qdata);
+
+    residual.updateQdata(true);
+    residual(0.0, U);
+    residual.updateQdata(false);
+    r[i++] = residual(0.0, U);
+  }
+
+  for (int j = 0; j < r[0].Size(); j++) {
+    EXPECT_NEAR(r[0][j], r[1][j], 1.0e-14);
+  }
+
+  uint32_t num_materialized = 0;
+  for (auto& [geom, values] : sparse->sparse_data) {
+    num_materialized += values.num_materialized_elements();
+    for (uint32_t e = 0; e < values.num_elements(); e++) {
+      for (uint32_t q = 0; q < values.qpts_per_element(); q++) {
+        EXPECT_EQ(values(e, q), dense->view(geom)(e, q));
+      }
+    }
+  }
+  EXPECT_GT(num_materialized, 0u);
+  EXPECT_LT(num_materialized, uint32_t(mesh->GetNE()));
+  EXPECT_LT(sparse->memory_footprint(), dense->memory_footprint());
+}
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
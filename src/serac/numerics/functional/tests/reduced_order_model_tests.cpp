@@ -0,0 +1,195 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "serac/mesh/mesh_utils_base.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/numerics/functional/reduced_order_model.hpp"
+
+using namespace serac;
+
+// a nonlinear reaction-diffusion problem, where the time argument plays the role of a load parameter
+struct ReactionDiffusion {
+  template <typename X, typename T>
+  SERAC_HOST_DEVICE auto operator()(double t, X position, T temperature) const
+  {
+    auto [x, dx_dxi] = position;
+    auto [u, du_dx]  = temperature;
+    auto source      = u + u * u * u - t * x[0] * x[1];
+    return serac::tuple{source, du_dx};
+  }
+};
+
+// a nonlinear convective boundary condition
+struct Convection {
+  template <typename X, typename T>
+  SERAC_HOST_DEVICE auto operator()(double /*t*/, X /*position*/, T temperature) const
+  {
+    auto [u, _] = temperature;
+    return u + 0.1 * u * u;
+  }
+};
+
+TEST(ReducedOrderModel, NonnegativeLeastSquares)
+{
+  // the unconstrained solution is (1, -1), so the constrained solution has x[1] == 0
+  mfem::DenseMatrix A(3, 2);
+  A(0, 0) = 1.0, A(0, 1) = 0.0;
+  A(1, 0) = 0.0, A(1, 1) = 1.0;
+  A(2, 0) = 1.0, A(2, 1) = 1.0;
+
+  mfem::Vector b(3);
+  b[0] = 1.0, b[1] = -1.0, b[2] = 0.0;
+
+  mfem::Vector x = nonnegativeLeastSquares(A, b, 1.0e-14);
+  EXPECT_NEAR(x[0], 0.5, 1.0e-12);
+  EXPECT_NEAR(x[1], 0.0, 1.0e-12);
+
+  // consistent systems with a nonnegative solution are solved exactly
+  b[0] = 2.0, b[1] = 3.0, b[2] = 5.0;
+  x    = nonnegativeLeastSquares(A, b, 1.0e-14);
+  EXPECT_NEAR(x[0], 2.0, 1.0e-12);
+  EXPECT_NEAR(x[1], 3.0, 1.0e-12);
+}
+
+TEST(ReducedOrderModel, HyperReducedReactionDiffusion)
+{
+  constexpr int dim = 2;
+  constexpr int p   = 1;
+
+  using space = H1<p>;
+
+  auto mesh           = mesh::refineAndDistribute(buildRectangleMesh(16, 16), 0, 0);
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  Functional<space(space)> residual(fespace.get(), {fespace.get()});
+  residual.AddDomainIntegral(Dimension<dim>{}, DependsOn<0>{}, ReactionDiffusion{}, *mesh);
+  residual.AddBoundaryIntegral(Dimension<dim - 1>{}, DependsOn<0>{}, Convection{}, *mesh);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1.0e-14);
+  cg.SetAbsTol(0.0);
+  cg.SetMaxIter(2000);
+
+  auto solve_full = [&](double t) {
+    mfem::Vector u(fespace->TrueVSize());
+    mfem::Vector du(fespace->TrueVSize());
+    u = 0.0;
+    for (int i = 0; i < 10; i++) {
+      auto [r, dr_du] = residual(t, differentiate_wrt(u));
+      cg.SetOperator(dr_du);
+      cg.Mult(r, du);
+      u -= du;
+    }
+    return u;
+  };
+
+  // offline: snapshots -> POD basis -> element sampling
+  std::vector<double>       training_loads = {10.0, 20.0, 30.0, 40.0, 50.0};
+  std::vector<mfem::Vector> snapshots;
+  for (double t : training_loads) {
+    snapshots.push_back(solve_full(t));
+  }
+
+  ReducedBasis basis = properOrthogonalDecomposition(snapshots, MPI_COMM_WORLD, 1.0e-14);
+  EXPECT_LE(basis.size(), int(snapshots.size()));
+  for (auto& snapshot : snapshots) {
+    EXPECT_LT(basis.projectionError(snapshot), 1.0e-6);
+  }
+  residual.setReducedBasis(basis.modes());
+
+  std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>> projections;
+  std::vector<std::map<mfem::Geometry::Type, mfem::DenseMatrix>> boundary_projections;
+  for (std::size_t i = 0; i < snapshots.size(); i++) {
+    residual(training_loads[i], snapshots[i]);
+    projections.push_back(residual.elementResidualProjections(basis.modes()));
+    boundary_projections.push_back(residual.elementResidualProjections(basis.modes(), Domain::Type::BoundaryElements));
+  }
+
+  ElementSampling sampling =
+      energyConservingSampling(*mesh, projections, boundary_projections, MPI_COMM_WORLD, 1.0e-10);
+
+  int num_sampled[2] = {0, 0};
+  for (auto& [geom, weights] : sampling.weights) {
+    num_sampled[0] += int(weights.size());
+  }
+  for (auto& [geom, weights] : sampling.boundary_weights) {
+    num_sampled[1] += int(weights.size());
+  }
+  MPI_Allreduce(MPI_IN_PLACE, num_sampled, 2, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  EXPECT_GT(num_sampled[0], 0);
+  EXPECT_GT(num_sampled[1], 0);
+  EXPECT_LE(num_sampled[0] + num_sampled[1], basis.size() * int(snapshots.size()));
+
+  Functional<space(space)> hyper_reduced_residual(fespace.get(), {fespace.get()});
+  hyper_reduced_residual.AddDomainIntegral(Dimension<dim>{}, DependsOn<0>{}, ReactionDiffusion{}, sampling.domain);
+  hyper_reduced_residual.AddBoundaryIntegral(Dimension<dim - 1>{}, DependsOn<0>{}, Convection{},
+                                             sampling.boundary_domain);
+  hyper_reduced_residual.setElementWeights(sampling.domain, sampling.weights);
+  hyper_reduced_residual.setElementWeights(sampling.boundary_domain, sampling.boundary_weights);
+  hyper_reduced_residual.setReducedBasis(basis.modes());
+
+  // the sampled elements reproduce the projected residuals of the training snapshots
+  mfem::Vector zero(fespace->TrueVSize());
+  zero = 0.0;
+  for (std::size_t i = 0; i < snapshots.size(); i++) {
+    mfem::Vector exact, approximate, reference;
+    basis.project(residual(training_loads[i], snapshots[i]), exact);
+    basis.project(hyper_reduced_residual(training_loads[i], snapshots[i]), approximate);
+    basis.project(residual(training_loads[i], zero), reference);
+
+    approximate -= exact;
+    EXPECT_LT(approximate.Norml2(), 1.0e-8 * reference.Norml2());
+  }
+
+  // projecting the sampled element matrices agrees with projecting the actions of the jacobian
+  {
+    auto [r, J]                     = hyper_reduced_residual(training_loads[1], differentiate_wrt(snapshots[1]));
+    mfem::DenseMatrix from_elements = J.reducedMatrix();
+    mfem::DenseMatrix from_actions  = basis.project(J);
+    from_elements -= from_actions;
+    EXPECT_LT(from_elements.MaxMaxNorm(), 1.0e-10 * from_actions.MaxMaxNorm());
+  }
+
+  // online: solve for a load that wasn't in the training set
+  double       t = 25.0;
+  mfem::Vector offset(fespace->TrueVSize());
+  offset = 0.0;
+
+  mfem::Vector q(basis.size());
+  q = 0.0;
+  solveReducedNewton(basis, offset, q, [&](const mfem::Vector& u) { return residual(t, differentiate_wrt(u)); });
+
+  mfem::Vector q_hyper(basis.size());
+  q_hyper = 0.0;
+  solveReducedNewton(basis, offset, q_hyper,
+                     [&](const mfem::Vector& u) { return hyper_reduced_residual(t, differentiate_wrt(u)); });
+
+  mfem::Vector u_full = solve_full(t);
+
+  ReducedOrderError reduced_error = fullOrderError(basis, offset, q, u_full);
+  ReducedOrderError hyper_error   = fullOrderError(basis, offset, q_hyper, u_full);
+  EXPECT_LT(reduced_error.solution_error, 1.0e-3);
+  EXPECT_LT(hyper_error.solution_error, 1.0e-2);
+  EXPECT_LE(reduced_error.projection_error, reduced_error.solution_error * (1.0 + 1.0e-10));
+  EXPECT_DOUBLE_EQ(reduced_error.projection_error, hyper_error.projection_error);
+}
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
@@ -504,6 +504,52 @@ TEST(Tensor, EigendecompWith2NearlyDegenerateEigenvalues)
   EXPECT_LT(norm(A - should_be_A), 1e-12);
 }
 
+TEST(Tensor, Eigendecomp2x2OfDegenerate)
+{
+  const double lambda     = 2.5;
+  const auto   A          = lambda * DenseIdentity<2>();
+  auto [eigvals, eigvecs] = eig_symm(A);
+  for (int i = 0; i < 2; i++) {
+    EXPECT_NEAR(eigvals[i], lambda, 1e-12);
+  }
+  EXPECT_LT(norm(dot(eigvecs, transpose(eigvecs)) - DenseIdentity<2>()), 1e-12);
+}
+
+TEST(Tensor, Eigendecomp2x2WithUniqueEigenvalues)
+{
+  const tensor lambda{{2.6, -1.1}};
+  const double theta = 0.3;
+  const mat2   Q{{{std::cos(theta), -std::sin(theta)}, {std::sin(theta), std::cos(theta)}}};
+  const auto   A     = dot(Q, dot(diag(lambda), transpose(Q)));
+
+  auto [eigvals, eigvecs] = eig_symm(A);
+
+  // eigenvalues should be returned in ascending order
+  EXPECT_NEAR(eigvals[0], lambda[1], 1e-12);
+  EXPECT_NEAR(eigvals[1], lambda[0], 1e-12);
+
+  // check eigenvectors by re-assembling the matrix
+  mat2 should_be_A = dot(eigvecs, dot(diag(eigvals), transpose(eigvecs)));
+  EXPECT_LT(norm(should_be_A - A), 1e-12);
+  EXPECT_LT(norm(dot(transpose(eigvecs), eigvecs) - DenseIdentity<2>()), 1e-12);
+}
+
+TEST(Tensor, Eigendecomp2x2With2NearlyDegenerateEigenvalues)
+{
+  const tensor lambda{{2.5, 2.5 + 1e-8}};
+  const double theta = -1.2;
+  const mat2   Q{{{std::cos(theta), -std::sin(theta)}, {std::sin(theta), std::cos(theta)}}};
+  const auto   A     = dot(Q, dot(diag(lambda), transpose(Q)));
+
+  auto [eigvals, eigvecs] = eig_symm(A);
+
+  EXPECT_NEAR(eigvals[0], lambda[0], 1e-12);
+  EXPECT_NEAR(eigvals[1], lambda[1], 1e-12);
+
+  mat2 should_be_A = dot(eigvecs, dot(diag(eigvals), transpose(eigvecs)));
+  EXPECT_LT(norm(A - should_be_A), 1e-12);
+}
+
 TEST(Tensor, LogOfSpherical)
 {
   auto A    = M_E * DenseIdentity<3>();
@@ -633,6 +679,36 @@ TEST(Tensor, SqrtDerivative)
   EXPECT_LT(norm(dsqrtA[0] - dsqrtA[2]), 1.0e-13);
 }
 
+TEST(Tensor, SymmetricMatrixFunctionDerivatives2x2)
+{
+  const tensor lambda{{1.1, 2.6}};
+  const double theta = 0.7;
+  const mat2   Q{{{std::cos(theta), -std::sin(theta)}, {std::sin(theta), std::cos(theta)}}};
+  auto         A = dot(Q, dot(diag(lambda), transpose(Q)));
+
+  // perturbation should be symmetric, or else violates requirement of log_symm
+  const mat2 dA{{{0.2, -0.4}, {-0.4, 0.1}}};
+
+  tensor<dual<double>, 2, 2> Adual = make_tensor<2, 2>([&](int i, int j) { return dual<double>{A[i][j], dA[i][j]}; });
+
+  const double epsilon = 1.0e-6;
+
+  auto check = [&](auto f) {
+    auto df_dA = get_gradient(f(make_dual(A)));
+    mat2 df[3] = {double_dot(df_dA, dA), (f(A + epsilon * dA) - f(A - epsilon * dA)) / (2 * epsilon),
+                  get_gradient(f(Adual))};
+    EXPECT_LT(norm(df[0] - df[1]), 1.0e-8);
+    EXPECT_LT(norm(df[0] - df[2]), 1.0e-13);
+  };
+
+  check([](auto M) { return log_symm(M); });
+  check([](auto M) { return exp_symm(M); });
+  check([](auto M) { return sqrt_symm(M); });
+
+  EXPECT_LT(norm(log_symm(exp_symm(A)) - A), 1e-12);
+  EXPECT_LT(norm(dot(sqrt_symm(A), sqrt_symm(A)) - A), 1e-13);
+}
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -105,6 +105,7 @@ enum class LinearSolver
   GMRES,     /**< Generalized minimal residual method */
   SuperLU,   /**< SuperLU MPI-enabled direct nodal solver */
   Strumpack, /**< Strumpack MPI-enabled direct frontal solver*/
+  MUMPS,     /**< MUMPS MPI-enabled direct multifrontal solver, using a symmetric factorization if possible */
   PetscCG,   /**< PETSc MPI-enabled conjugate gradient solver */
   PetscGMRES /**< PETSc MPI-enabled generalize minimal residual solver */
 };
@@ -122,6 +123,8 @@ inline std::string linearName(const LinearSolver& s)
       return "SuperLU";
     case LinearSolver::Strumpack:
       return "Strumpack";
+    case LinearSolver::MUMPS:
+      return "MUMPS";
     case LinearSolver::PetscCG:
       return "PetscCG";
     case LinearSolver::PetscGMRES:
@@ -134,6 +137,14 @@ inline std::string linearName(const LinearSolver& s)
 /// output linear solver string representation to a stream
 inline std::ostream& operator<<(std::ostream& os, LinearSolver s) { return os << linearName(s); }
 
+/// The symmetry of the linear systems, which determines the factorization used by LinearSolver::MUMPS
+enum class MatrixSymmetry
+{
+  SymmetricPositiveDefinite, /**< Cholesky (LL^T) factorization, e.g. thermal and small-strain solid stiffnesses */
+  SymmetricIndefinite,       /**< LDL^T factorization, e.g. saddle point systems and buckling problems */
+  Unsymmetric                /**< LU factorization */
+};
+
 // Add a custom list of strings? conduit node?
 // Arbitrary string (e.g. json) to define parameters?
 
@@ -189,6 +200,14 @@ inline std::string nonlinearName(const NonlinearSolver& s)
 /// output nonlinear solver string representation to a stream
 inline std::ostream& operator<<(std::ostream& os, NonlinearSolver s) { return os << nonlinearName(s); }
 
+/// How the iterative linear solver's relative tolerance is chosen at each Newton iteration
+enum class ForcingTerm
+{
+  Fixed,            /**< Always use LinearSolverOptions::relative_tol */
+  EisenstatWalker1, /**< Eisenstat-Walker choice 1, from the agreement of the previous linear model and residual */
+  EisenstatWalker2  /**< Eisenstat-Walker choice 2, from the rate of decrease of the nonlinear residual */
+};
+
 /**
  * @brief Solver types supported by AMGX
  */
@@ -298,14 +317,15 @@ inline std::ostream& operator<<(std::ostream& os, PetscPCType s) { return os <<
 /// The type of preconditioner to be used
 enum class Preconditioner
 {
-  HypreJacobi,      /**< Hypre-based Jacobi */
-  HypreL1Jacobi,    /**< Hypre-based L1-scaled Jacobi */
-  HypreGaussSeidel, /**< Hypre-based Gauss-Seidel */
-  HypreAMG,         /**< Hypre's BoomerAMG algebraic multi-grid */
-  HypreILU,         /**< Hypre's Incomplete LU */
-  AMGX,             /**< NVIDIA's AMGX GPU-enabled algebraic multi-grid, GPU builds only */
-  Petsc,            /**< PETSc preconditioner,  */
-  None              /**< No preconditioner used */
+  HypreJacobi,        /**< Hypre-based Jacobi */
+  HypreL1Jacobi,      /**< Hypre-based L1-scaled Jacobi */
+  HypreGaussSeidel,   /**< Hypre-based Gauss-Seidel */
+  HypreAMG,           /**< Hypre's BoomerAMG algebraic multi-grid */
+  HypreILU,           /**< Hypre's Incomplete LU */
+  AMGX,               /**< NVIDIA's AMGX GPU-enabled algebraic multi-grid, GPU builds only */
+  GeometricMultigrid, /**< Geometric multi-grid over a uniform refinement hierarchy of the mesh */
+  Petsc,              /**< PETSc preconditioner,  */
+  None                /**< No preconditioner used */
 };
 // _preconditioners_end
 
@@ -325,6 +345,8 @@ inline std::string preconditionerName(Preconditioner p)
       return "HypreILU";
     case Preconditioner::AMGX:
       return "AMGX";
+    case Preconditioner::GeometricMultigrid:
+      return "GeometricMultigrid";
     case Preconditioner::Petsc:
       return "Petsc";
     case Preconditioner::None:
@@ -352,6 +374,13 @@ struct LinearSolverOptions {
   /// PETSc preconditioner type
   PetscPCType petsc_preconditioner = PetscPCType::JACOBI;
 
+  /// The symmetry of the linear systems, used for LinearSolver::MUMPS (the LU default is safe for the indefinite
+  /// tangents of solid mechanics and contact; the symmetric factorizations are an opt-in)
+  MatrixSymmetry matrix_symmetry = MatrixSymmetry::Unsymmetric;
+
+  /// Polynomial degree of the Chebyshev smoother, used for Preconditioner::GeometricMultigrid
+  int multigrid_smoother_order = 2;
+
   /// Relative tolerance
   double relative_tol = 1.0e-8;
 
@@ -398,6 +427,12 @@ struct NonlinearSolverOptions {
 
   /// Should the gradient be converted to a monolithic matrix
   bool force_monolithic = false;
+
+  /// How the linear solver's relative tolerance is chosen at each iteration (Newton, NewtonLineSearch and TrustRegion)
+  ForcingTerm forcing_term = ForcingTerm::Fixed;
+
+  /// Upper bound on the adaptive (Eisenstat-Walker) linear solver relative tolerance
+  double max_forcing_term = 0.9;
 };
 // _nonlinear_options_end
 
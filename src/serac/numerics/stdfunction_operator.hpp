@@ -97,6 +97,23 @@ public:
   {
   }
 
+  /**
+   * @brief Constructor for a square StdFunctionOperator that defines mfem::Operator::Mult and
+   * mfem::Operator::GetGradient, and a way to evaluate both at once
+   *
+   * @param[in] n The size of the operator
+   * @param[in] function The function that defines the mult (typically residual evaluation) method
+   * @param[in] jacobian The function that defines the GetGradient (typically residual jacobian evaluation) method
+   * @param[in] residual_and_jacobian The function that defines MultAndGetGradient, which evaluates the residual
+   * and its jacobian at the same state (e.g. keeping the residual that comes out of a differentiated evaluation)
+   */
+  StdFunctionOperator(int n, std::function<void(const mfem::Vector&, mfem::Vector&)> function,
+                      std::function<mfem::Operator&(const mfem::Vector&)> jacobian,
+                      std::function<mfem::Operator&(const mfem::Vector&, mfem::Vector&)> residual_and_jacobian)
+      : mfem::Operator(n), function_(function), jacobian_(jacobian), residual_and_jacobian_(residual_and_jacobian)
+  {
+  }
+
   /**
    * @brief The underlying mult (e.g. residual evaluation) method
    *
@@ -113,6 +130,28 @@ public:
    */
   mfem::Operator& GetGradient(const mfem::Vector& k) const { return jacobian_(k); };
 
+  /**
+   * @brief Evaluate the mult (e.g. residual) and GetGradient (e.g. jacobian) methods at the same state
+   *
+   * When the operator was built with a `residual_and_jacobian` function, this takes a single evaluation,
+   * rather than one for the residual and another (that also computes the residual) for the jacobian.
+   *
+   * @param[in] k The current state input vector
+   * @param[out] y output residual vector
+   * @return A non-owning reference to the gradient operator
+   */
+  mfem::Operator& MultAndGetGradient(const mfem::Vector& k, mfem::Vector& y) const
+  {
+    if (residual_and_jacobian_) {
+      return residual_and_jacobian_(k, y);
+    }
+    Mult(k, y);
+    return GetGradient(k);
+  }
+
+  /// @brief Whether MultAndGetGradient evaluates the residual and jacobian together, see MultAndGetGradient
+  bool hasResidualAndGradient() const { return bool(residual_and_jacobian_); }
+
 private:
   /**
    * @brief the function that is used to implement mfem::Operator::Mult
@@ -123,6 +162,11 @@ private:
    * @brief the function that is used to implement mfem::Operator::GetGradient
    */
   std::function<mfem::Operator&(const mfem::Vector&)> jacobian_;
+
+  /**
+   * @brief the (optional) function that is used to implement MultAndGetGradient
+   */
+  std::function<mfem::Operator&(const mfem::Vector&, mfem::Vector&)> residual_and_jacobian_;
 };
 
 }  // namespace serac::mfem_ext
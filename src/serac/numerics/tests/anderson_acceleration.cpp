@@ -0,0 +1,81 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/numerics/anderson_acceleration.hpp"
+
+namespace serac {
+
+// the number of iterations x = g(x) needed to reach a relative residual of 1e-10
+int fixedPointIterations(int depth)
+{
+  // g(x) = M x + c, where M is a contraction with a spectral radius close to 1
+  constexpr int     n = 4;
+  mfem::DenseMatrix M(n);
+  M = 0.0;
+  for (int i = 0; i < n; i++) {
+    M(i, i) = 0.95 - 0.2 * i;
+    if (i + 1 < n) {
+      M(i, i + 1) = 0.1;
+    }
+  }
+  mfem::Vector c(n);
+  c.Randomize(1);
+
+  mfem::Vector x(n), gx(n), f(n);
+  x = 0.0;
+
+  AndersonAcceleration anderson(depth, MPI_COMM_WORLD);
+  for (int k = 0; k < 1000; k++) {
+    M.Mult(x, gx);
+    gx += c;
+
+    subtract(gx, x, f);
+    if (f.Norml2() < 1.0e-10 * c.Norml2()) {
+      return k;
+    }
+
+    anderson.next(x, gx, x);
+    EXPECT_LE(anderson.historySize(), depth);
+  }
+  return 1000;
+}
+
+TEST(AndersonAcceleration, ReducesToFixedPointIteration)
+{
+  // the contraction factor of the slowest mode is 0.95, so the plain iteration is slow
+  EXPECT_GT(fixedPointIterations(0), 300);
+}
+
+TEST(AndersonAcceleration, ConvergesQuicklyOnLinearProblems)
+{
+  // for linear problems, Anderson acceleration with enough history is equivalent to GMRES,
+  // which converges in (at most) n + 1 iterations
+  EXPECT_LE(fixedPointIterations(5), 8);
+  EXPECT_LT(fixedPointIterations(2), fixedPointIterations(0));
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
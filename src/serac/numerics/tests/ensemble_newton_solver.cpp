@@ -0,0 +1,94 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/mesh/mesh_utils_base.hpp"
+#include "serac/numerics/ensemble_newton_solver.hpp"
+#include "serac/numerics/functional/functional.hpp"
+
+namespace serac {
+
+TEST(EnsembleNewtonSolver, SolvesEachSampleOfANonlinearHeatEquation)
+{
+  auto mesh = mesh::refineAndDistribute(mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL), 0, 0);
+
+  using space         = H1<1>;
+  auto [fespace, fec] = generateParFiniteElementSpace<space>(mesh.get());
+
+  // a temperature-dependent conductivity, scaled by a parameter that differs between samples
+  Functional<space(space, space)> residual(fespace.get(), {fespace.get(), fespace.get()});
+  residual.AddDomainIntegral(
+      Dimension<2>{}, DependsOn<0, 1>{},
+      [](double /*t*/, auto /*position*/, auto temperature, auto scale) {
+        auto [u, du_dx] = temperature;
+        auto [k, _]     = scale;
+        return serac::tuple{u * u * u - 1.0, k * (1.0 + u * u) * du_dx};
+      },
+      *mesh);
+
+  mfem::Array<int> essential_dofs;
+  fespace->GetBoundaryTrueDofs(essential_dofs);
+
+  constexpr std::size_t     num_samples = 3;
+  std::vector<mfem::Vector> temperatures(num_samples, mfem::Vector(fespace->TrueVSize()));
+  std::vector<mfem::Vector> scales(num_samples, mfem::Vector(fespace->TrueVSize()));
+  for (std::size_t s = 0; s < num_samples; s++) {
+    temperatures[s] = 0.0;
+    scales[s]       = 0.5 * double(s + 1);
+  }
+
+  NonlinearSolverOptions nonlinear_options{.relative_tol = 1.0e-10, .absolute_tol = 1.0e-12, .max_iterations = 20};
+  LinearSolverOptions    linear_options{.linear_solver = LinearSolver::GMRES, .relative_tol = 1.0e-12};
+
+  EnsembleNewtonSolver solver(nonlinear_options, linear_options, MPI_COMM_WORLD);
+  solver.setEssentialDofs(essential_dofs);
+  solver.solve(
+      [&](const std::vector<mfem::Vector>& u, std::vector<mfem::Vector>& r, std::vector<mfem::Operator*>& J) {
+        auto [values, dr_du] = residual.evaluateEnsemble(0.0, differentiate_wrt(u), scales);
+        r                    = values;
+        for (uint32_t s = 0; s < dr_du.size(); s++) {
+          J[s] = &dr_du[s];
+        }
+      },
+      temperatures);
+
+  EXPECT_TRUE(solver.converged());
+
+  // check each solution against a separate evaluation of its own residual
+  for (std::size_t s = 0; s < num_samples; s++) {
+    EXPECT_GT(solver.iterations()[s], 1);
+
+    mfem::Vector r = residual(0.0, temperatures[s], scales[s]);
+    r.SetSubVector(essential_dofs, 0.0);
+    EXPECT_LT(r.Norml2(), 1.0e-9);
+  }
+
+  // samples with a smaller conductivity get warmer
+  EXPECT_GT(temperatures[0].Normlinf(), temperatures[1].Normlinf());
+  EXPECT_GT(temperatures[1].Normlinf(), temperatures[2].Normlinf());
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
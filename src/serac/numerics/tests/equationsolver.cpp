@@ -11,6 +11,7 @@
 #include <gtest/gtest.h>
 #include "mfem.hpp"
 
+#include "serac/mesh/mesh_utils_base.hpp"
 #include "serac/numerics/equation_solver.hpp"
 #include "serac/numerics/stdfunction_operator.hpp"
 #include "serac/numerics/functional/functional.hpp"
@@ -135,9 +136,14 @@ auto nonlinear_solvers = testing::Values(
 
 /**
  * @brief Linear solvers to test. Always includes LinearSolver::CG, LinearSolver::GMRES, and LinearSolver::SuperLU.
+ * If MFEM_USE_MUMPS is set, adds LinearSolver::MUMPS.
  * If MFEM_USE_PETSC and SERAC_USE_PETSC are set, adds LinearSolver::PetscCG and LinearSolver::PetscGMRES.
  */
 auto linear_solvers = testing::Values(LinearSolver::CG, LinearSolver::GMRES, LinearSolver::SuperLU
+#ifdef MFEM_USE_MUMPS
+                                      ,
+                                      LinearSolver::MUMPS
+#endif
 #ifdef SERAC_USE_PETSC
                                       ,
                                       LinearSolver::PetscCG, LinearSolver::PetscGMRES
@@ -162,6 +168,269 @@ INSTANTIATE_TEST_SUITE_P(AllEquationSolverTests, EquationSolverSuite,
                            return name;
                          });
 
+TEST(GeometricMultigrid, ConvergesOnRefinementHierarchy)
+{
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  using space = H1<p>;
+
+  auto levels =
+      mesh::refineAndDistributeHierarchy(mfem::Mesh::MakeCartesian2D(4, 4, mfem::Element::QUADRILATERAL), 0, 3);
+  auto fine_mesh = std::move(levels.back());
+  levels.pop_back();
+
+  auto [fes, fec] = serac::generateParFiniteElementSpace<space>(fine_mesh.get());
+
+  Functional<space(space)> residual(fes.get(), {fes.get()});
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto, auto scalar) {
+        auto [u, du_dx] = scalar;
+        return serac::tuple{u, du_dx};
+      },
+      *fine_mesh);
+
+  mfem::Vector U(fes->TrueVSize());
+  U               = 0.0;
+  auto [r, dr_du] = residual(0.0, differentiate_wrt(U));
+  auto J          = assemble(dr_du);
+
+  GeometricMultigrid multigrid(2, 0, MPI_COMM_WORLD);
+  multigrid.setHierarchy(levels, *fes);
+  EXPECT_EQ(multigrid.numLevels(), 4);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1.0e-10);
+  cg.SetAbsTol(0.0);
+  cg.SetMaxIter(100);
+  cg.SetOperator(*J);
+  cg.SetPreconditioner(multigrid);
+
+  mfem::Vector b(fes->TrueVSize());
+  mfem::Vector x(fes->TrueVSize());
+  b.Randomize(0);
+  x = 0.0;
+  cg.Mult(b, x);
+
+  // a geometric multigrid V-cycle should converge in a small, mesh-independent number of iterations
+  EXPECT_TRUE(cg.GetConverged());
+  EXPECT_LT(cg.GetNumIterations(), 25);
+}
+
+TEST(ForcingTerm, EisenstatWalkerConverges)
+{
+  auto pmesh = mesh::refineAndDistribute(mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL), 0, 1);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  using space = H1<p>;
+
+  auto [fes, fec] = serac::generateParFiniteElementSpace<space>(pmesh.get());
+
+  Functional<space(space)> residual(fes.get(), {fes.get()});
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto, auto scalar) {
+        auto [u, du_dx] = scalar;
+        return serac::tuple{u + u * u * u - 1.0, du_dx};
+      },
+      *pmesh);
+
+  std::unique_ptr<mfem::HypreParMatrix> J;
+
+  StdFunctionOperator residual_opr(
+      fes->TrueVSize(), [&residual](const mfem::Vector& x, mfem::Vector& r) { r = residual(0.0, x); },
+      [&residual, &J](const mfem::Vector& x) -> mfem::Operator& {
+        auto [val, grad] = residual(0.0, differentiate_wrt(x));
+        J                = assemble(grad);
+        return *J;
+      });
+
+  const LinearSolverOptions lin_opts = {.linear_solver  = LinearSolver::CG,
+                                        .preconditioner = Preconditioner::HypreJacobi,
+                                        .relative_tol   = 1.0e-10,
+                                        .absolute_tol   = 1.0e-14,
+                                        .max_iterations = 500,
+                                        .print_level    = 0};
+
+  mfem::Vector reference;
+  for (auto forcing_term : {ForcingTerm::Fixed, ForcingTerm::EisenstatWalker1, ForcingTerm::EisenstatWalker2}) {
+    for (auto nonlin_solver : {NonlinearSolver::Newton, NonlinearSolver::TrustRegion}) {
+      const NonlinearSolverOptions nonlin_opts = {.nonlin_solver  = nonlin_solver,
+                                                  .relative_tol   = 1.0e-8,
+                                                  .absolute_tol   = 1.0e-12,
+                                                  .max_iterations = 50,
+                                                  .print_level    = 1,
+                                                  .forcing_term   = forcing_term};
+
+      EquationSolver eq_solver(nonlin_opts, lin_opts);
+      eq_solver.setOperator(residual_opr);
+
+      mfem::Vector x(fes->TrueVSize());
+      x = 0.0;
+      eq_solver.solve(x);
+
+      EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+      if (reference.Size() == 0) {
+        reference = x;
+      } else {
+        x -= reference;
+        EXPECT_LT(x.Normlinf(), 1.0e-6);
+      }
+    }
+  }
+}
+
+TEST(NewtonSolver, EvaluatesResidualAndJacobianTogether)
+{
+  auto pmesh = mesh::refineAndDistribute(mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL), 0, 1);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  using space = H1<p>;
+
+  auto [fes, fec] = serac::generateParFiniteElementSpace<space>(pmesh.get());
+
+  Functional<space(space)> residual(fes.get(), {fes.get()});
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto, auto scalar) {
+        auto [u, du_dx] = scalar;
+        return serac::tuple{u + u * u * u - 1.0, du_dx};
+      },
+      *pmesh);
+
+  std::unique_ptr<mfem::HypreParMatrix> J;
+
+  // the number of residual evaluations (with or without differentiation)
+  int evaluations = 0;
+
+  auto residual_fn = [&](const mfem::Vector& x, mfem::Vector& r) {
+    evaluations++;
+    r = residual(0.0, x);
+  };
+
+  auto jacobian_fn = [&](const mfem::Vector& x) -> mfem::Operator& {
+    evaluations++;
+    auto [val, grad] = residual(0.0, differentiate_wrt(x));
+    J                = assemble(grad);
+    return *J;
+  };
+
+  auto residual_and_jacobian_fn = [&](const mfem::Vector& x, mfem::Vector& r) -> mfem::Operator& {
+    evaluations++;
+    auto [val, grad] = residual(0.0, differentiate_wrt(x));
+    r                = val;
+    J                = assemble(grad);
+    return *J;
+  };
+
+  StdFunctionOperator separate_opr(fes->TrueVSize(), residual_fn, jacobian_fn);
+  StdFunctionOperator combined_opr(fes->TrueVSize(), residual_fn, jacobian_fn, residual_and_jacobian_fn);
+
+  const NonlinearSolverOptions nonlin_opts = {.nonlin_solver  = NonlinearSolver::Newton,
+                                              .relative_tol   = 1.0e-10,
+                                              .absolute_tol   = 1.0e-12,
+                                              .max_iterations = 20,
+                                              .print_level    = 1};
+
+  const LinearSolverOptions lin_opts = {.linear_solver  = LinearSolver::CG,
+                                        .preconditioner = Preconditioner::HypreJacobi,
+                                        .relative_tol   = 1.0e-12,
+                                        .absolute_tol   = 1.0e-14,
+                                        .max_iterations = 500,
+                                        .print_level    = 0};
+
+  mfem::Vector solutions[2];
+  int          num_evaluations[2];
+  for (int i = 0; i < 2; i++) {
+    EquationSolver eq_solver(nonlin_opts, lin_opts);
+    eq_solver.setOperator(i == 0 ? separate_opr : combined_opr);
+
+    evaluations = 0;
+    solutions[i].SetSize(fes->TrueVSize());
+    solutions[i] = 0.0;
+    eq_solver.solve(solutions[i]);
+    num_evaluations[i] = evaluations;
+
+    EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+  }
+
+  // the same iterates, but the residual evaluations at the full Newton steps also provide the jacobian
+  solutions[1] -= solutions[0];
+  EXPECT_LT(solutions[1].Normlinf(), 1.0e-12);
+  EXPECT_LT(num_evaluations[1], num_evaluations[0]);
+}
+
+#ifdef MFEM_USE_MUMPS
+
+TEST(MUMPSSolver, ReusesSymbolicAnalysis)
+{
+  auto pmesh = mesh::refineAndDistribute(mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL), 0, 1);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  using space = H1<p>;
+
+  auto [fes, fec] = serac::generateParFiniteElementSpace<space>(pmesh.get());
+
+  Functional<space(space)> residual(fes.get(), {fes.get()});
+  residual.AddDomainIntegral(
+      Dimension<dim>{}, DependsOn<0>{},
+      [](double /*t*/, auto, auto scalar) {
+        auto [u, du_dx] = scalar;
+        return serac::tuple{u + u * u * u - 1.0, du_dx};
+      },
+      *pmesh);
+
+  std::unique_ptr<mfem::HypreParMatrix> J;
+
+  StdFunctionOperator residual_opr(
+      fes->TrueVSize(), [&residual](const mfem::Vector& x, mfem::Vector& r) { r = residual(0.0, x); },
+      [&residual, &J](const mfem::Vector& x) -> mfem::Operator& {
+        auto [val, grad] = residual(0.0, differentiate_wrt(x));
+        J                = assemble(grad);
+        return *J;
+      });
+
+  const NonlinearSolverOptions nonlin_opts = {.nonlin_solver  = NonlinearSolver::Newton,
+                                              .relative_tol   = 1.0e-10,
+                                              .absolute_tol   = 1.0e-12,
+                                              .max_iterations = 20,
+                                              .print_level    = 1};
+
+  mfem::Vector reference;
+  for (auto symmetry : {MatrixSymmetry::SymmetricPositiveDefinite, MatrixSymmetry::SymmetricIndefinite,
+                        MatrixSymmetry::Unsymmetric}) {
+    EquationSolver eq_solver(nonlin_opts, {.linear_solver = LinearSolver::MUMPS, .matrix_symmetry = symmetry});
+    eq_solver.setOperator(residual_opr);
+
+    mfem::Vector x(fes->TrueVSize());
+    x = 0.0;
+    eq_solver.solve(x);
+
+    EXPECT_TRUE(eq_solver.nonlinearSolver().GetConverged());
+    EXPECT_GT(eq_solver.nonlinearSolver().GetNumIterations(), 1);
+
+    // every Newton iteration has the same sparsity pattern, so only the first one needs a symbolic analysis
+    auto& mumps = dynamic_cast<serac::MUMPSSolver&>(eq_solver.linearSolver());
+    EXPECT_EQ(mumps.numAnalyses(), 1);
+
+    if (reference.Size() == 0) {
+      reference = x;
+    } else {
+      x -= reference;
+      EXPECT_LT(x.Normlinf(), 1.0e-8);
+    }
+  }
+}
+
+#endif
+
 int main(int argc, char* argv[])
 {
   testing::InitGoogleTest(&argc, argv);
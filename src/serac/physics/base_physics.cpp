@@ -377,6 +377,42 @@ std::unordered_map<std::string, FiniteElementState> BasePhysics::getCheckpointed
   return previous_states_map;
 }
 
+void BasePhysics::revertTimestep(double dt)
+{
+  SLIC_ERROR_ROOT_IF(cycle_ <= min_cycle_,
+                     axom::fmt::format("No timestep to revert in physics module {}, it is at its initial cycle {}.",
+                                       name_, cycle_));
+
+  if (checkpoint_to_disk_) {
+    std::vector<FiniteElementState*> states;
+    for (const auto& state_name : stateNames()) {
+      states.emplace_back(const_cast<FiniteElementState*>(&state(state_name)));
+    }
+    StateManager::loadCheckpointedStates(cycle_ - 1, states);
+    cached_checkpoint_cycle_.reset();
+  } else {
+    for (const auto& state_name : stateNames()) {
+      auto& checkpoints = checkpoint_states_.at(state_name);
+      const_cast<FiniteElementState&>(state(state_name)) = checkpoints[static_cast<size_t>(cycle_ - 1)];
+
+      // the repeated timestep will checkpoint its own states
+      if (checkpoints.size() > static_cast<size_t>(cycle_)) {
+        checkpoints.erase(checkpoints.begin() + cycle_, checkpoints.end());
+      }
+    }
+  }
+
+  // forget the timestep increment, unless it was recorded by an earlier forward pass
+  if (cycle_ == max_cycle_ && !timesteps_.empty()) {
+    timesteps_.pop_back();
+    max_cycle_ -= 1;
+    max_time_ -= dt;
+  }
+
+  cycle_ -= 1;
+  time_ -= dt;
+}
+
 double BasePhysics::getCheckpointedTimestep(int cycle) const
 {
   SLIC_ERROR_ROOT_IF(cycle < 0, axom::fmt::format("Negative cycle number requested for physics module {}.", name_));
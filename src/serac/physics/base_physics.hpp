@@ -413,6 +413,18 @@ public:
    */
   virtual void advanceTimestep(double dt) = 0;
 
+  /**
+   * @brief Undo the most recent call to advanceTimestep(), so that the timestep can be repeated
+   *
+   * The primal states are restored from the checkpoint of the previous cycle, and the cycle and time are rewound.
+   * This is used by staggered coupling schemes that iterate on a timestep until the coupled fields agree.
+   *
+   * @param dt The increment of simulation time taken by the timestep being undone
+   *
+   * @note Material state (quadrature data) is not checkpointed, so it is not restored by this method
+   */
+  virtual void revertTimestep(double dt);
+
   /**
    * @brief Set the loads for the adjoint reverse timestep solve
    */
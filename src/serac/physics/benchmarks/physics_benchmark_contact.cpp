@@ -0,0 +1,135 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <set>
+#include <string>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/physics/contact/contact_data.hpp"
+#include "serac/physics/materials/solid_material.hpp"
+#include "serac/physics/state/state_manager.hpp"
+#include "serac/physics/solid_mechanics_contact.hpp"
+
+// Compares the per-step cost of the contact methods on the beam bending problem of examples/contact: Tribol's single
+// mortar method against the node-to-surface method. The contact update alone (closest point search or mortar
+// integration, then penalty pressures, forces and Jacobian) is timed first, then the full quasi-static solve.
+
+constexpr int num_steps = 4;
+
+const std::string mesh_file = SERAC_REPO_DIR "/data/meshes/beam-hex-with-contact-block.mesh";
+
+serac::ContactOptions penalty_contact(serac::ContactMethod method)
+{
+  return {.method      = method,
+          .enforcement = serac::ContactEnforcement::Penalty,
+          .type        = serac::ContactType::Frictionless,
+          .penalty     = 1.0e3};
+}
+
+void contact_update(serac::ContactMethod method)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  auto mesh = serac::mesh::refineAndDistribute(serac::buildMeshFromFile(mesh_file), 2, 0);
+
+  serac::ContactData contact(*mesh);
+  contact.addContactInteraction(0, {7}, {5}, penalty_contact(method));
+
+  double dt = 1.0;
+  for (int i = 0; i < num_steps; i++) {
+    // same sequence of calls as ContactData::residualFunction() and ContactData::jacobianFunction()
+    SERAC_MARK_BEGIN("contact update");
+    contact.update(i, i * dt, dt);
+    contact.setPressures(mfem::Vector());
+    contact.update(i, i * dt, dt);
+    auto f = contact.forces();
+    auto J = contact.mergedJacobian();
+    SERAC_MARK_END("contact update");
+  }
+}
+
+void contact_solve(serac::ContactMethod method, const std::string& name)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 1;
+  constexpr int dim = 3;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, name + "_data");
+
+  auto mesh = serac::mesh::refineAndDistribute(serac::buildMeshFromFile(mesh_file), 2, 0);
+  serac::StateManager::setMesh(std::move(mesh), "beam_mesh");
+
+  serac::LinearSolverOptions linear_options{.linear_solver = serac::LinearSolver::Strumpack, .print_level = 0};
+
+  serac::NonlinearSolverOptions nonlinear_options{.nonlin_solver  = serac::NonlinearSolver::Newton,
+                                                  .relative_tol   = 1.0e-10,
+                                                  .absolute_tol   = 1.0e-10,
+                                                  .max_iterations = 200,
+                                                  .print_level    = 0};
+
+  serac::SolidMechanicsContact<p, dim> solid_solver(nonlinear_options, linear_options,
+                                                    serac::solid_mechanics::default_quasistatic_options,
+                                                    serac::GeometricNonlinearities::On, name, "beam_mesh");
+
+  solid_solver.setMaterial(serac::solid_mechanics::NeoHookean{.density = 1.0, .K = 10.0, .G = 0.25});
+
+  solid_solver.setDisplacementBCs({1}, [](const mfem::Vector&, mfem::Vector& u) {
+    u.SetSize(dim);
+    u = 0.0;
+  });
+  solid_solver.setDisplacementBCs({6}, [](const mfem::Vector&, double t, mfem::Vector& u) {
+    u.SetSize(dim);
+    u    = 0.0;
+    u[2] = -0.05 * t;
+  });
+
+  solid_solver.addContactInteraction(0, {7}, {5}, penalty_contact(method));
+  solid_solver.completeSetup();
+
+  for (int i = 0; i < num_steps; i++) {
+    SERAC_MARK_BEGIN("contact step");
+    solid_solver.advanceTimestep(1.0);
+    SERAC_MARK_END("contact step");
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  serac::profiling::initialize();
+
+  SERAC_SET_METADATA("test", "contact");
+
+  SERAC_MARK_BEGIN("Single Mortar");
+  contact_update(serac::ContactMethod::SingleMortar);
+#ifdef MFEM_USE_STRUMPACK
+  contact_solve(serac::ContactMethod::SingleMortar, "contact_mortar");
+#endif
+  SERAC_MARK_END("Single Mortar");
+
+  SERAC_MARK_BEGIN("Node To Surface");
+  contact_update(serac::ContactMethod::NodeToSurface);
+#ifdef MFEM_USE_STRUMPACK
+  contact_solve(serac::ContactMethod::NodeToSurface, "contact_node_to_surface");
+#endif
+  SERAC_MARK_END("Node To Surface");
+
+  serac::profiling::finalize();
+
+  MPI_Finalize();
+
+  return 0;
+}
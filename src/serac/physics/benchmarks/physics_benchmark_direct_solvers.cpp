@@ -0,0 +1,159 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <set>
+#include <string>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/physics/materials/solid_material.hpp"
+#include "serac/physics/materials/thermal_material.hpp"
+#include "serac/physics/state/state_manager.hpp"
+#include "serac/physics/heat_transfer.hpp"
+#include "serac/physics/solid_mechanics.hpp"
+
+// Compares the sparse direct solvers on SPD systems: the general LU factorizations (SuperLU, Strumpack) against
+// the symmetric ones (MUMPS Cholesky and LDL^T). Each problem takes a few quasi-static steps, so that the later
+// factorizations can reuse the symbolic analysis of the first one.
+
+constexpr int num_steps = 3;
+
+template <int p>
+void thermal_static(serac::LinearSolverOptions linear_options)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_direct_solve");
+
+  auto mesh = serac::mesh::refineAndDistribute(serac::buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/beam-hex.mesh"),
+                                               1, 1);
+  serac::StateManager::setMesh(std::move(mesh), "default_mesh");
+
+  serac::HeatTransfer<p, 3> thermal_solver(serac::heat_transfer::default_nonlinear_options, linear_options,
+                                           serac::heat_transfer::default_static_options, "thermal_direct",
+                                           "default_mesh");
+
+  thermal_solver.setMaterial(serac::heat_transfer::LinearIsotropicConductor(1.0, 1.0, 1.0));
+  std::set<int> ess_bdr = {1};
+  thermal_solver.setTemperatureBCs(ess_bdr, [](const mfem::Vector&, double t) { return t; });
+  thermal_solver.setTemperature([](const mfem::Vector&, double) { return 0.0; });
+  thermal_solver.setSource(serac::heat_transfer::ConstantSource{1.0});
+  thermal_solver.completeSetup();
+
+  for (int i = 0; i < num_steps; i++) {
+    thermal_solver.advanceTimestep(1.0);
+  }
+}
+
+template <int p>
+void solid_static(serac::LinearSolverOptions linear_options)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_direct_solve");
+
+  auto mesh = serac::mesh::refineAndDistribute(serac::buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/beam-hex.mesh"),
+                                               1, 1);
+  serac::StateManager::setMesh(std::move(mesh), "default_mesh");
+
+  serac::SolidMechanics<p, 3> solid_solver(
+      serac::solid_mechanics::default_nonlinear_options, linear_options,
+      serac::solid_mechanics::default_quasistatic_options, serac::GeometricNonlinearities::Off, "solid_direct",
+      "default_mesh");
+
+  solid_solver.setMaterial(serac::solid_mechanics::LinearIsotropic{.density = 1.0, .K = 1.0, .G = 1.0});
+
+  auto zero_displacement = [](const mfem::Vector&, mfem::Vector& u) { u = 0.0; };
+  auto translated_in_z   = [](const mfem::Vector&, double t, mfem::Vector& u) {
+    u    = 0.0;
+    u[2] = 0.01 * t;
+  };
+  std::set<int> support = {1};
+  std::set<int> tip     = {2};
+  solid_solver.setDisplacementBCs(support, zero_displacement);
+  solid_solver.setDisplacementBCs(tip, translated_in_z);
+  solid_solver.setDisplacement(zero_displacement);
+  solid_solver.completeSetup();
+
+  for (int i = 0; i < num_steps; i++) {
+    solid_solver.advanceTimestep(1.0);
+  }
+}
+
+template <int p>
+void compare_direct_solvers()
+{
+  serac::LinearSolverOptions superlu{.linear_solver = serac::LinearSolver::SuperLU};
+
+  SERAC_MARK_BEGIN("SuperLU LU");
+  thermal_static<p>(superlu);
+  solid_static<p>(superlu);
+  SERAC_MARK_END("SuperLU LU");
+
+#ifdef MFEM_USE_STRUMPACK
+  serac::LinearSolverOptions strumpack{.linear_solver = serac::LinearSolver::Strumpack};
+
+  SERAC_MARK_BEGIN("Strumpack LU");
+  thermal_static<p>(strumpack);
+  solid_static<p>(strumpack);
+  SERAC_MARK_END("Strumpack LU");
+#endif
+
+#ifdef MFEM_USE_MUMPS
+  serac::LinearSolverOptions mumps_lu{.linear_solver   = serac::LinearSolver::MUMPS,
+                                      .matrix_symmetry = serac::MatrixSymmetry::Unsymmetric};
+  serac::LinearSolverOptions mumps_ldlt{.linear_solver   = serac::LinearSolver::MUMPS,
+                                        .matrix_symmetry = serac::MatrixSymmetry::SymmetricIndefinite};
+  serac::LinearSolverOptions mumps_cholesky{.linear_solver   = serac::LinearSolver::MUMPS,
+                                            .matrix_symmetry = serac::MatrixSymmetry::SymmetricPositiveDefinite};
+
+  SERAC_MARK_BEGIN("MUMPS LU");
+  thermal_static<p>(mumps_lu);
+  solid_static<p>(mumps_lu);
+  SERAC_MARK_END("MUMPS LU");
+
+  SERAC_MARK_BEGIN("MUMPS LDLT");
+  thermal_static<p>(mumps_ldlt);
+  solid_static<p>(mumps_ldlt);
+  SERAC_MARK_END("MUMPS LDLT");
+
+  SERAC_MARK_BEGIN("MUMPS Cholesky");
+  thermal_static<p>(mumps_cholesky);
+  solid_static<p>(mumps_cholesky);
+  SERAC_MARK_END("MUMPS Cholesky");
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  serac::profiling::initialize();
+
+  SERAC_SET_METADATA("test", "direct_solvers");
+
+  SERAC_MARK_BEGIN("3D Linear");
+  compare_direct_solvers<1>();
+  SERAC_MARK_END("3D Linear");
+
+  SERAC_MARK_BEGIN("3D Quadratic");
+  compare_direct_solvers<2>();
+  SERAC_MARK_END("3D Quadratic");
+
+  serac::profiling::finalize();
+
+  MPI_Finalize();
+
+  return 0;
+}
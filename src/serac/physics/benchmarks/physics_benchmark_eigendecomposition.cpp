@@ -0,0 +1,104 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <random>
+#include <vector>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/numerics/functional/tensor.hpp"
+#include "serac/numerics/functional/tuple_tensor_dual_functions.hpp"
+
+// random symmetric matrices, like the strain measures seen at quadrature points
+template <int dim>
+std::vector<serac::tensor<double, dim, dim>> random_symmetric_matrices(int n)
+{
+  std::mt19937                           rng(42);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+
+  std::vector<serac::tensor<double, dim, dim>> matrices(static_cast<std::size_t>(n));
+  for (auto& A : matrices) {
+    auto B = serac::make_tensor<dim, dim>([&](int, int) { return uniform(rng); });
+    A      = serac::DenseIdentity<dim>() + 0.1 * serac::sym(B);
+  }
+  return matrices;
+}
+
+template <int dim>
+void eigendecomposition_benchmark(int n)
+{
+  auto matrices = random_symmetric_matrices<dim>(n);
+
+  // accumulate results so the compiler can't skip any of the work
+  double checksum = 0.0;
+
+  SERAC_MARK_BEGIN("closed-form eig_symm");
+  for (const auto& A : matrices) {
+    auto [lambda, Q] = serac::eig_symm(A);
+    checksum += lambda[0] + Q[0][0];
+  }
+  SERAC_MARK_END("closed-form eig_symm");
+
+  SERAC_MARK_BEGIN("mfem::DenseMatrixEigensystem");
+  for (const auto& A : matrices) {
+    mfem::DenseMatrix matA(dim, dim);
+    for (int i = 0; i < dim; i++) {
+      for (int j = 0; j < dim; j++) {
+        matA(i, j) = A[i][j];
+      }
+    }
+    mfem::DenseMatrixEigensystem eig_sys(matA);
+    eig_sys.Eval();
+    checksum += eig_sys.Eigenvalue(0) + eig_sys.Eigenvector(0)[0];
+  }
+  SERAC_MARK_END("mfem::DenseMatrixEigensystem");
+
+  SERAC_MARK_BEGIN("eigenvalues (dual)");
+  for (const auto& A : matrices) {
+    checksum += serac::get_value(serac::eigenvalues(serac::make_dual(A))[0]);
+  }
+  SERAC_MARK_END("eigenvalues (dual)");
+
+  SERAC_MARK_BEGIN("log_symm (dual)");
+  for (const auto& A : matrices) {
+    checksum += serac::get_value(serac::log_symm(serac::make_dual(A))[0][0]);
+  }
+  SERAC_MARK_END("log_symm (dual)");
+
+  SLIC_INFO(axom::fmt::format("dimension {} checksum: {}", dim, checksum));
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  // Initialize profiling
+  serac::profiling::initialize();
+
+  // Add metadata
+  SERAC_SET_METADATA("test", "eigendecomposition");
+
+  int n = 1000000;
+
+  SERAC_MARK_BEGIN("2x2");
+  eigendecomposition_benchmark<2>(n);
+  SERAC_MARK_END("2x2");
+
+  SERAC_MARK_BEGIN("3x3");
+  eigendecomposition_benchmark<3>(n);
+  SERAC_MARK_END("3x3");
+
+  // Finalize profiling
+  serac::profiling::finalize();
+
+  MPI_Finalize();
+
+  return 0;
+}
@@ -12,6 +12,7 @@
 #include "serac/serac_config.hpp"
 #include "serac/infrastructure/profiling.hpp"
 #include "serac/mesh/mesh_utils.hpp"
+#include "serac/numerics/functional/shape_aware_functional.hpp"
 #include "serac/physics/materials/thermal_material.hpp"
 #include "serac/physics/state/state_manager.hpp"
 #include "serac/physics/heat_transfer.hpp"
@@ -75,6 +76,279 @@ void functional_test(int parallel_refinement)
   SERAC_MARK_END("assemble gradient");
 }
 
+// Times ShapeAwareFunctional with a vanishing shape displacement (where the shape correction is skipped) against
+// the same residual with a small nonzero shape displacement
+template <int p, int dim>
+void shape_aware_functional_test(int parallel_refinement)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int serial_refinement = 1;
+
+  std::string filename =
+      (dim == 2) ? SERAC_REPO_DIR "/data/meshes/star.mesh" : SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto mesh =
+      serac::mesh::refineAndDistribute(serac::buildMeshFromFile(filename), serial_refinement, parallel_refinement);
+
+  using space                     = serac::H1<p>;
+  using shape_space               = serac::H1<p, dim>;
+  auto [fespace, fec]             = serac::generateParFiniteElementSpace<space>(mesh.get());
+  auto [shape_fespace, shape_fec] = serac::generateParFiniteElementSpace<shape_space>(mesh.get());
+
+  serac::ShapeAwareFunctional<shape_space, space(space)> residual(shape_fespace.get(), fespace.get(), {fespace.get()});
+
+  residual.AddDomainIntegral(
+      serac::Dimension<dim>{}, serac::DependsOn<0>{},
+      [](double /*t*/, auto /*x*/, auto phi) {
+        auto [u, du_dx] = phi;
+        return serac::tuple{u, du_dx};
+      },
+      *mesh);
+
+  mfem::ParGridFunction u_global(fespace.get());
+  u_global.Randomize();
+
+  mfem::Vector U(fespace->TrueVSize());
+  u_global.GetTrueDofs(U);
+
+  mfem::Vector zero_shape(shape_fespace->TrueVSize());
+  zero_shape = 0.0;
+
+  mfem::Vector nonzero_shape(shape_fespace->TrueVSize());
+  nonzero_shape.Randomize();
+  nonzero_shape *= 1.0e-3;
+
+  double t = 0.0;
+
+  auto time_evaluations = [&](const mfem::Vector& shape) {
+    SERAC_MARK_BEGIN("residual evaluation");
+    mfem::Vector r1 = residual(t, shape, U);
+    SERAC_MARK_END("residual evaluation");
+
+    SERAC_MARK_BEGIN("compute gradient");
+    auto [r2, drdU] = residual(t, shape, serac::differentiate_wrt(U));
+    SERAC_MARK_END("compute gradient");
+
+    SERAC_MARK_BEGIN("apply gradient");
+    mfem::Vector g = drdU(U);
+    SERAC_MARK_END("apply gradient");
+  };
+
+  SERAC_MARK_BEGIN("zero shape");
+  time_evaluations(zero_shape);
+  SERAC_MARK_END("zero shape");
+
+  SERAC_MARK_BEGIN("nonzero shape");
+  time_evaluations(nonzero_shape);
+  SERAC_MARK_END("nonzero shape");
+}
+
+// Times repeated evaluations that only change the first argument (as in a line search), with and without memoizing
+// the output of the volume integral, which only depends on the second argument
+template <int p, int dim>
+void memoized_functional_test(int parallel_refinement)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int serial_refinement = 1;
+
+  std::string filename =
+      (dim == 2) ? SERAC_REPO_DIR "/data/meshes/star.mesh" : SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto mesh =
+      serac::mesh::refineAndDistribute(serac::buildMeshFromFile(filename), serial_refinement, parallel_refinement);
+
+  using space         = serac::H1<p>;
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  mfem::ParGridFunction u_global(fespace.get());
+  u_global.Randomize();
+
+  mfem::Vector U(fespace->TrueVSize());
+  mfem::Vector V(fespace->TrueVSize());
+  u_global.GetTrueDofs(U);
+  u_global.GetTrueDofs(V);
+
+  double t = 0.0;
+
+  for (bool memoize : {false, true}) {
+    serac::Functional<space(space, space)> residual(fespace.get(), {fespace.get(), fespace.get()});
+
+    residual.AddDomainIntegral(
+        serac::Dimension<dim>{}, serac::DependsOn<1>{},
+        [](double /*t*/, auto /*x*/, auto phi) {
+          auto [v, dv_dx] = phi;
+          return serac::tuple{v * v * v, (1.0 + v * v) * dv_dx};
+        },
+        *mesh);
+
+    residual.AddBoundaryIntegral(
+        serac::Dimension<dim - 1>{}, serac::DependsOn<0>{},
+        [](double /*t*/, auto /*x*/, auto phi) {
+          auto [u, _] = phi;
+          return u;
+        },
+        *mesh);
+
+    residual.memoizeIntegralOutputs(memoize);
+
+    std::string name = memoize ? "memoized" : "not memoized";
+    SERAC_MARK_BEGIN(name.c_str());
+    for (int i = 0; i < 10; i++) {
+      U *= 0.5;
+      mfem::Vector r = residual(t, U, V);
+    }
+    SERAC_MARK_END(name.c_str());
+  }
+}
+
+// Times a residual made of a flux and a source integrand over the same elements, registered as two separate
+// integrals (two element sweeps) and as one fused q-function (a single sweep)
+template <int p, int dim>
+void fused_functional_test(int parallel_refinement)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int serial_refinement = 1;
+
+  std::string filename =
+      (dim == 2) ? SERAC_REPO_DIR "/data/meshes/star.mesh" : SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto mesh =
+      serac::mesh::refineAndDistribute(serac::buildMeshFromFile(filename), serial_refinement, parallel_refinement);
+
+  using space         = serac::H1<p>;
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  auto flux = [](double /*t*/, auto /*x*/, auto phi) {
+    auto [u, du_dx] = phi;
+    return serac::tuple{0.0 * u, (1.0 + u * u) * du_dx};
+  };
+
+  auto source = [](double /*t*/, auto x, auto phi) {
+    auto [u, du_dx] = phi;
+    return serac::tuple{u * u * u - x[0], 0.0 * du_dx};
+  };
+
+  mfem::ParGridFunction u_global(fespace.get());
+  u_global.Randomize();
+
+  mfem::Vector U(fespace->TrueVSize());
+  u_global.GetTrueDofs(U);
+
+  double t = 0.0;
+
+  for (bool fused : {false, true}) {
+    serac::Functional<space(space)> residual(fespace.get(), {fespace.get()});
+
+    if (fused) {
+      residual.AddDomainIntegral(serac::Dimension<dim>{}, serac::DependsOn<0>{}, serac::fuse(flux, source), *mesh);
+    } else {
+      residual.AddDomainIntegral(serac::Dimension<dim>{}, serac::DependsOn<0>{}, flux, *mesh);
+      residual.AddDomainIntegral(serac::Dimension<dim>{}, serac::DependsOn<0>{}, source, *mesh);
+    }
+
+    std::string name = fused ? "fused" : "not fused";
+    SERAC_MARK_BEGIN(name.c_str());
+
+    SERAC_MARK_BEGIN("residual evaluation");
+    mfem::Vector r1 = residual(t, U);
+    SERAC_MARK_END("residual evaluation");
+
+    SERAC_MARK_BEGIN("compute gradient");
+    auto [r2, drdU] = residual(t, serac::differentiate_wrt(U));
+    SERAC_MARK_END("compute gradient");
+
+    SERAC_MARK_BEGIN("assemble gradient");
+    auto g_mat = assemble(drdU);
+    SERAC_MARK_END("assemble gradient");
+
+    SERAC_MARK_END(name.c_str());
+  }
+}
+
+// Times the node-node block (block-CSR) gradient assembly against the entry-by-entry scalar CSR assembly of a
+// vector-valued residual, reports the memory each storage format needs, and times the matrix-vector products
+template <int p, int dim>
+void block_assembly_test(int parallel_refinement)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int serial_refinement = 1;
+
+  std::string filename =
+      (dim == 2) ? SERAC_REPO_DIR "/data/meshes/star.mesh" : SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto mesh =
+      serac::mesh::refineAndDistribute(serac::buildMeshFromFile(filename), serial_refinement, parallel_refinement);
+
+  using space         = serac::H1<p, dim>;
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  serac::Functional<space(space)> residual(fespace.get(), {fespace.get()});
+
+  residual.AddDomainIntegral(
+      serac::Dimension<dim>{}, serac::DependsOn<0>{},
+      [](double /*t*/, auto /*x*/, auto phi) {
+        auto [u, du_dx] = phi;
+        return serac::tuple{u, du_dx + transpose(du_dx)};
+      },
+      *mesh);
+
+  mfem::ParGridFunction u_global(fespace.get());
+  u_global.Randomize();
+
+  mfem::Vector U(fespace->TrueVSize());
+  u_global.GetTrueDofs(U);
+
+  double t = 0.0;
+
+  auto [r, drdU] = residual(t, serac::differentiate_wrt(U));
+
+  SERAC_MARK_BEGIN("scalar assembly");
+  auto J = assemble(drdU);
+  SERAC_MARK_END("scalar assembly");
+
+  SERAC_MARK_BEGIN("block assembly");
+  auto bsr = drdU.assembleBlockCSR();
+  SERAC_MARK_END("block assembly");
+
+  // bytes of the rank-local (L-vector) matrices, with int column indices and double values
+  auto bs           = std::size_t(bsr.block_size);
+  auto block_rows   = std::size_t(bsr.num_block_rows);
+  auto nnzb         = std::size_t(bsr.row_ptr[bsr.num_block_rows]);
+  auto values_bytes = nnzb * bs * bs * sizeof(double);
+  auto scalar_bytes = (block_rows * bs + 1 + nnzb * bs * bs) * sizeof(int) + values_bytes;
+  auto block_bytes  = (block_rows + 1 + nnzb) * sizeof(int) + values_bytes;
+  auto expand_bytes = nnzb * bs * bs * (sizeof(int) + sizeof(uint32_t));
+  SLIC_INFO_ROOT(axom::fmt::format("rank 0 gradient storage: scalar CSR {} bytes, block CSR {} bytes, "
+                                   "block-to-scalar expansion maps {} bytes",
+                                   scalar_bytes, block_bytes, expand_bytes));
+
+  mfem::Vector dU(fespace->TrueVSize());
+  mfem::Vector dR(fespace->TrueVSize());
+  mfem::Vector dU_L(fespace->GetVSize());
+  mfem::Vector dR_L(fespace->GetVSize());
+  dU.Randomize();
+
+  const mfem::Operator* P = fespace->GetProlongationMatrix();
+
+  SERAC_MARK_BEGIN("scalar SpMV");
+  for (int i = 0; i < 10; i++) {
+    J->Mult(dU, dR);
+  }
+  SERAC_MARK_END("scalar SpMV");
+
+  SERAC_MARK_BEGIN("block SpMV");
+  for (int i = 0; i < 10; i++) {
+    P->Mult(dU, dU_L);
+    bsr.Mult(dU_L, dR_L);
+    P->MultTranspose(dR_L, dR);
+  }
+  SERAC_MARK_END("block SpMV");
+}
+
 int main(int argc, char* argv[])
 {
   MPI_Init(&argc, &argv);
@@ -129,6 +403,54 @@ int main(int argc, char* argv[])
 
   SERAC_MARK_END("vector H1");
 
+  SERAC_MARK_BEGIN("shape aware H1");
+
+  SERAC_MARK_BEGIN("dimension 2, order 1");
+  shape_aware_functional_test<1, 2>(parallel_refinement);
+  SERAC_MARK_END("dimension 2, order 1");
+
+  SERAC_MARK_BEGIN("dimension 3, order 2");
+  shape_aware_functional_test<2, 3>(parallel_refinement);
+  SERAC_MARK_END("dimension 3, order 2");
+
+  SERAC_MARK_END("shape aware H1");
+
+  SERAC_MARK_BEGIN("memoized H1");
+
+  SERAC_MARK_BEGIN("dimension 2, order 2");
+  memoized_functional_test<2, 2>(parallel_refinement);
+  SERAC_MARK_END("dimension 2, order 2");
+
+  SERAC_MARK_BEGIN("dimension 3, order 2");
+  memoized_functional_test<2, 3>(parallel_refinement);
+  SERAC_MARK_END("dimension 3, order 2");
+
+  SERAC_MARK_END("memoized H1");
+
+  SERAC_MARK_BEGIN("fused H1");
+
+  SERAC_MARK_BEGIN("dimension 2, order 2");
+  fused_functional_test<2, 2>(parallel_refinement);
+  SERAC_MARK_END("dimension 2, order 2");
+
+  SERAC_MARK_BEGIN("dimension 3, order 2");
+  fused_functional_test<2, 3>(parallel_refinement);
+  SERAC_MARK_END("dimension 3, order 2");
+
+  SERAC_MARK_END("fused H1");
+
+  SERAC_MARK_BEGIN("block assembly H1");
+
+  SERAC_MARK_BEGIN("dimension 2, order 2");
+  block_assembly_test<2, 2>(parallel_refinement);
+  SERAC_MARK_END("dimension 2, order 2");
+
+  SERAC_MARK_BEGIN("dimension 3, order 2");
+  block_assembly_test<2, 3>(parallel_refinement);
+  SERAC_MARK_END("dimension 3, order 2");
+
+  SERAC_MARK_END("block assembly H1");
+
   // Finalize profiling
   serac::profiling::finalize();
 
@@ -0,0 +1,147 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <set>
+#include <string>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/physics/materials/solid_material.hpp"
+#include "serac/physics/materials/thermal_material.hpp"
+#include "serac/physics/state/state_manager.hpp"
+#include "serac/physics/heat_transfer.hpp"
+#include "serac/physics/solid_mechanics.hpp"
+
+// Compares the time and linear iterations (reported by the linear solver's print level) of the
+// geometric and algebraic multigrid preconditioners on the same refinement hierarchy
+
+template <int p, int dim>
+void thermal_static(serac::Preconditioner preconditioner)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int serial_refinement   = 1;
+  int parallel_refinement = 2;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_multigrid");
+
+  std::string filename =
+      (dim == 2) ? SERAC_REPO_DIR "/data/meshes/star.mesh" : SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto levels = serac::mesh::refineAndDistributeHierarchy(serac::buildMeshFromFile(filename), serial_refinement,
+                                                          parallel_refinement);
+  serac::StateManager::setMeshHierarchy(std::move(levels), "default_mesh");
+
+  serac::LinearSolverOptions linear_options = {.linear_solver  = serac::LinearSolver::CG,
+                                               .preconditioner = preconditioner,
+                                               .relative_tol   = 1.0e-6,
+                                               .absolute_tol   = 1.0e-12,
+                                               .max_iterations = 200,
+                                               .print_level    = 1};
+
+  serac::HeatTransfer<p, dim> thermal_solver(serac::heat_transfer::default_nonlinear_options, linear_options,
+                                             serac::heat_transfer::default_static_options, "thermal_multigrid",
+                                             "default_mesh");
+
+  serac::heat_transfer::LinearIsotropicConductor mat(1.0, 1.0, 1.0);
+  thermal_solver.setMaterial(mat);
+
+  auto one = [](const mfem::Vector&, double) -> double { return 1.0; };
+  thermal_solver.setTemperatureBCs(std::set<int>{1}, one);
+  thermal_solver.setTemperature(one);
+
+  serac::heat_transfer::ConstantSource source{1.0};
+  thermal_solver.setSource(source);
+
+  thermal_solver.completeSetup();
+  thermal_solver.advanceTimestep(1.0);
+}
+
+template <int p>
+void solid_static(serac::Preconditioner preconditioner)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int dim = 3;
+
+  int serial_refinement   = 0;
+  int parallel_refinement = 2;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_multigrid");
+
+  auto levels = serac::mesh::refineAndDistributeHierarchy(
+      serac::buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/beam-hex.mesh"), serial_refinement, parallel_refinement);
+  serac::StateManager::setMeshHierarchy(std::move(levels), "default_mesh");
+
+  serac::LinearSolverOptions linear_options = {.linear_solver  = serac::LinearSolver::CG,
+                                               .preconditioner = preconditioner,
+                                               .relative_tol   = 1.0e-8,
+                                               .absolute_tol   = 1.0e-14,
+                                               .max_iterations = 500,
+                                               .print_level    = 1};
+
+  serac::NonlinearSolverOptions nonlinear_options = {.nonlin_solver  = serac::NonlinearSolver::Newton,
+                                                     .relative_tol   = 1.0e-8,
+                                                     .absolute_tol   = 1.0e-12,
+                                                     .max_iterations = 10,
+                                                     .print_level    = 1};
+
+  serac::SolidMechanics<p, dim> solid_solver(nonlinear_options, linear_options,
+                                             serac::solid_mechanics::default_quasistatic_options,
+                                             serac::GeometricNonlinearities::On, "solid_multigrid", "default_mesh");
+
+  serac::solid_mechanics::NeoHookean mat{.density = 1.0, .K = 1.0, .G = 0.5};
+  solid_solver.setMaterial(mat);
+
+  auto zero = [](const mfem::Vector&, mfem::Vector& u) { u = 0.0; };
+  solid_solver.setDisplacementBCs({1}, zero);
+  solid_solver.setDisplacement(zero);
+
+  solid_solver.addBodyForce(
+      [](const auto& /*x*/, double /*t*/) { return serac::tensor<double, dim>{0.0, 0.0, -1.0e-3}; });
+
+  solid_solver.completeSetup();
+  solid_solver.advanceTimestep(1.0);
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  serac::profiling::initialize();
+
+  SERAC_SET_METADATA("test", "multigrid");
+
+  for (auto preconditioner : {serac::Preconditioner::HypreAMG, serac::Preconditioner::GeometricMultigrid}) {
+    [[maybe_unused]] std::string name = serac::preconditionerName(preconditioner);
+
+    SERAC_MARK_BEGIN(("2D Linear Thermal " + name).c_str());
+    thermal_static<1, 2>(preconditioner);
+    SERAC_MARK_END(("2D Linear Thermal " + name).c_str());
+
+    SERAC_MARK_BEGIN(("3D Quadratic Thermal " + name).c_str());
+    thermal_static<2, 3>(preconditioner);
+    SERAC_MARK_END(("3D Quadratic Thermal " + name).c_str());
+
+    SERAC_MARK_BEGIN(("3D Linear Solid " + name).c_str());
+    solid_static<1>(preconditioner);
+    SERAC_MARK_END(("3D Linear Solid " + name).c_str());
+  }
+
+  serac::profiling::finalize();
+
+  MPI_Finalize();
+
+  return 0;
+}
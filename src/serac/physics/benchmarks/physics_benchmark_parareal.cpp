@@ -0,0 +1,115 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <string>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/physics/materials/thermal_material.hpp"
+#include "serac/physics/state/state_manager.hpp"
+#include "serac/physics/heat_transfer.hpp"
+#include "serac/physics/parareal.hpp"
+
+// Compares the time of a long (mildly nonlinear) heat transfer transient solved sequentially on every rank
+// against the same transient solved with Parareal, with one time slice per rank. The sequential solve runs
+// redundantly on each time slice's communicator, and doubles as the reference for the Parareal error.
+
+template <int p, int dim>
+std::unique_ptr<serac::HeatTransfer<p, dim>> thermal_transient(const std::string& name)
+{
+  serac::NonlinearSolverOptions nonlinear_options = {.nonlin_solver  = serac::NonlinearSolver::Newton,
+                                                     .relative_tol   = 1.0e-10,
+                                                     .absolute_tol   = 1.0e-12,
+                                                     .max_iterations = 20,
+                                                     .print_level    = 0};
+
+  serac::LinearSolverOptions linear_options = {.linear_solver  = serac::LinearSolver::CG,
+                                               .preconditioner = serac::Preconditioner::HypreAMG,
+                                               .relative_tol   = 1.0e-12,
+                                               .absolute_tol   = 1.0e-14,
+                                               .max_iterations = 200};
+
+  auto thermal = std::make_unique<serac::HeatTransfer<p, dim>>(
+      nonlinear_options, linear_options, serac::heat_transfer::default_timestepping_options, name, "default_mesh");
+
+  thermal->setMaterial(serac::heat_transfer::IsotropicConductorWithLinearConductivityVsTemperature(1.0, 1.0, 1.0, 0.1));
+  thermal->setTemperatureBCs({1}, [](const mfem::Vector&, double) { return 0.0; });
+  thermal->setTemperature([](const mfem::Vector&, double) { return 0.0; });
+  thermal->setSource([](auto /* X */, auto time, auto /* u */, auto /* du_dx */) { return 1.0 + time; });
+  thermal->completeSetup();
+  return thermal;
+}
+
+template <int p, int dim>
+void parareal_heat_transfer()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int num_ranks = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  serac::Parareal parareal(MPI_COMM_WORLD, num_ranks);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "parareal_heat_transfer");
+
+  auto mesh = serac::mesh::refineAndDistribute(serac::buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/star.mesh"), 2,
+                                               0, parareal.sliceComm());
+  serac::StateManager::setMesh(std::move(mesh), "default_mesh");
+
+  auto coarse = thermal_transient<p, dim>("coarse");
+  auto fine   = thermal_transient<p, dim>("fine");
+
+  double t_final   = 4.0;
+  double coarse_dt = t_final / (2 * num_ranks);
+  double fine_dt   = 0.01;
+
+  auto coarse_propagator = serac::physicsPropagator(*coarse, "temperature", coarse_dt);
+  auto fine_propagator   = serac::physicsPropagator(*fine, "temperature", fine_dt);
+
+  mfem::Vector reference(fine->temperature());
+  mfem::Vector temperature(fine->temperature());
+
+  SERAC_MARK_BEGIN("Sequential");
+  fine_propagator(0.0, t_final, reference);
+  SERAC_MARK_END("Sequential");
+
+  SERAC_MARK_BEGIN("Parareal");
+  int iterations = parareal.solve(0.0, t_final, temperature, coarse_propagator, fine_propagator,
+                                  {.max_iterations = num_ranks, .relative_tol = 1.0e-8, .print_level = 1});
+  SERAC_MARK_END("Parareal");
+
+  temperature -= reference;
+  double error = std::sqrt(mfem::InnerProduct(parareal.sliceComm(), temperature, temperature) /
+                           mfem::InnerProduct(parareal.sliceComm(), reference, reference));
+  SLIC_INFO_ROOT(axom::fmt::format("Parareal: {} time slices, {} iterations, relative error vs. sequential = {}",
+                                   num_ranks, iterations, error));
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  serac::profiling::initialize();
+
+  SERAC_SET_METADATA("test", "parareal");
+
+  SERAC_MARK_BEGIN("2D Nonlinear Thermal Transient");
+  parareal_heat_transfer<1, 2>();
+  SERAC_MARK_END("2D Nonlinear Thermal Transient");
+
+  serac::profiling::finalize();
+
+  MPI_Finalize();
+
+  return 0;
+}
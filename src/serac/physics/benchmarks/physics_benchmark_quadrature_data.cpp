@@ -0,0 +1,124 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/numerics/functional/functional.hpp"
+#include "serac/numerics/functional/geometry.hpp"
+
+// stand-in for the internal variables of a finite deformation plasticity model
+struct State {
+  serac::tensor<double, 3, 3> Fpinv = serac::DenseIdentity<3>();
+  double                      accumulated_plastic_strain;
+};
+
+template <int p>
+void quadrature_data_test(serac::QuadratureDataStorage storage, double yielded_fraction, int parallel_refinement)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int dim               = 3;
+  int           serial_refinement = 1;
+
+  std::string filename = SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto mesh =
+      serac::mesh::refineAndDistribute(serac::buildMeshFromFile(filename), serial_refinement, parallel_refinement);
+
+  using space         = serac::H1<p, dim>;
+  auto [fespace, fec] = serac::generateParFiniteElementSpace<space>(mesh.get());
+
+  serac::QuadratureData<State>::geom_array_t qpts_per_element{};
+  qpts_per_element[mfem::Geometry::CUBE] = uint32_t(serac::num_quadrature_points(mfem::Geometry::CUBE, p + 1));
+
+  auto qdata = std::make_shared<serac::QuadratureData<State>>(serac::geometry_counts(*mesh), qpts_per_element,
+                                                              State{}, storage);
+
+  // the beam is 8 units long, so this only changes the state of points near one end
+  double x_yield = 8.0 * yielded_fraction;
+
+  serac::Functional<space(space)> residual(fespace.get(), {fespace.get()});
+  residual.AddDomainIntegral(
+      serac::Dimension<dim>{}, serac::DependsOn<0>{},
+      [x_yield](double /*t*/, auto position, State& state, auto displacement) {
+        auto [X, dX_dxi] = position;
+        auto [u, du_dX]  = displacement;
+        if (X[0] < x_yield) {
+          state.accumulated_plastic_strain += 1.0e-3;
+          state.Fpinv = state.Fpinv - 1.0e-3 * serac::sym(serac::get_value(du_dX));
+        }
+        auto stress = serac::dot(du_dX, serac::transpose(state.Fpinv));
+        return serac::tuple{u, stress};
+      },
+      *mesh, qdata);
+
+  mfem::ParGridFunction u_global(fespace.get());
+  u_global.Randomize();
+
+  mfem::Vector U(fespace->TrueVSize());
+  u_global.GetTrueDofs(U);
+
+  double t = 0.0;
+
+  SERAC_MARK_BEGIN("residual evaluation (updating state)");
+  residual.updateQdata(true);
+  mfem::Vector r1 = residual(t, U);
+  residual.updateQdata(false);
+  SERAC_MARK_END("residual evaluation (updating state)");
+
+  SERAC_MARK_BEGIN("residual evaluation");
+  mfem::Vector r2 = residual(t, U);
+  SERAC_MARK_END("residual evaluation");
+
+  SERAC_MARK_BEGIN("compute gradient");
+  auto [r3, drdU] = residual(t, serac::differentiate_wrt(U));
+  SERAC_MARK_END("compute gradient");
+
+  SLIC_INFO(axom::fmt::format("{} quadrature data: {} bytes",
+                              (storage == serac::QuadratureDataStorage::Sparse) ? "sparse" : "dense",
+                              qdata->memory_footprint()));
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+
+  int parallel_refinement = 2;
+
+  axom::slic::SimpleLogger logger;
+
+  // Initialize profiling
+  serac::profiling::initialize();
+
+  // Add metadata
+  SERAC_SET_METADATA("test", "quadrature_data");
+
+  for (double yielded_fraction : {0.05, 0.5}) {
+    std::string region = axom::fmt::format("{}% of elements yielding", 100 * yielded_fraction);
+    SERAC_MARK_BEGIN(region.c_str());
+
+    SERAC_MARK_BEGIN("dense");
+    quadrature_data_test<1>(serac::QuadratureDataStorage::Dense, yielded_fraction, parallel_refinement);
+    SERAC_MARK_END("dense");
+
+    SERAC_MARK_BEGIN("sparse");
+    quadrature_data_test<1>(serac::QuadratureDataStorage::Sparse, yielded_fraction, parallel_refinement);
+    SERAC_MARK_END("sparse");
+
+    SERAC_MARK_END(region.c_str());
+  }
+
+  // Finalize profiling
+  serac::profiling::finalize();
+
+  MPI_Finalize();
+
+  return 0;
+}
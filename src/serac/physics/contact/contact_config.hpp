@@ -19,7 +19,8 @@ namespace serac {
  */
 enum class ContactMethod
 {
-  SingleMortar /**< Puso and Laursen 2004 w/ approximate tangent */
+  SingleMortar, /**< Puso and Laursen 2004 w/ approximate tangent */
+  NodeToSurface /**< Nodes of the second surface projected onto the closest segment of the first, penalty only */
 };
 
 /**
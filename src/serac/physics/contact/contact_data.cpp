@@ -41,7 +41,7 @@ void ContactData::addContactInteraction(int interaction_id, const std::set<int>&
   }
 }
 
-void ContactData::update(int cycle, double time, double& dt)
+void ContactData::update(int cycle, double time, double& dt, bool update_node_to_surface)
 {
   cycle_ = cycle;
   time_  = time;
@@ -53,6 +53,12 @@ void ContactData::update(int cycle, double time, double& dt)
   // fields (with the exception of pressure) are stored on the redecomposed surface mesh until transferred by calling
   // forces(), mergedGaps(), etc.
   tribol::update(cycle, time, dt);
+  // Contact interactions computed outside of Tribol (e.g. node-to-surface) are updated separately.
+  if (update_node_to_surface) {
+    for (auto& interaction : interactions_) {
+      interaction.update();
+    }
+  }
 }
 
 FiniteElementDual ContactData::forces() const
@@ -244,8 +250,9 @@ void ContactData::residualFunction(const mfem::Vector& u, mfem::Vector& r)
   update(cycle_, time_, dt_);
   // with updated gaps, we can update pressure for contact interactions with penalty enforcement
   setPressures(p_blk);
-  // call update again with the right pressures
-  update(cycle_, time_, dt_);
+  // call update again with the right pressures. The node-to-surface forces are B^T A p with the B and A from the first
+  // update, so only the Tribol interactions need to be recomputed
+  update(cycle_, time_, dt_, false);
 
   r_blk += forces();
   // calling mergedGaps() with true will zero out gap on inactive dofs (so the residual converges and the linearized
@@ -356,7 +363,10 @@ void ContactData::addContactInteraction([[maybe_unused]] int                  in
   SLIC_WARNING_ROOT("Serac built without Tribol support. No contact interaction will be added.");
 }
 
-void ContactData::update([[maybe_unused]] int cycle, [[maybe_unused]] double time, [[maybe_unused]] double& dt) {}
+void ContactData::update([[maybe_unused]] int cycle, [[maybe_unused]] double time, [[maybe_unused]] double& dt,
+                         [[maybe_unused]] bool update_node_to_surface)
+{
+}
 
 FiniteElementDual ContactData::forces() const
 {
@@ -71,8 +71,10 @@ public:
    * @param cycle The current simulation cycle
    * @param time The current time
    * @param dt The timestep size to attempt
+   * @param update_node_to_surface Whether to also recompute the projections, gaps, and Jacobians of the node-to-surface
+   * interactions (not needed when only the pressures changed, since their forces are computed from the pressures)
    */
-  void update(int cycle, double time, double& dt);
+  void update(int cycle, double time, double& dt, bool update_node_to_surface = true);
 
   /**
    * @brief Get the contact constraint residual (i.e. nodal forces) from all contact interactions
@@ -8,6 +8,8 @@
 
 #ifdef SERAC_USE_TRIBOL
 
+#include <cmath>
+
 #include "axom/slic.hpp"
 
 #include "serac/physics/contact/contact_config.hpp"
@@ -33,6 +35,19 @@ ContactInteraction::ContactInteraction(int interaction_id, const mfem::ParMesh&
                                        const mfem::ParGridFunction& current_coords, ContactOptions contact_opts)
     : interaction_id_{interaction_id}, contact_opts_{contact_opts}, current_coords_{current_coords}
 {
+  if (contact_opts_.method == ContactMethod::NodeToSurface) {
+    SLIC_ERROR_ROOT_IF(contact_opts_.enforcement != ContactEnforcement::Penalty,
+                       "Node-to-surface contact only supports penalty enforcement.");
+    node_to_surface_ = std::make_unique<NodeToSurfaceContact>(mesh, bdry_attr_surf1, bdry_attr_surf2, current_coords);
+    int num_disp_dofs     = current_coords.ParFESpace()->GetTrueVSize();
+    int num_pressure_dofs = node_to_surface_->pressureSpace().GetTrueVSize();
+    jacobian_offsets_     = mfem::Array<int>({0, num_disp_dofs, num_disp_dofs + num_pressure_dofs});
+    if (getContactOptions().type == ContactType::TiedNormal) {
+      inactive_tdofs_ = node_to_surface_->unprojectedDofs();
+    }
+    return;
+  }
+
   int mesh1_id = 2 * interaction_id;      // unique id for the first Tribol mesh
   int mesh2_id = 2 * interaction_id + 1;  // unique id for the second Tribol mesh
   tribol::registerMfemCouplingScheme(interaction_id, mesh1_id, mesh2_id, mesh, current_coords, bdry_attr_surf1,
@@ -64,10 +79,25 @@ ContactInteraction::ContactInteraction(int interaction_id, const mfem::ParMesh&
   }
 }
 
+void ContactInteraction::update()
+{
+  if (node_to_surface_) {
+    node_to_surface_->update();
+    // tied nodes stay active as long as they have a closest point
+    if (getContactOptions().type == ContactType::TiedNormal) {
+      inactive_tdofs_ = node_to_surface_->unprojectedDofs();
+    }
+  }
+}
+
 FiniteElementDual ContactInteraction::forces() const
 {
   FiniteElementDual f(*current_coords_.ParFESpace());
-  auto&             f_loc = f.linearForm();
+  if (node_to_surface_) {
+    node_to_surface_->forces(f);
+    return f;
+  }
+  auto& f_loc = f.linearForm();
   tribol::getMfemResponse(getInteractionId(), f_loc);
   f.setFromLinearForm(f_loc);
   return f;
@@ -75,6 +105,11 @@ FiniteElementDual ContactInteraction::forces() const
 
 FiniteElementState ContactInteraction::pressure() const
 {
+  if (node_to_surface_) {
+    FiniteElementState p(pressureSpace());
+    p = node_to_surface_->pressure();
+    return p;
+  }
   auto&              p_tribol = tribol::getMfemPressure(getInteractionId());
   FiniteElementState p(*p_tribol.ParFESpace());
   p.setFromGridFunction(p_tribol);
@@ -84,7 +119,11 @@ FiniteElementState ContactInteraction::pressure() const
 FiniteElementDual ContactInteraction::gaps() const
 {
   FiniteElementDual g(pressureSpace());
-  auto&             g_loc = g.linearForm();
+  if (node_to_surface_) {
+    g = node_to_surface_->gaps();
+    return g;
+  }
+  auto& g_loc = g.linearForm();
   tribol::getMfemGap(getInteractionId(), g_loc);
   g.setFromLinearForm(g_loc);
   return g;
@@ -92,6 +131,23 @@ FiniteElementDual ContactInteraction::gaps() const
 
 std::unique_ptr<mfem::BlockOperator> ContactInteraction::jacobian() const
 {
+  if (node_to_surface_) {
+    // same layout as the Tribol Jacobian: dg/dx and its transpose, with the (approximate) df/dx left to the
+    // enforcement. The forces are B^T A p, with A the tributary areas, so the rows of B are scaled by sqrt(A) (the
+    // penalty stiffness penalty * B^T B then is penalty * B^T A B). Node-to-surface contact only supports penalty
+    // enforcement (see the constructor).
+    mfem::Vector row_scale(node_to_surface_->tributaryAreas());
+    for (int i = 0; i < row_scale.Size(); i++) {
+      row_scale[i] = std::sqrt(row_scale[i]);
+    }
+    auto J         = std::make_unique<mfem::BlockOperator>(jacobian_offsets_);
+    J->owns_blocks = true;
+    auto B         = new mfem::HypreParMatrix(node_to_surface_->gapJacobian());
+    B->ScaleRows(row_scale);
+    J->SetBlock(1, 0, B);
+    J->SetBlock(0, 1, B->Transpose());
+    return J;
+  }
   return tribol::getMfemBlockJacobian(getInteractionId());
 }
 
@@ -104,11 +160,18 @@ int ContactInteraction::numPressureDofs() const
 
 mfem::ParFiniteElementSpace& ContactInteraction::pressureSpace() const
 {
+  if (node_to_surface_) {
+    return node_to_surface_->pressureSpace();
+  }
   return *tribol::getMfemPressure(getInteractionId()).ParFESpace();
 }
 
 void ContactInteraction::setPressure(const FiniteElementState& pressure) const
 {
+  if (node_to_surface_) {
+    node_to_surface_->setPressure(pressure);
+    return;
+  }
   tribol::getMfemPressure(getInteractionId()) = pressure.gridFunction();
 }
 
@@ -19,6 +19,7 @@
 #include "mfem.hpp"
 
 #include "serac/physics/contact/contact_config.hpp"
+#include "serac/physics/contact/node_to_surface_contact.hpp"
 #include "serac/physics/state/finite_element_dual.hpp"
 #include "serac/physics/state/finite_element_state.hpp"
 
@@ -33,6 +34,9 @@ namespace serac {
  * interface physics library, defining the Tribol coupling scheme for the interaction.  A problem can have multiple
  * ContactInteractions defined on it with different contact surfaces and enforcement schemes.  See the ContactData class
  * for the container holding all contact interactions and for Tribol API calls acting on all contact interactions.
+ *
+ * The ContactMethod::NodeToSurface method is computed by serac (see NodeToSurfaceContact) instead of Tribol, behind
+ * the same interface.
  **/
 class ContactInteraction {
 public:
@@ -65,6 +69,13 @@ public:
    */
   const ContactOptions& getContactOptions() const { return contact_opts_; }
 
+  /**
+   * @brief Updates the gaps and Jacobian contributions of contact interactions that are not computed by Tribol
+   *
+   * @note Called by ContactData::update() after the Tribol update
+   */
+  void update();
+
   /**
    * @brief Get the contact constraint residual (i.e. nodal forces) from this contact interaction
    *
@@ -162,6 +173,16 @@ private:
    * @brief List of true DOFs currently not in the active set
    */
   mutable mfem::Array<int> inactive_tdofs_;
+
+  /**
+   * @brief Gaps and gap Jacobian for ContactMethod::NodeToSurface (null for the Tribol methods)
+   */
+  std::unique_ptr<NodeToSurfaceContact> node_to_surface_;
+
+  /**
+   * @brief Block offsets of the Jacobian for ContactMethod::NodeToSurface (must outlive the returned BlockOperator)
+   */
+  mfem::Array<int> jacobian_offsets_;
 };
 
 }  // namespace serac
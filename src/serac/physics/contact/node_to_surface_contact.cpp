@@ -0,0 +1,551 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/physics/contact/node_to_surface_contact.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "axom/core.hpp"
+#include "axom/primal.hpp"
+#include "axom/slic.hpp"
+#include "axom/spin.hpp"
+
+namespace serac {
+
+namespace {
+
+/// Largest number of vertices of a (linear) boundary segment
+constexpr int max_segment_vertices = 4;
+
+/// Number of values stored per exchanged segment (one per vertex component)
+constexpr int segment_stride = max_segment_vertices * 3;
+
+using Vec3 = std::array<double, 3>;
+
+/// Bounding boxes and points of the spatial indices (2D meshes use z = 0)
+using BoxType   = axom::primal::BoundingBox<double, 3>;
+using PointType = axom::primal::Point<double, 3>;
+
+/// Spatial index of a set of bounding boxes
+using BVHType = axom::spin::BVH<3, axom::SEQ_EXEC>;
+
+Vec3 operator-(const Vec3& a, const Vec3& b) { return {a[0] - b[0], a[1] - b[1], a[2] - b[2]}; }
+
+double dot(const Vec3& a, const Vec3& b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+
+Vec3 cross(const Vec3& a, const Vec3& b)
+{
+  return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+Vec3 normalize(const Vec3& a)
+{
+  double norm = std::sqrt(dot(a, a));
+  return {a[0] / norm, a[1] / norm, a[2] / norm};
+}
+
+/// Closest point of a node on a segment, and the gap of the node along the segment normal
+struct SegmentProjection {
+  double                                   distance = std::numeric_limits<double>::max();
+  double                                   gap      = 0.0;
+  Vec3                                     normal   = {};
+  std::array<double, max_segment_vertices> weights  = {};
+};
+
+/**
+ * @brief Barycentric coordinates of the point of triangle abc that is closest to p
+ *
+ * See Ericson, Real-Time Collision Detection, section 5.1.5
+ */
+std::array<double, 3> closestPointOnTriangle(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c)
+{
+  Vec3   ab = b - a;
+  Vec3   ac = c - a;
+  Vec3   ap = p - a;
+  double d1 = dot(ab, ap);
+  double d2 = dot(ac, ap);
+  if (d1 <= 0.0 && d2 <= 0.0) {
+    return {1.0, 0.0, 0.0};
+  }
+
+  Vec3   bp = p - b;
+  double d3 = dot(ab, bp);
+  double d4 = dot(ac, bp);
+  if (d3 >= 0.0 && d4 <= d3) {
+    return {0.0, 1.0, 0.0};
+  }
+
+  double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+    double v = d1 / (d1 - d3);
+    return {1.0 - v, v, 0.0};
+  }
+
+  Vec3   cp = p - c;
+  double d5 = dot(ab, cp);
+  double d6 = dot(ac, cp);
+  if (d6 >= 0.0 && d5 <= d6) {
+    return {0.0, 0.0, 1.0};
+  }
+
+  double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+    double w = d2 / (d2 - d6);
+    return {1.0 - w, 0.0, w};
+  }
+
+  double va = d3 * d6 - d5 * d4;
+  if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+    double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    return {0.0, 1.0 - w, w};
+  }
+
+  double denom = 1.0 / (va + vb + vc);
+  double v     = vb * denom;
+  double w     = vc * denom;
+  return {1.0 - v - w, v, w};
+}
+
+/**
+ * @brief Projects a node onto a linear segment
+ *
+ * Two-vertex segments (2D) have the outward normal of an MFEM boundary edge, and triangles and quadrilaterals (3D) the
+ * outward normal of an MFEM boundary face. Quadrilaterals are split into two triangles along the 0-2 diagonal.
+ */
+SegmentProjection project(const Vec3& x, const std::array<Vec3, max_segment_vertices>& v, int num_vertices)
+{
+  SegmentProjection projection;
+  Vec3              closest;
+  if (num_vertices == 2) {
+    Vec3   edge = v[1] - v[0];
+    double t    = std::clamp(dot(x - v[0], edge) / dot(edge, edge), 0.0, 1.0);
+
+    projection.normal     = normalize({edge[1], -edge[0], 0.0});
+    projection.weights[0] = 1.0 - t;
+    projection.weights[1] = t;
+  } else {
+    Vec3 n            = (num_vertices == 3) ? cross(v[1] - v[0], v[2] - v[0]) : cross(v[2] - v[0], v[3] - v[1]);
+    projection.normal = normalize(n);
+
+    auto w             = closestPointOnTriangle(x, v[0], v[1], v[2]);
+    projection.weights = {w[0], w[1], w[2], 0.0};
+    if (num_vertices == 4) {
+      auto   w2 = closestPointOnTriangle(x, v[0], v[2], v[3]);
+      double d1 = 0.0;
+      double d2 = 0.0;
+      for (size_t c = 0; c < 3; c++) {
+        double x1 = x[c] - (w[0] * v[0][c] + w[1] * v[1][c] + w[2] * v[2][c]);
+        double x2 = x[c] - (w2[0] * v[0][c] + w2[1] * v[2][c] + w2[2] * v[3][c]);
+        d1 += x1 * x1;
+        d2 += x2 * x2;
+      }
+      if (d2 < d1) {
+        projection.weights = {w2[0], 0.0, w2[1], w2[2]};
+      }
+    }
+  }
+
+  for (size_t c = 0; c < 3; c++) {
+    closest[c] = 0.0;
+    for (size_t i = 0; i < static_cast<size_t>(num_vertices); i++) {
+      closest[c] += projection.weights[i] * v[i][c];
+    }
+  }
+
+  Vec3 r              = x - closest;
+  projection.distance = std::sqrt(dot(r, r));
+  projection.gap      = dot(r, projection.normal);
+  return projection;
+}
+
+/// Length of the longest edge of a segment, used as the reach of the closest point search
+double segmentSize(const std::array<Vec3, max_segment_vertices>& v, int num_vertices)
+{
+  double size = 0.0;
+  for (int i = 0; i < num_vertices; i++) {
+    Vec3 edge = v[static_cast<size_t>((i + 1) % num_vertices)] - v[static_cast<size_t>(i)];
+    size      = std::max(size, std::sqrt(dot(edge, edge)));
+  }
+  return size;
+}
+
+/// Bounding box of a segment, expanded by its size so that it contains every node within reach of the segment
+BoxType reachBox(const std::array<Vec3, max_segment_vertices>& v, int num_vertices)
+{
+  BoxType box;
+  for (size_t i = 0; i < static_cast<size_t>(num_vertices); i++) {
+    box.addPoint(PointType(v[i].data(), 3));
+  }
+  box.expand(segmentSize(v, num_vertices));
+  return box;
+}
+
+/// Area (or length, in 2D) of a linear segment
+double segmentArea(const std::array<Vec3, max_segment_vertices>& v, int num_vertices)
+{
+  if (num_vertices == 2) {
+    Vec3 edge = v[1] - v[0];
+    return std::sqrt(dot(edge, edge));
+  }
+  Vec3 n = (num_vertices == 3) ? cross(v[1] - v[0], v[2] - v[0]) : cross(v[2] - v[0], v[3] - v[1]);
+  return 0.5 * std::sqrt(dot(n, n));
+}
+
+/**
+ * @brief Finds the boxes of a spatial index that intersect each of a set of query boxes or points
+ *
+ * @param boxes Boxes to index
+ * @param num_queries Number of query boxes or points
+ * @param queries Query boxes or points
+ * @return For each query, the indices of the intersecting boxes (CSR format: offsets into the candidate list)
+ */
+template <typename QueryType>
+std::pair<std::vector<axom::IndexType>, axom::Array<axom::IndexType>> findCandidates(
+    const std::vector<BoxType>& boxes, axom::IndexType num_queries, const QueryType* queries)
+{
+  std::vector<axom::IndexType> offsets(static_cast<size_t>(num_queries) + 1, 0);
+  axom::Array<axom::IndexType> candidates;
+  if (boxes.empty() || num_queries == 0) {
+    return {offsets, candidates};
+  }
+
+  BVHType bvh;
+  bvh.initialize(boxes.data(), static_cast<axom::IndexType>(boxes.size()));
+
+  axom::Array<axom::IndexType> query_offsets(num_queries);
+  axom::Array<axom::IndexType> query_counts(num_queries);
+  if constexpr (std::is_same_v<QueryType, PointType>) {
+    bvh.findPoints(query_offsets.view(), query_counts.view(), candidates, num_queries, queries);
+  } else {
+    bvh.findBoundingBoxes(query_offsets.view(), query_counts.view(), candidates, num_queries, queries);
+  }
+
+  for (axom::IndexType q = 0; q < num_queries; q++) {
+    offsets[static_cast<size_t>(q) + 1] = query_offsets[q] + query_counts[q];
+  }
+  return {offsets, candidates};
+}
+
+/**
+ * @brief Coordinates of a mesh vertex
+ *
+ * @param coords Nodal coordinates
+ * @param vertex Mesh vertex
+ * @param dofs If not null, set to the global true DOFs of the vertex coordinates
+ */
+Vec3 vertexCoordinates(const mfem::ParGridFunction& coords, int vertex, std::array<HYPRE_BigInt, 3>* dofs = nullptr)
+{
+  const auto& space = *coords.ParFESpace();
+
+  mfem::Array<int> vdofs;
+  space.GetVertexVDofs(vertex, vdofs);
+  Vec3 x{};
+  for (int c = 0; c < space.GetVDim(); c++) {
+    x[static_cast<size_t>(c)] = coords(vdofs[c]);
+    if (dofs) {
+      (*dofs)[static_cast<size_t>(c)] = space.GetGlobalTDofNumber(vdofs[c]);
+    }
+  }
+  return x;
+}
+
+mfem::Array<int> attributeArray(const std::set<int>& attributes)
+{
+  mfem::Array<int> array(static_cast<int>(attributes.size()));
+  std::copy(attributes.begin(), attributes.end(), array.begin());
+  return array;
+}
+
+}  // namespace
+
+NodeToSurfaceContact::NodeToSurfaceContact(const mfem::ParMesh& mesh, const std::set<int>& bdry_attr_surf1,
+                                           const std::set<int>& bdry_attr_surf2,
+                                           const mfem::ParGridFunction& current_coords)
+    : mesh_{mesh},
+      current_coords_{current_coords},
+      surface_{new mfem::ParSubMesh(mfem::ParSubMesh::CreateFromBoundary(mesh, attributeArray(bdry_attr_surf2)))},
+      pressure_fec_{std::make_unique<mfem::H1_FECollection>(1, surface_->Dimension())},
+      pressure_space_{std::make_unique<mfem::ParFiniteElementSpace>(surface_.get(), pressure_fec_.get())},
+      gaps_(pressure_space_->GetTrueVSize()),
+      pressure_(pressure_space_->GetTrueVSize()),
+      tributary_areas_(pressure_space_->GetTrueVSize())
+{
+  SLIC_ERROR_ROOT_IF(mesh.SpaceDimension() != 2 && mesh.SpaceDimension() != 3,
+                     "Node-to-surface contact requires a 2D or 3D mesh.");
+  // only the vertices of the segments (and their displacement DOFs) are used
+  SLIC_ERROR_ROOT_IF(current_coords.ParFESpace()->GetMaxElementOrder() > 1,
+                     axom::fmt::format("Node-to-surface contact requires a linear displacement field, not order {}.",
+                                       current_coords.ParFESpace()->GetMaxElementOrder()));
+
+  for (int e = 0; e < mesh_.GetNBE(); e++) {
+    if (bdry_attr_surf1.count(mesh_.GetBdrAttribute(e))) {
+      segments_.push_back(e);
+    }
+  }
+
+  // each true DOF of the (linear, scalar) pressure space is a vertex of the second surface
+  node_vertices_.assign(static_cast<size_t>(pressure_space_->GetTrueVSize()), -1);
+  const auto&      parent_vertices = surface_->GetParentVertexIDMap();
+  mfem::Array<int> dofs;
+  for (int v = 0; v < surface_->GetNV(); v++) {
+    pressure_space_->GetVertexDofs(v, dofs);
+    int tdof = pressure_space_->GetLocalTDofNumber(dofs[0]);
+    if (tdof >= 0) {
+      node_vertices_[static_cast<size_t>(tdof)] = parent_vertices[v];
+    }
+  }
+
+  gaps_     = 0.0;
+  pressure_ = 0.0;
+  update();
+}
+
+void NodeToSurfaceContact::computeTributaryAreas()
+{
+  // lumped (row sum) surface mass matrix of the linear pressure space in the current configuration: each vertex
+  // of a segment gets an equal share of its area, and the shares of vertices on other ranks are summed by P^T
+  mfem::Vector     local_areas(pressure_space_->GetVSize());
+  mfem::Array<int> vertices;
+  mfem::Array<int> dofs;
+  local_areas          = 0.0;
+  const auto& parent_v = surface_->GetParentVertexIDMap();
+  for (int e = 0; e < surface_->GetNE(); e++) {
+    surface_->GetElementVertices(e, vertices);
+    SLIC_ERROR_ROOT_IF(vertices.Size() > max_segment_vertices,
+                       axom::fmt::format("Unsupported contact segment with {} vertices.", vertices.Size()));
+
+    std::array<Vec3, max_segment_vertices> v{};
+    for (int i = 0; i < vertices.Size(); i++) {
+      v[static_cast<size_t>(i)] = vertexCoordinates(current_coords_, parent_v[vertices[i]]);
+    }
+
+    double share = segmentArea(v, vertices.Size()) / vertices.Size();
+    for (int i = 0; i < vertices.Size(); i++) {
+      pressure_space_->GetVertexDofs(vertices[i], dofs);
+      local_areas[dofs[0]] += share;
+    }
+  }
+
+  pressure_space_->GetProlongationMatrix()->MultTranspose(local_areas, tributary_areas_);
+}
+
+void NodeToSurfaceContact::exchangeSegments()
+{
+  const int dim       = mesh_.SpaceDimension();
+  const int num_ranks = mesh_.GetNRanks();
+
+  // bounding box of the nodes of the second surface on each rank
+  BoxType node_box;
+  for (int vertex : node_vertices_) {
+    node_box.addPoint(PointType(vertexCoordinates(current_coords_, vertex).data(), 3));
+  }
+
+  std::array<double, 6> local_box;
+  for (int c = 0; c < 3; c++) {
+    local_box[static_cast<size_t>(c)]     = node_box.getMin()[c];
+    local_box[static_cast<size_t>(c + 3)] = node_box.getMax()[c];
+  }
+  std::vector<double> all_boxes(6 * static_cast<size_t>(num_ranks));
+  MPI_Allgather(local_box.data(), 6, MPI_DOUBLE, all_boxes.data(), 6, MPI_DOUBLE, mesh_.GetComm());
+
+  // ranks without nodes on the second surface receive no segments
+  std::vector<BoxType> rank_boxes;
+  std::vector<int>     box_ranks;
+  for (int r = 0; r < num_ranks; r++) {
+    const double* box = &all_boxes[6 * static_cast<size_t>(r)];
+    if (box[0] <= box[3]) {
+      rank_boxes.emplace_back(PointType(box, 3), PointType(box + 3, 3));
+      box_ranks.push_back(r);
+    }
+  }
+
+  // the coordinates, DOFs and reach of each local segment
+  const size_t              num_segments = segments_.size();
+  std::vector<double>       coords(num_segments * segment_stride, 0.0);
+  std::vector<HYPRE_BigInt> dofs(num_segments * segment_stride, -1);
+  std::vector<BoxType>      reach(num_segments);
+  mfem::Array<int>          vertices;
+  for (size_t s = 0; s < num_segments; s++) {
+    mesh_.GetBdrElementVertices(segments_[s], vertices);
+    SLIC_ERROR_ROOT_IF(vertices.Size() > max_segment_vertices,
+                       axom::fmt::format("Unsupported contact segment with {} vertices.", vertices.Size()));
+
+    std::array<Vec3, max_segment_vertices> v{};
+    for (int i = 0; i < vertices.Size(); i++) {
+      std::array<HYPRE_BigInt, 3> vertex_dofs{};
+      v[static_cast<size_t>(i)] = vertexCoordinates(current_coords_, vertices[i], &vertex_dofs);
+      for (int c = 0; c < dim; c++) {
+        coords[s * segment_stride + static_cast<size_t>(3 * i + c)] = v[static_cast<size_t>(i)][static_cast<size_t>(c)];
+        dofs[s * segment_stride + static_cast<size_t>(3 * i + c)]   = vertex_dofs[static_cast<size_t>(c)];
+      }
+    }
+    reach[s] = reachBox(v, vertices.Size());
+  }
+
+  // send each segment only to the ranks with nodes within its reach
+  auto [rank_offsets, rank_candidates] =
+      findCandidates(rank_boxes, static_cast<axom::IndexType>(num_segments), reach.data());
+
+  std::vector<std::vector<size_t>> outgoing(static_cast<size_t>(num_ranks));
+  for (size_t s = 0; s < num_segments; s++) {
+    for (auto k = rank_offsets[s]; k < rank_offsets[s + 1]; k++) {
+      outgoing[static_cast<size_t>(box_ranks[static_cast<size_t>(rank_candidates[k])])].push_back(s);
+    }
+  }
+
+  std::vector<int> send_counts(static_cast<size_t>(num_ranks));
+  std::vector<int> send_displacements(static_cast<size_t>(num_ranks) + 1, 0);
+  for (size_t r = 0; r < outgoing.size(); r++) {
+    send_counts[r]            = static_cast<int>(outgoing[r].size() * segment_stride);
+    send_displacements[r + 1] = send_displacements[r] + send_counts[r];
+  }
+
+  std::vector<double>       send_coords(static_cast<size_t>(send_displacements.back()));
+  std::vector<HYPRE_BigInt> send_dofs(static_cast<size_t>(send_displacements.back()));
+  for (size_t r = 0; r < outgoing.size(); r++) {
+    size_t position = static_cast<size_t>(send_displacements[r]);
+    for (size_t s : outgoing[r]) {
+      std::copy_n(&coords[s * segment_stride], segment_stride, &send_coords[position]);
+      std::copy_n(&dofs[s * segment_stride], segment_stride, &send_dofs[position]);
+      position += segment_stride;
+    }
+  }
+
+  std::vector<int> recv_counts(static_cast<size_t>(num_ranks));
+  std::vector<int> recv_displacements(static_cast<size_t>(num_ranks) + 1, 0);
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, mesh_.GetComm());
+  for (size_t r = 0; r < recv_counts.size(); r++) {
+    recv_displacements[r + 1] = recv_displacements[r] + recv_counts[r];
+  }
+
+  segment_coords_.resize(static_cast<size_t>(recv_displacements.back()));
+  segment_dofs_.resize(static_cast<size_t>(recv_displacements.back()));
+  MPI_Alltoallv(send_coords.data(), send_counts.data(), send_displacements.data(), MPI_DOUBLE, segment_coords_.data(),
+                recv_counts.data(), recv_displacements.data(), MPI_DOUBLE, mesh_.GetComm());
+  MPI_Alltoallv(send_dofs.data(), send_counts.data(), send_displacements.data(), HYPRE_MPI_BIG_INT,
+                segment_dofs_.data(), recv_counts.data(), recv_displacements.data(), HYPRE_MPI_BIG_INT,
+                mesh_.GetComm());
+
+  // unused vertex slots have no DOFs
+  segment_num_vertices_.assign(segment_dofs_.size() / segment_stride, 0);
+  for (size_t s = 0; s < segment_num_vertices_.size(); s++) {
+    for (size_t i = 0; i < max_segment_vertices; i++) {
+      if (segment_dofs_[s * segment_stride + 3 * i] >= 0) {
+        segment_num_vertices_[s]++;
+      }
+    }
+  }
+}
+
+void NodeToSurfaceContact::update()
+{
+  exchangeSegments();
+  computeTributaryAreas();
+
+  const int   dim          = mesh_.SpaceDimension();
+  const auto& space        = *current_coords_.ParFESpace();
+  const int   num_tdofs    = pressure_space_->GetTrueVSize();
+  const auto  num_segments = segment_num_vertices_.size();
+
+  // the reach of each segment received from the ranks that own it
+  std::vector<std::array<Vec3, max_segment_vertices>> segment_vertices(num_segments);
+  std::vector<BoxType>                                 reach(num_segments);
+  for (size_t s = 0; s < num_segments; s++) {
+    for (size_t i = 0; i < max_segment_vertices; i++) {
+      std::copy_n(&segment_coords_[s * segment_stride + 3 * i], 3, segment_vertices[s][i].begin());
+    }
+    reach[s] = reachBox(segment_vertices[s], segment_num_vertices_[s]);
+  }
+
+  std::vector<Vec3>                        nodes(static_cast<size_t>(num_tdofs));
+  std::vector<std::array<HYPRE_BigInt, 3>> node_dofs(static_cast<size_t>(num_tdofs));
+  std::vector<PointType>                   points(static_cast<size_t>(num_tdofs));
+  for (size_t n = 0; n < nodes.size(); n++) {
+    nodes[n]  = vertexCoordinates(current_coords_, node_vertices_[n], &node_dofs[n]);
+    points[n] = PointType(nodes[n].data(), 3);
+  }
+
+  // only the segments whose reach contains a node are candidates for its projection
+  auto [offsets, candidates] = findCandidates(reach, num_tdofs, points.data());
+
+  gaps_ = 0.0;
+  std::vector<int> unprojected;
+
+  // CSR rows of the gap Jacobian, with global column indices
+  std::vector<int>          I(static_cast<size_t>(num_tdofs) + 1, 0);
+  std::vector<HYPRE_BigInt> J;
+  std::vector<double>       data;
+
+  for (int tdof = 0; tdof < num_tdofs; tdof++) {
+    const auto  n = static_cast<size_t>(tdof);
+    const auto& x = nodes[n];
+
+    // closest segment within reach, skipping segments that contain the node itself
+    SegmentProjection best;
+    size_t            best_segment = num_segments;
+    for (auto k = offsets[n]; k < offsets[n + 1]; k++) {
+      const auto          s    = static_cast<size_t>(candidates[k]);
+      const HYPRE_BigInt* dofs = &segment_dofs_[s * segment_stride];
+      if (std::find(dofs, dofs + segment_stride, node_dofs[n][0]) != dofs + segment_stride) {
+        continue;
+      }
+
+      int    num_vertices = segment_num_vertices_[s];
+      auto   projection   = project(x, segment_vertices[s], num_vertices);
+      double size         = segmentSize(segment_vertices[s], num_vertices);
+      if (projection.distance <= size && projection.distance < best.distance) {
+        best         = projection;
+        best_segment = s;
+      }
+    }
+
+    if (best_segment == num_segments) {
+      unprojected.push_back(tdof);
+    } else {
+      // g = n . (x - sum_i w_i x_i), with the normal held fixed
+      gaps_[tdof] = best.gap;
+      for (int c = 0; c < dim; c++) {
+        J.push_back(node_dofs[n][static_cast<size_t>(c)]);
+        data.push_back(best.normal[static_cast<size_t>(c)]);
+      }
+      for (size_t i = 0; i < max_segment_vertices; i++) {
+        if (best.weights[i] == 0.0) {
+          continue;
+        }
+        for (int c = 0; c < dim; c++) {
+          J.push_back(segment_dofs_[best_segment * segment_stride + 3 * i + static_cast<size_t>(c)]);
+          data.push_back(-best.weights[i] * best.normal[static_cast<size_t>(c)]);
+        }
+      }
+    }
+    I[n + 1] = static_cast<int>(J.size());
+  }
+
+  gap_jacobian_ = std::make_unique<mfem::HypreParMatrix>(
+      mesh_.GetComm(), num_tdofs, pressure_space_->GlobalTrueVSize(), space.GlobalTrueVSize(), I.data(), J.data(),
+      data.data(), pressure_space_->GetTrueDofOffsets(), space.GetTrueDofOffsets());
+
+  unprojected_tdofs_ = mfem::Array<int>(static_cast<int>(unprojected.size()));
+  std::copy(unprojected.begin(), unprojected.end(), unprojected_tdofs_.begin());
+}
+
+void NodeToSurfaceContact::forces(mfem::Vector& f) const
+{
+  // each nodal pressure acts over the tributary area of its node
+  mfem::Vector nodal_forces(pressure_.Size());
+  for (int i = 0; i < pressure_.Size(); i++) {
+    nodal_forces[i] = tributary_areas_[i] * pressure_[i];
+  }
+  gap_jacobian_->MultTranspose(nodal_forces, f);
+}
+
+}  // namespace serac
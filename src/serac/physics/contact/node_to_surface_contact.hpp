@@ -0,0 +1,176 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file node_to_surface_contact.hpp
+ *
+ * @brief Node-to-surface contact kinematics: gaps and gap Jacobians of the nodes of one surface with respect to the
+ * segments of another
+ */
+
+#pragma once
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "mfem.hpp"
+
+namespace serac {
+
+/**
+ * @brief Computes node-to-surface contact gaps between two boundary surfaces of a mesh
+ *
+ * Each vertex of the second surface is projected onto the closest segment (boundary element) of the first surface in
+ * the current configuration. The gap of a vertex is its signed distance to that closest point along the segment
+ * normal, which is negative when the vertex penetrates the first surface. Only the vertices of the segments are used,
+ * so segments are treated as linear (quadrilaterals are split into two triangles), and the displacement field must be
+ * linear.
+ *
+ * Compared to mortar methods, no segment-to-segment integration is done, so a gap evaluation costs a closest point
+ * search per node over the segments found by a bounding volume hierarchy. Each rank sends its segments only to the
+ * ranks whose nodes are within reach of them, so that no redecomposition of the surfaces is needed.
+ *
+ * Each nodal pressure acts over the tributary area of its node (the row sum of the surface mass matrix of the
+ * pressure space), so that a penalty pressure p = kappa * g has the same units and scaling as in the mortar method.
+ *
+ * The gaps and pressures live on the true degrees of freedom of a linear H1 space on the second surface, so this
+ * class can stand in for Tribol's pressure and gap fields in a ContactInteraction.
+ */
+class NodeToSurfaceContact {
+public:
+  /**
+   * @brief The constructor
+   *
+   * @param mesh Mesh of the entire domain
+   * @param bdry_attr_surf1 MFEM boundary attributes for the first surface (whose segments are projected onto)
+   * @param bdry_attr_surf2 MFEM boundary attributes for the second surface (whose nodes are projected)
+   * @param current_coords Reference to the grid function holding current mesh coordinates
+   */
+  NodeToSurfaceContact(const mfem::ParMesh& mesh, const std::set<int>& bdry_attr_surf1,
+                       const std::set<int>& bdry_attr_surf2, const mfem::ParGridFunction& current_coords);
+
+  /**
+   * @brief Recomputes the closest point projections, gaps, and gap Jacobian from the current coordinates
+   */
+  void update();
+
+  /**
+   * @brief Get the contact forces B^T A p, where B is the gap Jacobian, A the tributary areas, and p the pressure
+   *
+   * @param[out] f Nodal contact forces on the displacement true DOFs
+   */
+  void forces(mfem::Vector& f) const;
+
+  /**
+   * @brief Get the nodal gaps on the true DOFs of the pressure space
+   *
+   * @return Nodal gaps, zero on nodes without a closest point projection
+   */
+  const mfem::Vector& gaps() const { return gaps_; }
+
+  /**
+   * @brief Get the derivative of the nodal gaps with respect to the displacement true DOFs
+   *
+   * @note The derivative of the segment normals is neglected, as in the approximate tangent of the mortar method
+   *
+   * @return Gap Jacobian with a row per pressure true DOF and a column per displacement true DOF
+   */
+  const mfem::HypreParMatrix& gapJacobian() const { return *gap_jacobian_; }
+
+  /**
+   * @brief Get the tributary area of each node of the second surface in the current configuration
+   *
+   * @return Nodal tributary areas (lengths in 2D) on the true DOFs of the pressure space
+   */
+  const mfem::Vector& tributaryAreas() const { return tributary_areas_; }
+
+  /**
+   * @brief Get the pressure on the true DOFs of the pressure space
+   *
+   * @return Nodal pressures
+   */
+  const mfem::Vector& pressure() const { return pressure_; }
+
+  /**
+   * @brief Set the pressure used to compute the contact forces
+   *
+   * @param pressure Nodal pressures on the true DOFs of the pressure space
+   */
+  void setPressure(const mfem::Vector& pressure) { pressure_ = pressure; }
+
+  /**
+   * @brief Get the finite element space of the pressure and gap DOFs (linear H1 on the second surface)
+   *
+   * @return mfem::ParFiniteElementSpace of the pressure DOFs
+   */
+  mfem::ParFiniteElementSpace& pressureSpace() const { return *pressure_space_; }
+
+  /**
+   * @brief List of pressure true DOFs whose node has no segment of the first surface within reach
+   *
+   * @return Array of unprojected DOFs
+   */
+  const mfem::Array<int>& unprojectedDofs() const { return unprojected_tdofs_; }
+
+private:
+  /**
+   * @brief Sends each segment of the first surface to the ranks that own nodes of the second surface within its reach
+   */
+  void exchangeSegments();
+
+  /**
+   * @brief Computes the tributary areas of the nodes of the second surface from the current coordinates
+   */
+  void computeTributaryAreas();
+
+  /// Mesh of the entire domain
+  const mfem::ParMesh& mesh_;
+
+  /// Reference to the current coords GridFunction
+  const mfem::ParGridFunction& current_coords_;
+
+  /// Local boundary element indices of the first surface
+  std::vector<int> segments_;
+
+  /// Boundary submesh of the second surface
+  std::unique_ptr<mfem::ParSubMesh> surface_;
+
+  /// Linear H1 collection for the pressure space
+  std::unique_ptr<mfem::H1_FECollection> pressure_fec_;
+
+  /// Pressure and gap space on the second surface
+  std::unique_ptr<mfem::ParFiniteElementSpace> pressure_space_;
+
+  /// Parent mesh vertex of each pressure true DOF
+  std::vector<int> node_vertices_;
+
+  /// Number of vertices of each exchanged segment
+  std::vector<int> segment_num_vertices_;
+
+  /// Current vertex coordinates of each exchanged segment
+  std::vector<double> segment_coords_;
+
+  /// Global displacement true DOFs of the vertices of each exchanged segment
+  std::vector<HYPRE_BigInt> segment_dofs_;
+
+  /// Nodal gaps on the pressure true DOFs
+  mfem::Vector gaps_;
+
+  /// Nodal pressures on the pressure true DOFs
+  mfem::Vector pressure_;
+
+  /// Nodal tributary areas on the pressure true DOFs
+  mfem::Vector tributary_areas_;
+
+  /// Derivative of the gaps with respect to the displacement true DOFs
+  std::unique_ptr<mfem::HypreParMatrix> gap_jacobian_;
+
+  /// Pressure true DOFs without a closest point projection
+  mfem::Array<int> unprojected_tdofs_;
+};
+
+}  // namespace serac
@@ -209,6 +209,12 @@ public:
         std::make_unique<ShapeAwareFunctional<shape_trial, test(scalar_trial, scalar_trial, parameter_space...)>>(
             shape_space, test_space, trial_spaces);
 
+    // If the user wants the geometric multigrid preconditioner, give it the levels of the mesh hierarchy
+    auto* multigrid_prec = dynamic_cast<GeometricMultigrid*>(&nonlin_solver_->preconditioner());
+    if (multigrid_prec) {
+      multigrid_prec->setHierarchy(StateManager::coarseMeshes(mesh_tag_), temperature_.space());
+    }
+
     nonlin_solver_->setOperator(residual_with_bcs_);
 
     int true_size = temperature_.space().TrueVSize();
@@ -461,6 +467,34 @@ public:
   /// @overload
   void setTemperature(const FiniteElementState temp) { temperature_ = temp; }
 
+  /**
+   * @brief Functor representing the integrand of a thermal source.  A functor is used here instead of an
+   * extended, generic lambda so that it can be fused with the material integrand.
+   */
+  template <typename SourceType>
+  struct SourceIntegrand {
+    /// @brief Constructor for the functor
+    SourceIntegrand(SourceType source_function) : source_function_(source_function) {}
+
+    /**
+     * @brief Evaluate integrand
+     */
+    template <typename X, typename T, typename dT_dt, typename... Params>
+    auto operator()(double t, X x, T temperature, dT_dt /* dtemp_dt */, Params... params) const
+    {
+      // Get the value and the gradient from the input tuple
+      auto [u, du_dX] = temperature;
+
+      auto source = source_function_(x, t, u, du_dX, params...);
+
+      // Return the source and the flux as a tuple
+      return serac::tuple{-1.0 * source, serac::zero{}};
+    }
+
+  private:
+    SourceType source_function_;
+  };
+
   /**
    * @brief Set the thermal source function
    *
@@ -490,18 +524,8 @@ public:
   {
     Domain domain = (optional_domain) ? *optional_domain : EntireDomain(mesh_);
 
-    residual_->AddDomainIntegral(
-        Dimension<dim>{}, DependsOn<0, 1, active_parameters + NUM_STATE_VARS...>{},
-        [source_function](double t, auto x, auto temperature, auto /* dtemp_dt */, auto... params) {
-          // Get the value and the gradient from the input tuple
-          auto [u, du_dX] = temperature;
-
-          auto source = source_function(x, t, u, du_dX, params...);
-
-          // Return the source and the flux as a tuple
-          return serac::tuple{-1.0 * source, serac::zero{}};
-        },
-        domain);
+    residual_->AddDomainIntegral(Dimension<dim>{}, DependsOn<0, 1, active_parameters + NUM_STATE_VARS...>{},
+                                 SourceIntegrand<SourceType>(source_function), domain);
   }
 
   /// @overload
@@ -511,6 +535,36 @@ public:
     setSource(DependsOn<>{}, source_function, optional_domain);
   }
 
+  /**
+   * @brief Set the thermal material model and a source over the entire domain, evaluated in a single element sweep
+   *
+   * This is equivalent to calling setMaterial() and then setSource() with the same arguments, but the material and
+   * source q-functions are fused (see fuse()), so the geometric factors, the trial field interpolation and the test
+   * function integration are done once instead of twice.
+   *
+   * @tparam MaterialType The thermal material type
+   * @tparam SourceType The type of the source function
+   * @param material A material containing heat capacity and thermal flux evaluation information, see setMaterial()
+   * @param source_function A source function for a prescribed thermal load, see setSource()
+   *
+   * @note Both q-functions receive the parameter fields specified in the `DependsOn<...>` argument
+   * @note This method must be called prior to completeSetup()
+   */
+  template <int... active_parameters, typename MaterialType, typename SourceType>
+  void setMaterialAndSource(DependsOn<active_parameters...>, const MaterialType& material, SourceType source_function)
+  {
+    residual_->AddDomainIntegral(
+        Dimension<dim>{}, DependsOn<0, 1, NUM_STATE_VARS + active_parameters...>{},
+        fuse(ThermalMaterialIntegrand<MaterialType>(material), SourceIntegrand<SourceType>(source_function)), mesh_);
+  }
+
+  /// @overload
+  template <typename MaterialType, typename SourceType>
+  void setMaterialAndSource(const MaterialType& material, SourceType source_function)
+  {
+    setMaterialAndSource(DependsOn<>{}, material, source_function);
+  }
+
   /**
    * @brief Set the thermal flux boundary condition
    *
@@ -705,12 +759,23 @@ public:
     temperature_.space().BuildDofToArrays();
 
     if (is_quasistatic_) {
+      // the residual and its jacobian from a single (differentiated) evaluation
+      auto residual_and_jacobian = [this](const mfem::Vector& u, mfem::Vector& r) -> mfem::Operator& {
+        auto [res, drdu] = (*residual_)(time_, shape_displacement_, differentiate_wrt(u), temperature_rate_,
+                                        *parameters_[parameter_indices].state...);
+        r = res;
+        r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+        J_   = assemble(drdu);
+        J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+        return *J_;
+      };
+
       residual_with_bcs_ = mfem_ext::StdFunctionOperator(
           temperature_.space().TrueVSize(),
 
           [this](const mfem::Vector& u, mfem::Vector& r) {
-            const mfem::Vector res = (*residual_)(time_, shape_displacement_, u, temperature_rate_,
-                                                  *parameters_[parameter_indices].state...);
+            const mfem::Vector& res = (*residual_)(time_, shape_displacement_, u, temperature_rate_,
+                                                   *parameters_[parameter_indices].state...);
 
             // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
             // tracking strategy
@@ -719,20 +784,33 @@ public:
             r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
           },
 
-          [this](const mfem::Vector& u) -> mfem::Operator& {
-            auto [r, drdu] = (*residual_)(time_, shape_displacement_, differentiate_wrt(u), temperature_rate_,
-                                          *parameters_[parameter_indices].state...);
-            J_             = assemble(drdu);
-            J_e_           = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
-            return *J_;
-          });
+          // the jacobian alone (the differentiated evaluation computes the residual anyway)
+          [residual_and_jacobian, r = mfem::Vector()](const mfem::Vector& u) mutable -> mfem::Operator& {
+            return residual_and_jacobian(u, r);
+          },
+
+          residual_and_jacobian);
     } else {
+      // the residual and its jacobian J := M + dt K = dR/du_dot + dt dR/du from a single (differentiated) evaluation
+      auto residual_and_jacobian = [this](const mfem::Vector& du_dt, mfem::Vector& r) -> mfem::Operator& {
+        add(1.0, u_, dt_, du_dt, u_predicted_);
+
+        auto [res, J] = (*residual_)(time_, shape_displacement_, differentiate_along(u_predicted_, dt_),
+                                     differentiate_along(du_dt, 1.0), *parameters_[parameter_indices].state...);
+        r = res;
+        r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+        J_   = assemble(J);
+        J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+
+        return *J_;
+      };
+
       residual_with_bcs_ = mfem_ext::StdFunctionOperator(
           temperature_.space().TrueVSize(),
 
           [this](const mfem::Vector& du_dt, mfem::Vector& r) {
             add(1.0, u_, dt_, du_dt, u_predicted_);
-            const mfem::Vector res =
+            const mfem::Vector& res =
                 (*residual_)(time_, shape_displacement_, u_predicted_, du_dt, *parameters_[parameter_indices].state...);
 
             // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
@@ -742,26 +820,12 @@ public:
             r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
           },
 
-          [this](const mfem::Vector& du_dt) -> mfem::Operator& {
-            add(1.0, u_, dt_, du_dt, u_predicted_);
-
-            // K := dR/du
-            auto K = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, differentiate_wrt(u_predicted_),
-                                                         du_dt, *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-            // M := dR/du_dot
-            auto M =
-                serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, u_predicted_, differentiate_wrt(du_dt),
-                                                    *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
-
-            // J := M + dt K
-            J_.reset(mfem::Add(1.0, *m_mat, dt_, *k_mat));
-            J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+          // the jacobian alone (the differentiated evaluation computes the residual anyway)
+          [residual_and_jacobian, r = mfem::Vector()](const mfem::Vector& du_dt) mutable -> mfem::Operator& {
+            return residual_and_jacobian(du_dt, r);
+          },
 
-            return *J_;
-          });
+          residual_and_jacobian);
     }
 
     if (checkpoint_to_disk_) {
@@ -878,18 +942,11 @@ public:
 
       temperature_rate_ = end_step_solution.at("temperature_rate");
 
-      // K := dR/du
-      auto K = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, differentiate_wrt(temperature_),
-                                                   temperature_rate_, *parameters_[parameter_indices].state...));
-      std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-      // M := dR/du_dot
-      auto M = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, temperature_,
-                                                   differentiate_wrt(temperature_rate_),
+      // J := M + dt K = dR/du_dot + dt dR/du
+      auto J = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, differentiate_along(temperature_, dt),
+                                                   differentiate_along(temperature_rate_, 1.0),
                                                    *parameters_[parameter_indices].state...));
-      std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
-
-      J_.reset(mfem::Add(1.0, *m_mat, dt, *k_mat));
+      J_       = assemble(J);
       auto J_T = std::unique_ptr<mfem::HypreParMatrix>(J_->Transpose());
 
       // recall that temperature_adjoint_load_vector and d_temperature_dt_adjoint_load_vector were already multiplied by
@@ -44,6 +44,33 @@ struct LinearIsotropic {
     return lambda * tr(epsilon) * I + 2.0 * G * epsilon;
   }
 
+  /**
+   * @brief stress calculation for a linear isotropic material model, along with its closed-form tangent
+   *
+   * @tparam dim Dimensionality of space
+   * @param state the (empty) internal variables
+   * @param du_dX Displacement gradient with respect to the reference configuration
+   * @return tuple{stress, tangent}, where tangent(i, j, k, l) is the derivative of stress(i, j) w.r.t. du_dX(k, l)
+   */
+  template <int dim>
+  SERAC_HOST_DEVICE auto stress_and_tangent(State& state, const tensor<double, dim, dim>& du_dX) const
+  {
+    auto lambda = K - (2.0 / 3.0) * G;
+
+    tensor<double, dim, dim, dim, dim> C{};
+    for (int i = 0; i < dim; i++) {
+      for (int j = 0; j < dim; j++) {
+        for (int k = 0; k < dim; k++) {
+          for (int l = 0; l < dim; l++) {
+            C(i, j, k, l) = lambda * (i == j) * (k == l) + G * ((i == k) * (j == l) + (i == l) * (j == k));
+          }
+        }
+      }
+    }
+
+    return serac::tuple{(*this)(state, du_dX), C};
+  }
+
   double density;  ///< mass density
   double K;        ///< bulk modulus
   double G;        ///< shear modulus
@@ -255,6 +282,84 @@ struct J2SmallStrain {
 
     return s + p * I;
   }
+
+  /**
+   * @brief calculate the Cauchy stress and its consistent tangent, given the displacement gradient and
+   * previous material state
+   *
+   * The stress and state update are the same as `operator()`, but the derivative of the stress
+   * w.r.t. the displacement gradient is evaluated in closed form, rather than by propagating
+   * dual numbers through the return mapping.
+   *
+   * @return tuple{stress, tangent}, where tangent(i, j, k, l) is the derivative of stress(i, j) w.r.t. du_dX(k, l)
+   */
+  auto stress_and_tangent(State& state, const tensor<double, dim, dim>& du_dX) const
+  {
+    using std::sqrt;
+    constexpr auto I = Identity<dim>();
+    const double   K = E / (3.0 * (1.0 - 2.0 * nu));
+    const double   G = 0.5 * E / (1.0 + nu);
+
+    // (i) elastic predictor
+    auto   el_strain = sym(du_dX) - state.plastic_strain;
+    auto   p         = K * tr(el_strain);
+    auto   s         = 2.0 * G * dev(el_strain);
+    auto   sigma_b   = 2.0 / 3.0 * Hk * state.plastic_strain;
+    auto   eta       = s - sigma_b;
+    double q         = sqrt(1.5) * norm(eta);
+
+    // elastic tangent, K (I x I) + 2 G P_dev, where P_dev also extracts the symmetric part of du_dX
+    tensor<double, dim, dim, dim, dim> P_dev{};
+    tensor<double, dim, dim, dim, dim> C{};
+    for (int i = 0; i < dim; i++) {
+      for (int j = 0; j < dim; j++) {
+        for (int k = 0; k < dim; k++) {
+          for (int l = 0; l < dim; l++) {
+            P_dev(i, j, k, l) = 0.5 * ((i == k) * (j == l) + (i == l) * (j == k)) - (i == j) * (k == l) / 3.0;
+            C(i, j, k, l)     = K * (i == j) * (k == l) + 2.0 * G * P_dev(i, j, k, l);
+          }
+        }
+      }
+    }
+
+    // (ii) admissibility
+    const double eqps_old = state.accumulated_plastic_strain;
+    auto         residual = [eqps_old, G, *this](auto delta_eqps, auto trial_q) {
+      return trial_q - (3.0 * G + Hk) * delta_eqps - this->hardening(eqps_old + delta_eqps);
+    };
+    if (residual(0.0, q) > tol * hardening.sigma_y) {
+      // (iii) return mapping
+      ScalarSolverOptions opts{.xtol = 0, .rtol = tol * hardening.sigma_y, .max_iter = 25};
+      double              lower_bound = 0.0;
+      double              upper_bound = (q - hardening(eqps_old)) / (3.0 * G + Hk);
+      auto [delta_eqps, status]       = solve_scalar_equation(residual, 0.0, lower_bound, upper_bound, opts, q);
+
+      auto Np = 1.5 * eta / q;
+
+      s = s - 2.0 * G * delta_eqps * Np;
+      state.accumulated_plastic_strain += delta_eqps;
+      state.plastic_strain += delta_eqps * Np;
+
+      // consistent tangent:
+      //   C = C_elastic - 6 G^2 (delta_eqps / q) (P_dev - n x n) - (6 G^2 / (3 G + Hk + H_iso)) (n x n)
+      // where n = eta / norm(eta), and H_iso is the slope of the isotropic hardening curve
+      double H_iso = get_gradient(hardening(make_dual(eqps_old + delta_eqps)));
+      double c1    = 6.0 * G * G * delta_eqps / q;
+      double c2    = 6.0 * G * G / (3.0 * G + Hk + H_iso);
+      auto   n     = eta / norm(eta);
+      for (int i = 0; i < dim; i++) {
+        for (int j = 0; j < dim; j++) {
+          for (int k = 0; k < dim; k++) {
+            for (int l = 0; l < dim; l++) {
+              C(i, j, k, l) += (c1 - c2) * n(i, j) * n(k, l) - c1 * P_dev(i, j, k, l);
+            }
+          }
+        }
+      }
+    }
+
+    return serac::tuple{s + p * I, C};
+  }
 };
 
 /// @brief Finite deformation version of J2 material with nonlinear isotropic hardening.
@@ -325,6 +430,72 @@ struct J2 {
   }
 };
 
+/// @cond
+namespace detail {
+
+template <typename Material, typename State, typename Gradient, typename... Params>
+auto has_stress_and_tangent(int)
+    -> decltype(std::declval<const Material&>().stress_and_tangent(std::declval<State&>(),
+                                                                   std::declval<const Gradient&>(),
+                                                                   std::declval<const Params&>()...),
+                std::true_type{});
+
+template <typename...>
+std::false_type has_stress_and_tangent(...);
+
+template <typename T>
+constexpr bool contains_no_duals = std::is_same_v<std::decay_t<decltype(get_value(std::declval<T>()))>, T>;
+
+}  // namespace detail
+/// @endcond
+
+/**
+ * @brief whether or not a material implements
+ * `stress_and_tangent(state, du_dX, params...)`, returning `tuple{stress, tangent}`
+ */
+template <typename Material, typename State, typename Gradient, typename... Params>
+inline constexpr bool has_stress_and_tangent_v =
+    decltype(detail::has_stress_and_tangent<Material, State, Gradient, Params...>(0))::value;
+
+/**
+ * @brief evaluate a material's stress response, using the material's closed-form tangent
+ * (if it provides one) in place of forward-mode AD through the stress calculation
+ *
+ * When `du_dX` is a tensor of dual numbers and the parameters are not, materials that implement
+ * `stress_and_tangent` are evaluated with the values of `du_dX`, and the gradients of the returned stress are
+ * assembled from the tangent by the chain rule. All other cases call `material(state, du_dX, params...)`.
+ *
+ * @param material the material model
+ * @param state the internal variables of the material
+ * @param du_dX the displacement gradient
+ * @param params any additional material parameters
+ * @return the Cauchy stress (with the same kind of derivative information as `material(state, du_dX, params...)`)
+ */
+template <typename Material, typename State, typename T, int dim, typename... Params>
+SERAC_HOST_DEVICE auto evaluate_stress(const Material& material, State& state, const tensor<T, dim, dim>& du_dX,
+                                       const Params&... params)
+{
+  if constexpr (is_dual_number<T>::value && (detail::contains_no_duals<Params> && ...) &&
+                has_stress_and_tangent_v<Material, State, tensor<double, dim, dim>, Params...>) {
+    auto [stress, C] = material.stress_and_tangent(state, get_value(du_dX), params...);
+
+    tensor<T, dim, dim> output{};
+    for (int i = 0; i < dim; i++) {
+      for (int j = 0; j < dim; j++) {
+        output(i, j).value = stress(i, j);
+        for (int k = 0; k < dim; k++) {
+          for (int l = 0; l < dim; l++) {
+            output(i, j).gradient = output(i, j).gradient + C(i, j, k, l) * du_dX(k, l).gradient;
+          }
+        }
+      }
+    }
+    return output;
+  } else {
+    return material(state, du_dX, params...);
+  }
+}
+
 /**
  * @brief Transform the Kirchhoff stress to the Piola stress
  *
@@ -148,6 +148,68 @@ TEST(J2SmallStrain, SatisfiesConsistency)
   EXPECT_LT(norm(s - dev(stress)) / norm(s), 1e-9);
 };
 
+TEST(J2SmallStrain, AnalyticTangentMatchesAD)
+{
+  using Hardening = solid_mechanics::PowerLawHardening;
+  using Material  = solid_mechanics::J2SmallStrain<Hardening>;
+
+  Hardening hardening{.sigma_y = 350e6, .n = 3, .eps0 = 0.00175};
+  Material  material{.E = 200e9, .nu = 0.25, .hardening = hardening, .Hk = 20e9, .density = 1.0};
+
+  // clang-format off
+  const tensor<double, 3, 3> H{{
+    { 0.025, -0.008,  0.005},
+    {-0.008, -0.01,   0.003},
+    { 0.005,  0.003,  0.0}}};
+  // clang-format on
+
+  // check both the plastic (H) and elastic (1e-4 * H) branches
+  for (double scale : {1.0, 1.0e-4}) {
+    auto state_AD       = Material::State{};
+    auto stress_AD      = material(state_AD, make_dual(scale * H));
+    auto state_analytic = Material::State{};
+    auto [stress, C]    = material.stress_and_tangent(state_analytic, scale * H);
+
+    EXPECT_LT(norm(stress - get_value(stress_AD)), 1e-12 * norm(stress));
+    EXPECT_LT(norm(C - get_gradient(stress_AD)), 1e-10 * norm(C));
+    EXPECT_NEAR(state_analytic.accumulated_plastic_strain, state_AD.accumulated_plastic_strain, 1e-14);
+    EXPECT_LT(norm(state_analytic.plastic_strain - state_AD.plastic_strain), 1e-14);
+
+    // the stress evaluated through the analytic-tangent path should carry the same derivatives as AD
+    auto state_dispatch  = Material::State{};
+    auto stress_dispatch = solid_mechanics::evaluate_stress(material, state_dispatch, make_dual(scale * H));
+    EXPECT_LT(norm(get_gradient(stress_dispatch) - get_gradient(stress_AD)), 1e-10 * norm(C));
+  }
+}
+
+TEST(LinearIsotropic, AnalyticTangentMatchesAD)
+{
+  solid_mechanics::LinearIsotropic        material{.density = 1.0, .K = 160e9, .G = 80e9};
+  solid_mechanics::LinearIsotropic::State state{};
+
+  // clang-format off
+  const tensor<double, 3, 3> H{{
+    { 0.025, -0.008,  0.005},
+    {-0.002, -0.01,   0.003},
+    { 0.009,  0.001,  0.0}}};
+  // clang-format on
+
+  // the 3D tangent, and the plane strain tangent of the in-plane components
+  auto check = [&](const auto& du_dX) {
+    auto stress_AD   = material(state, make_dual(du_dX));
+    auto [stress, C] = material.stress_and_tangent(state, du_dX);
+
+    EXPECT_LT(norm(stress - get_value(stress_AD)), 1e-12 * norm(stress));
+    EXPECT_LT(norm(C - get_gradient(stress_AD)), 1e-12 * norm(C));
+
+    auto stress_dispatch = solid_mechanics::evaluate_stress(material, state, make_dual(du_dX));
+    EXPECT_LT(norm(get_gradient(stress_dispatch) - get_gradient(stress_AD)), 1e-12 * norm(C));
+  };
+
+  check(H);
+  check(tensor<double, 2, 2>{{{H(0, 0), H(0, 1)}, {H(1, 0), H(1, 1)}}});
+}
+
 TEST(J2SmallStrain, Uniaxial)
 {
   using Hardening = solid_mechanics::LinearHardening;
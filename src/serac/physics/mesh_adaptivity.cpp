@@ -0,0 +1,177 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/physics/mesh_adaptivity.hpp"
+
+#include <algorithm>
+
+namespace serac {
+
+mfem::Vector estimateError(const FiniteElementState& field, mfem::BilinearFormIntegrator& flux_integrator,
+                           int flux_components)
+{
+  auto& space = const_cast<mfem::ParFiniteElementSpace&>(field.space());
+  auto* mesh  = space.GetParMesh();
+
+  // the recovered flux is discontinuous, one order lower than the field
+  int                         order = std::max(space.GetMaxElementOrder() - 1, 0);
+  mfem::L2_FECollection       flux_fec(order, mesh->Dimension());
+  mfem::ParFiniteElementSpace flux_space(mesh, &flux_fec, flux_components);
+  mfem::ParGridFunction       solution(&space);
+  field.fillGridFunction(solution);
+
+  mfem::KellyErrorEstimator estimator(flux_integrator, solution, flux_space);
+  return estimator.GetLocalErrors();
+}
+
+void addBoundaryCost(mfem::Vector& costs, const Domain& boundary, double cost)
+{
+  SLIC_ERROR_IF(boundary.type_ != Domain::Type::BoundaryElements, "addBoundaryCost() requires a boundary Domain");
+
+  const mfem::Mesh& mesh = boundary.mesh_;
+  for (const auto* face_ids : {&boundary.mfem_edge_ids_, &boundary.mfem_tri_ids_, &boundary.mfem_quad_ids_}) {
+    for (int f : *face_ids) {
+      int elem1, elem2;
+      mesh.GetFaceElements(f, &elem1, &elem2);
+      costs[elem1] += cost;
+    }
+  }
+}
+
+namespace detail {
+
+std::vector<ElementId> elementIds(const mfem::Mesh& mesh)
+{
+  std::vector<ElementId>              ids(std::size_t(mesh.GetNE()));
+  std::map<mfem::Geometry::Type, int> next_index;
+  for (int e = 0; e < mesh.GetNE(); e++) {
+    auto geom           = mesh.GetElementGeometry(e);
+    ids[std::size_t(e)] = ElementId{geom, next_index[geom]++};
+  }
+  return ids;
+}
+
+std::vector<int> previousElements(mfem::ParMesh& mesh)
+{
+  std::vector<int> previous(std::size_t(mesh.GetNE()), -1);
+
+  if (mesh.GetLastOperation() == mfem::Mesh::REFINE) {
+    // each new element records which of the old elements is its parent
+    const mfem::CoarseFineTransformations& transforms = mesh.GetRefinementTransforms();
+    for (int e = 0; e < mesh.GetNE(); e++) {
+      previous[std::size_t(e)] = transforms.embeddings[e].parent;
+    }
+  }
+
+  if (mesh.GetLastOperation() == mfem::Mesh::DEREFINE) {
+    // each old element records which of the new elements it was merged into
+    const mfem::CoarseFineTransformations& transforms = mesh.ncmesh->GetDerefinementTransforms();
+    for (int k = 0; k < transforms.embeddings.Size(); k++) {
+      previous[std::size_t(transforms.embeddings[k].parent)] = k;
+    }
+  }
+
+  SLIC_ERROR_IF(std::count(previous.begin(), previous.end(), -1) > 0,
+                "unable to determine how the mesh's elements were created");
+
+  return previous;
+}
+
+std::vector<FiniteElementVector*> fieldsToTransfer(const mfem::ParMesh&                     mesh,
+                                                   const std::vector<FiniteElementVector*>& fields)
+{
+  std::vector<FiniteElementVector*> all_fields = fields;
+  if (StateManager::ownsMesh(&mesh)) {
+    FiniteElementVector* shape = &StateManager::shapeDisplacement(StateManager::collectionID(&mesh));
+    if (std::find(fields.begin(), fields.end(), shape) == fields.end()) {
+      all_fields.push_back(shape);
+    }
+  }
+  return all_fields;
+}
+
+void updateStateManager(const mfem::ParMesh& mesh)
+{
+  if (StateManager::ownsMesh(&mesh)) {
+    StateManager::updateMesh(StateManager::collectionID(&mesh));
+  }
+}
+
+std::vector<std::unique_ptr<mfem::ParGridFunction> > localValues(const std::vector<FiniteElementVector*>& fields)
+{
+  std::vector<std::unique_ptr<mfem::ParGridFunction> > values;
+  for (auto* field : fields) {
+    values.push_back(std::make_unique<mfem::ParGridFunction>(&field->space()));
+    values.back()->SetFromTrueDofs(*field);
+  }
+  return values;
+}
+
+void updateFields(const std::vector<FiniteElementVector*>&              fields,
+                  std::vector<std::unique_ptr<mfem::ParGridFunction> >& values)
+{
+  for (std::size_t i = 0; i < fields.size(); i++) {
+    fields[i]->update(*values[i]);
+    fields[i]->space().UpdatesFinished();
+  }
+}
+
+mfem::Array<int> weightedPartition(const mfem::ParMesh& mesh, const mfem::Vector& costs)
+{
+  MPI_Comm comm = mesh.GetComm();
+
+  int num_ranks;
+  MPI_Comm_size(comm, &num_ranks);
+
+  // the total cost of the elements before this rank's along the space-filling curve
+  double local_cost = costs.Sum();
+  double offset     = 0.0;
+  double total_cost = 0.0;
+  MPI_Exscan(&local_cost, &offset, 1, MPI_DOUBLE, MPI_SUM, comm);
+  MPI_Allreduce(&local_cost, &total_cost, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  if (rank == 0) {
+    offset = 0.0;  // MPI_Exscan leaves the result undefined on the first rank
+  }
+
+  // each element goes to the rank whose piece of the curve contains the element's midpoint
+  mfem::Array<int> partition(mesh.GetNE());
+  for (int e = 0; e < mesh.GetNE(); e++) {
+    double midpoint = offset + 0.5 * costs[e];
+    offset += costs[e];
+    partition[e] = (total_cost > 0.0) ? std::min(int(num_ranks * midpoint / total_cost), num_ranks - 1) : rank;
+  }
+
+  return partition;
+}
+
+std::vector<char> exchange(const std::vector<char>& send, const std::vector<int>& send_counts, MPI_Comm comm)
+{
+  int num_ranks;
+  MPI_Comm_size(comm, &num_ranks);
+
+  std::vector<int> recv_counts(std::size_t(num_ranks));
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, comm);
+
+  std::vector<int> send_offsets(std::size_t(num_ranks), 0);
+  std::vector<int> recv_offsets(std::size_t(num_ranks), 0);
+  for (std::size_t r = 1; r < std::size_t(num_ranks); r++) {
+    send_offsets[r] = send_offsets[r - 1] + send_counts[r - 1];
+    recv_offsets[r] = recv_offsets[r - 1] + recv_counts[r - 1];
+  }
+
+  std::vector<char> received(std::size_t(recv_offsets.back() + recv_counts.back()));
+  MPI_Alltoallv(send.data(), send_counts.data(), send_offsets.data(), MPI_CHAR, received.data(), recv_counts.data(),
+                recv_offsets.data(), MPI_CHAR, comm);
+
+  return received;
+}
+
+}  // namespace detail
+
+}  // namespace serac
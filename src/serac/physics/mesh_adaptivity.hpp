@@ -0,0 +1,403 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file mesh_adaptivity.hpp
+ *
+ * @brief Helpers for adaptively refining, derefining and rebalancing a (nonconforming) mesh between solves,
+ * and transferring finite element fields and quadrature point data onto the updated mesh
+ *
+ * A typical adaptive cycle looks like
+ *
+ * @code{.cpp}
+ * mfem::DiffusionIntegrator flux;
+ * mfem::Vector              errors = estimateError(temperature, flux, dim);
+ * if (adaptMesh(mesh, errors, options, {&temperature}, *qdata)) {
+ *   // the physics module's Functionals were built for the old mesh, so
+ *   // a new module is created (with the transferred fields as its initial conditions)
+ * }
+ * @endcode
+ *
+ * When the mesh is held by StateManager, its shape displacement field is transferred along with the given fields,
+ * and StateManager's fields for the mesh are updated (see StateManager::updateMesh), so that the rebuilt physics
+ * modules can register their fields again.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+#include "serac/numerics/functional/domain.hpp"
+#include "serac/numerics/functional/quadrature_data.hpp"
+#include "serac/physics/state/finite_element_state.hpp"
+#include "serac/physics/state/state_manager.hpp"
+
+namespace serac {
+
+/// @brief parameters that control how adaptMesh() changes the mesh
+struct AdaptivityOptions {
+  /// @brief elements whose error estimate exceeds this value are refined
+  double refine_threshold;
+
+  /**
+   * @brief if positive, groups of sibling elements whose combined error estimate is below this value are
+   * derefined (only considered when no element needs refinement)
+   */
+  double derefine_threshold = 0.0;
+
+  /// @brief the maximum level of hanging nodes (0 means unlimited)
+  int nc_limit = 0;
+
+  /// @brief whether to rebalance the parallel mesh (giving each rank the same number of elements) after it changes
+  bool rebalance = true;
+};
+
+/**
+ * @brief compute a flux-jump (Kelly) error estimate for each element of a field's mesh
+ *
+ * @param field the finite element field (e.g. temperature or displacement)
+ * @param flux_integrator the integrator that defines the flux of the field,
+ * e.g. mfem::DiffusionIntegrator for HeatTransfer or mfem::ElasticityIntegrator for SolidMechanics
+ * @param flux_components the number of components of that flux (dim for mfem::DiffusionIntegrator,
+ * dim * (dim + 1) / 2 for mfem::ElasticityIntegrator)
+ * @return the error estimate for each (local) element
+ */
+mfem::Vector estimateError(const FiniteElementState& field, mfem::BilinearFormIntegrator& flux_integrator,
+                           int flux_components);
+
+namespace detail {
+
+/// @brief the geometry of an element, and its index among the elements with that geometry
+struct ElementId {
+  mfem::Geometry::Type geometry;  ///< the element geometry
+  int                  index;     ///< which element of that geometry
+};
+
+/// @brief return the ElementId of each element in the mesh (i.e. how QuadratureData is indexed)
+std::vector<ElementId> elementIds(const mfem::Mesh& mesh);
+
+/**
+ * @brief after the mesh is refined or derefined, return the element (from before that change)
+ * that each of the mesh's elements was created from
+ */
+std::vector<int> previousElements(mfem::ParMesh& mesh);
+
+/**
+ * @brief the fields to transfer when the mesh changes: the given fields, and the shape displacement field of the mesh
+ * if it is held by StateManager
+ */
+std::vector<FiniteElementVector*> fieldsToTransfer(const mfem::ParMesh&                     mesh,
+                                                   const std::vector<FiniteElementVector*>& fields);
+
+/// @brief update StateManager's fields for the mesh after it changed, if the mesh is held by StateManager
+void updateStateManager(const mfem::ParMesh& mesh);
+
+/// @brief save the local (L-vector) values of each field, in preparation for a change to the mesh
+std::vector<std::unique_ptr<mfem::ParGridFunction> > localValues(const std::vector<FiniteElementVector*>& fields);
+
+/// @brief update each field's space after a change to the mesh, transferring the values saved by localValues()
+void updateFields(const std::vector<FiniteElementVector*>&              fields,
+                  std::vector<std::unique_ptr<mfem::ParGridFunction> >& values);
+
+/**
+ * @brief copy the quadrature point data of each element on the updated mesh from the element it was created from
+ *
+ * When refining, each child inherits the data of its parent. When derefining, the parent inherits the
+ * data of one of its children. Quadrature points are matched by index, rather than interpolated,
+ * since the stored type is arbitrary (e.g. the internal variables of a plasticity model).
+ */
+template <typename T>
+void transferQuadratureData(QuadratureData<T>& qdata, const mfem::Mesh& mesh, const std::vector<ElementId>& old_ids,
+                            const std::vector<int>& previous_elements)
+{
+  if constexpr (std::is_same_v<T, Nothing> || std::is_same_v<T, Empty>) {
+    return;
+  } else {
+    SLIC_ERROR_IF(qdata.storage == QuadratureDataStorage::Sparse,
+                  "transferring sparse quadrature data between meshes is not supported");
+
+    std::map<mfem::Geometry::Type, int> counts;
+    for (int e = 0; e < mesh.GetNE(); e++) {
+      counts[mesh.GetElementGeometry(e)]++;
+    }
+
+    std::map<mfem::Geometry::Type, axom::Array<T, 2> > new_data;
+    for (auto [geom, count] : counts) {
+      SLIC_ERROR_IF(qdata.data.count(geom) == 0, "no quadrature data for elements of this geometry");
+      new_data[geom] = axom::Array<T, 2>(count, qdata.data.at(geom).shape()[1]);
+    }
+
+    std::map<mfem::Geometry::Type, int> next_index;
+    for (int e = 0; e < mesh.GetNE(); e++) {
+      auto      geom = mesh.GetElementGeometry(e);
+      int       i    = next_index[geom]++;
+      ElementId old  = old_ids[std::size_t(previous_elements[std::size_t(e)])];
+      SLIC_ERROR_IF(old.geometry != geom, "element geometry changed during refinement");
+
+      auto& old_data = qdata.data.at(geom);
+      for (int q = 0; q < old_data.shape()[1]; q++) {
+        new_data[geom](i, q) = old_data(old.index, q);
+      }
+    }
+
+    qdata.data = std::move(new_data);
+  }
+}
+
+/// @brief transfer the quadrature point data of each buffer, see transferQuadratureData()
+template <typename... T>
+void updateQuadratureData(mfem::ParMesh& mesh, const std::vector<ElementId>& old_ids, QuadratureData<T>&... qdata)
+{
+  if constexpr (sizeof...(T) > 0) {
+    std::vector<int> previous_elements = previousElements(mesh);
+    (transferQuadratureData(qdata, mesh, old_ids, previous_elements), ...);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief estimate the cost of each element from its quadrature point data
+ *
+ * e.g. for a J2 material, the points that are yielding run the return map, so
+ * @code{.cpp}
+ * auto costs = elementCosts(mesh, *qdata, [](const auto& state) {
+ *   return (state.accumulated_plastic_strain > 0.0) ? 4.0 : 1.0;
+ * });
+ * @endcode
+ *
+ * @param mesh the mesh
+ * @param qdata the quadrature point data associated with the mesh
+ * @param cost_of_point callable that returns the (relative) cost of a quadrature point, given its data
+ * @return the cost of each element
+ */
+template <typename T, typename callable>
+mfem::Vector elementCosts(const mfem::Mesh& mesh, QuadratureData<T>& qdata, const callable& cost_of_point)
+{
+  auto         ids = detail::elementIds(mesh);
+  mfem::Vector costs(mesh.GetNE());
+  for (int e = 0; e < mesh.GetNE(); e++) {
+    auto [geom, i] = ids[std::size_t(e)];
+    auto data      = qdata.view(geom);
+    costs[e]       = 0.0;
+    for (uint32_t q = 0; q < data.qpts_per_element(); q++) {
+      costs[e] += cost_of_point(data(uint32_t(i), q));
+    }
+  }
+  return costs;
+}
+
+/**
+ * @brief add a fixed cost to each element adjacent to the boundary elements of a Domain,
+ * e.g. to account for the contact work done near a contact surface
+ *
+ * @param costs the cost of each element
+ * @param boundary a Domain of boundary elements
+ * @param cost the cost added for each boundary element
+ */
+void addBoundaryCost(mfem::Vector& costs, const Domain& boundary, double cost);
+
+namespace detail {
+
+/**
+ * @brief partition the mesh's elements so that every rank gets (nearly) the same total cost
+ *
+ * The elements of a nonconforming parallel mesh are ordered along a space-filling curve, with each rank
+ * owning a contiguous range of that curve, so the curve is split into pieces of equal cost. This means each
+ * rank receives a contiguous range of the curve, and its new elements are ordered by where they came from.
+ *
+ * @return the rank that each (local) element is assigned to
+ */
+mfem::Array<int> weightedPartition(const mfem::ParMesh& mesh, const mfem::Vector& costs);
+
+/**
+ * @brief send contiguous pieces of a buffer to the other ranks
+ *
+ * @param send the data to send, ordered by destination rank
+ * @param send_counts the number of bytes sent to each rank
+ * @param comm the communicator
+ * @return the received data, ordered by source rank
+ */
+std::vector<char> exchange(const std::vector<char>& send, const std::vector<int>& send_counts, MPI_Comm comm);
+
+/// @brief move the quadrature point data of each element to the rank it is assigned to in `partition`
+template <typename T>
+class QuadratureDataMigration {
+public:
+  /// @brief send the quadrature point data of each element to its new owner, in preparation for a rebalance
+  QuadratureDataMigration(QuadratureData<T>& qdata, const mfem::ParMesh& mesh, const mfem::Array<int>& partition)
+      : qdata_(qdata)
+  {
+    if constexpr (!std::is_same_v<T, Nothing> && !std::is_same_v<T, Empty>) {
+      static_assert(std::is_trivially_copyable_v<T>, "quadrature data must be trivially copyable to be migrated");
+      SLIC_ERROR_IF(qdata.storage == QuadratureDataStorage::Sparse,
+                    "migrating sparse quadrature data between ranks is not supported");
+
+      int num_ranks;
+      MPI_Comm_size(mesh.GetComm(), &num_ranks);
+
+      std::vector<char> send;
+      std::vector<int>  send_counts(std::size_t(num_ranks), 0);
+
+      auto ids = elementIds(mesh);
+      for (int e = 0; e < mesh.GetNE(); e++) {
+        auto [geom, i] = ids[std::size_t(e)];
+        auto data      = qdata[geom];
+        int  num_bytes = int(data.shape()[1] * sizeof(T));
+        for (int q = 0; q < data.shape()[1]; q++) {
+          const char* bytes = reinterpret_cast<const char*>(&data(i, q));
+          send.insert(send.end(), bytes, bytes + sizeof(T));
+        }
+        send_counts[std::size_t(partition[e])] += num_bytes;
+      }
+
+      received_ = exchange(send, send_counts, mesh.GetComm());
+    }
+  }
+
+  /// @brief store the received quadrature point data, after the mesh has been rebalanced
+  void finish(const mfem::Mesh& mesh)
+  {
+    if constexpr (!std::is_same_v<T, Nothing> && !std::is_same_v<T, Empty>) {
+      auto ids = elementIds(mesh);
+
+      std::map<mfem::Geometry::Type, int> counts;
+      for (auto [geom, i] : ids) {
+        counts[geom] = std::max(counts[geom], i + 1);
+      }
+
+      std::map<mfem::Geometry::Type, axom::Array<T, 2> > new_data;
+      for (auto [geom, count] : counts) {
+        SLIC_ERROR_IF(qdata_.data.count(geom) == 0, "no quadrature data for elements of this geometry");
+        new_data[geom] = axom::Array<T, 2>(count, qdata_.data.at(geom).shape()[1]);
+      }
+
+      // the received data is ordered like the new elements (see weightedPartition)
+      const char* bytes = received_.data();
+      for (auto [geom, i] : ids) {
+        auto& data = new_data[geom];
+        for (int q = 0; q < data.shape()[1]; q++) {
+          std::memcpy(&data(i, q), bytes, sizeof(T));
+          bytes += sizeof(T);
+        }
+      }
+      SLIC_ERROR_IF(bytes != received_.data() + received_.size(), "received quadrature data doesn't match the mesh");
+
+      qdata_.data = std::move(new_data);
+    }
+  }
+
+private:
+  /// @brief the buffer being migrated
+  QuadratureData<T>& qdata_;
+
+  /// @brief the quadrature point data received from other ranks
+  std::vector<char> received_;
+};
+
+/// @brief rebalance the mesh and migrate the fields and quadrature data, see rebalanceMesh()
+template <typename... T>
+void rebalance(mfem::ParMesh& mesh, const mfem::Vector& costs, const std::vector<FiniteElementVector*>& fields,
+               QuadratureData<T>&... qdata)
+{
+  SLIC_ERROR_IF(costs.Size() != mesh.GetNE(), "rebalanceMesh() requires a cost for each element");
+
+  mfem::Array<int> partition = weightedPartition(mesh, costs);
+
+  auto values     = localValues(fields);
+  auto migrations = std::make_tuple(QuadratureDataMigration<T>(qdata, mesh, partition)...);
+
+  mesh.Rebalance(partition);
+
+  updateFields(fields, values);
+  std::apply([&](auto&... migration) { (migration.finish(mesh), ...); }, migrations);
+}
+
+}  // namespace detail
+
+/**
+ * @brief repartition a nonconforming parallel mesh so that each rank has the same total element cost,
+ * and migrate the given fields and quadrature data to their new owners
+ *
+ * @param mesh the mesh to rebalance, which must be nonconforming (see mfem::Mesh::EnsureNCMesh)
+ * @param costs the cost of each element, e.g. from elementCosts()
+ * @param fields the fields defined on the mesh
+ * @param qdata quadrature data buffers (e.g. material state), whose data type must be trivially copyable
+ *
+ * @note Functionals (and the physics modules that own them, including their boundary conditions)
+ * must be rebuilt after the mesh is rebalanced. A mesh held by StateManager also has its shape displacement
+ * migrated, and its other StateManager fields forgotten, see StateManager::updateMesh.
+ */
+template <typename... T>
+void rebalanceMesh(mfem::ParMesh& mesh, const mfem::Vector& costs, const std::vector<FiniteElementVector*>& fields,
+                   QuadratureData<T>&... qdata)
+{
+  SLIC_ERROR_ROOT_IF(!mesh.Nonconforming(), "rebalanceMesh() requires a nonconforming mesh");
+
+  detail::rebalance(mesh, costs, detail::fieldsToTransfer(mesh, fields), qdata...);
+  detail::updateStateManager(mesh);
+}
+
+/**
+ * @brief refine (or derefine) a nonconforming mesh according to an error estimate, and
+ * transfer the given fields and quadrature point data onto the adapted mesh
+ *
+ * @param mesh the mesh to adapt, which must be nonconforming (see mfem::Mesh::EnsureNCMesh)
+ * @param errors the error estimate for each element, e.g. from estimateError()
+ * @param options the refinement/derefinement thresholds
+ * @param fields the fields defined on the mesh, whose values are interpolated onto the adapted mesh
+ * @param qdata quadrature data buffers (e.g. material state) to transfer onto the adapted mesh
+ * @return whether or not the mesh was changed
+ *
+ * @note Functionals (and the physics modules that own them) must be rebuilt when the mesh changes. A mesh held
+ * by StateManager also has its shape displacement transferred, and its other StateManager fields forgotten, see
+ * StateManager::updateMesh.
+ */
+template <typename... T>
+bool adaptMesh(mfem::ParMesh& mesh, const mfem::Vector& errors, const AdaptivityOptions& options,
+               const std::vector<FiniteElementVector*>& fields, QuadratureData<T>&... qdata)
+{
+  SLIC_ERROR_ROOT_IF(!mesh.Nonconforming(), "adaptMesh() requires a nonconforming mesh");
+
+  auto all_fields = detail::fieldsToTransfer(mesh, fields);
+  auto old_ids    = detail::elementIds(mesh);
+  auto values     = detail::localValues(all_fields);
+
+  bool changed = mesh.RefineByError(errors, options.refine_threshold, -1, options.nc_limit);
+
+  if (!changed && options.derefine_threshold > 0.0) {
+    // mfem's derefinement takes the error vector by non-const reference
+    mfem::Vector derefinement_errors(errors);
+    changed = mesh.DerefineByError(derefinement_errors, options.derefine_threshold, options.nc_limit);
+  }
+
+  if (!changed) {
+    return false;
+  }
+
+  detail::updateFields(all_fields, values);
+  detail::updateQuadratureData(mesh, old_ids, qdata...);
+
+  if (options.rebalance) {
+    mfem::Vector costs(mesh.GetNE());
+    costs = 1.0;
+    detail::rebalance(mesh, costs, all_fields, qdata...);
+  }
+
+  detail::updateStateManager(mesh);
+  return true;
+}
+
+}  // namespace serac
@@ -0,0 +1,162 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/physics/parareal.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "axom/fmt.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+#include "serac/infrastructure/profiling.hpp"
+#include "serac/physics/state/finite_element_state.hpp"
+
+namespace serac {
+
+Parareal::Parareal(MPI_Comm comm, int num_slices) : num_slices_(num_slices)
+{
+  int rank      = 0;
+  int num_ranks = 0;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  SLIC_ERROR_ROOT_IF(num_slices_ < 1 || num_ranks % num_slices_ != 0,
+                     axom::fmt::format("Parareal requires the number of time slices ({}) to divide the number of "
+                                       "ranks ({})",
+                                       num_slices_, num_ranks));
+
+  // consecutive ranks share a time slice, so that the spatial problems keep their locality
+  int ranks_per_slice = num_ranks / num_slices_;
+  slice_              = rank / ranks_per_slice;
+
+  MPI_Comm_split(comm, slice_, rank, &slice_comm_);
+  MPI_Comm_split(comm, rank % ranks_per_slice, rank, &time_comm_);
+}
+
+Parareal::~Parareal()
+{
+  MPI_Comm_free(&slice_comm_);
+  MPI_Comm_free(&time_comm_);
+}
+
+int Parareal::solve(double t_start, double t_end, mfem::Vector& state, const Propagator& coarse,
+                    const Propagator& fine, const PararealOptions& options)
+{
+  SERAC_MARK_FUNCTION;
+
+  const int n = state.Size();
+
+  // the slice-to-slice exchanges assume every slice distributes the state the same way
+  int min_size = n;
+  int max_size = n;
+  MPI_Allreduce(MPI_IN_PLACE, &min_size, 1, MPI_INT, MPI_MIN, time_comm_);
+  MPI_Allreduce(MPI_IN_PLACE, &max_size, 1, MPI_INT, MPI_MAX, time_comm_);
+  SLIC_ERROR_ROOT_IF(min_size != max_size, "Parareal requires the same state distribution on every time slice");
+
+  auto slice_time = [&](int j) { return t_start + (t_end - t_start) * j / num_slices_; };
+  const double t0 = slice_time(slice_);
+  const double t1 = slice_time(slice_ + 1);
+
+  // the initial guess for the start of this slice comes from a (replicated) coarse sweep
+  mfem::Vector start(state);
+  for (int j = 0; j < slice_; j++) {
+    coarse(slice_time(j), slice_time(j + 1), start);
+  }
+
+  mfem::Vector coarse_end(start);  // G(U_j^k)
+  coarse(t0, t1, coarse_end);
+
+  mfem::Vector end(coarse_end);  // U_{j+1}^k
+  mfem::Vector fine_end(n);      // F(U_j^k)
+  mfem::Vector new_start(n);
+  mfem::Vector new_coarse_end(n);
+  mfem::Vector new_end(n);
+
+  changes_.clear();
+  converged_ = false;
+
+  int iteration = 0;
+  while (!converged_ && iteration < options.max_iterations) {
+    // the start of slice j is exact (and so unchanged) after j iterations
+    if (iteration <= slice_) {
+      fine_end = start;
+      fine(t0, t1, fine_end);
+    }
+
+    // the sequential correction: U_{j+1}^{k+1} = G(U_j^{k+1}) + F(U_j^k) - G(U_j^k)
+    if (slice_ > 0) {
+      MPI_Recv(new_start.GetData(), n, MPI_DOUBLE, slice_ - 1, iteration, time_comm_, MPI_STATUS_IGNORE);
+    } else {
+      new_start = start;
+    }
+
+    new_coarse_end = new_start;
+    coarse(t0, t1, new_coarse_end);
+
+    new_end = new_coarse_end;
+    new_end += fine_end;
+    new_end -= coarse_end;
+
+    if (slice_ + 1 < num_slices_) {
+      MPI_Send(new_end.GetData(), n, MPI_DOUBLE, slice_ + 1, iteration, time_comm_);
+    }
+
+    mfem::Vector difference(new_end);
+    difference -= end;
+    double difference_norm = std::sqrt(mfem::InnerProduct(slice_comm_, difference, difference));
+    double end_norm        = std::sqrt(mfem::InnerProduct(slice_comm_, new_end, new_end));
+    double change          = (end_norm > 0.0) ? difference_norm / end_norm : difference_norm;
+    MPI_Allreduce(MPI_IN_PLACE, &change, 1, MPI_DOUBLE, MPI_MAX, time_comm_);
+
+    start      = new_start;
+    coarse_end = new_coarse_end;
+    end        = new_end;
+
+    iteration++;
+    changes_.push_back(change);
+
+    if (options.print_level > 0) {
+      SLIC_INFO_ROOT(axom::fmt::format("Parareal iteration {:3} : max relative change = {:13}", iteration, change));
+    }
+
+    converged_ = change <= options.relative_tol || iteration >= num_slices_;
+  }
+
+  // every slice returns the final state, from the last slice
+  MPI_Bcast(end.GetData(), n, MPI_DOUBLE, num_slices_ - 1, time_comm_);
+  state = end;
+
+  if (!converged_) {
+    SLIC_WARNING_ROOT(axom::fmt::format("Parareal did not converge in {} iterations", iteration));
+  }
+
+  return iteration;
+}
+
+Parareal::Propagator physicsPropagator(BasePhysics& physics, const std::string& state_name, double max_dt)
+{
+  SLIC_ERROR_ROOT_IF(max_dt <= 0.0, "Propagator timesteps must be positive");
+
+  return [&physics, state_name, max_dt](double t_start, double t_end, mfem::Vector& state) {
+    int    num_steps = std::max(1, static_cast<int>(std::ceil((t_end - t_start) / max_dt - 1.0e-10)));
+    double dt        = (t_end - t_start) / num_steps;
+
+    physics.resetStates(0, t_start);
+
+    FiniteElementState initial_state(physics.state(state_name));
+    initial_state = state;
+    physics.setState(state_name, initial_state);
+
+    for (int i = 0; i < num_steps; i++) {
+      physics.advanceTimestep(dt);
+    }
+
+    state = physics.state(state_name);
+  };
+}
+
+}  // namespace serac
@@ -0,0 +1,145 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file parareal.hpp
+ *
+ * @brief A parallel-in-time (Parareal) driver for transient physics modules
+ *
+ * The ranks are split into groups, one per time slice. Each group solves the spatial problem of its own
+ * time slice on a sub-communicator, so the mesh and physics modules are created on that communicator:
+ *
+ * @code{.cpp}
+ * Parareal parareal(MPI_COMM_WORLD, num_slices);
+ *
+ * auto mesh = mesh::refineAndDistribute(buildMeshFromFile(filename), 0, 0, parareal.sliceComm());
+ * StateManager::setMesh(std::move(mesh), "mesh");
+ *
+ * HeatTransfer<p, dim> coarse(..., heat_transfer::default_timestepping_options, "coarse", "mesh");
+ * HeatTransfer<p, dim> fine(..., heat_transfer::default_timestepping_options, "fine", "mesh");
+ * // ... set materials, sources and boundary conditions of both, and call completeSetup() ...
+ *
+ * FiniteElementState temperature(coarse.temperature());  // the initial condition
+ * parareal.solve(0.0, t_final, temperature, physicsPropagator(coarse, "temperature", coarse_dt),
+ *                physicsPropagator(fine, "temperature", fine_dt));
+ * @endcode
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/physics/base_physics.hpp"
+
+namespace serac {
+
+/// @brief Options for the Parareal iterations
+struct PararealOptions {
+  /// The maximum number of Parareal iterations (the iteration is exact after as many iterations as time slices)
+  int max_iterations = 10;
+
+  /// The iteration stops once the largest relative change of any time slice's final state is below this tolerance
+  double relative_tol = 1.0e-8;
+
+  /// Print the change of each iteration (1), or nothing (0)
+  int print_level = 0;
+};
+
+/**
+ * @brief Parareal: a parallel-in-time iteration that combines a cheap sequential (coarse) propagator with an
+ * accurate (fine) propagator that runs concurrently on every time slice
+ *
+ * Denoting the state at the start of time slice j after k iterations by U_j^k, the iteration is
+ *
+ *   U_{j+1}^{k+1} = G(U_j^{k+1}) + F(U_j^k) - G(U_j^k)
+ *
+ * where G and F are the coarse and fine propagators over time slice j. After k iterations,
+ * the first k time slices agree exactly with the sequential fine solution.
+ */
+class Parareal {
+public:
+  /// @brief advances a state from t_start to t_end, in place
+  using Propagator = std::function<void(double t_start, double t_end, mfem::Vector& state)>;
+
+  /**
+   * @brief split a communicator into one group of ranks per time slice
+   *
+   * @param comm the communicator of every rank taking part in the simulation
+   * @param num_slices the number of time slices, which must divide the size of @a comm
+   */
+  Parareal(MPI_Comm comm, int num_slices);
+
+  /// @brief free the sub-communicators
+  ~Parareal();
+
+  Parareal(const Parareal&) = delete;
+  Parareal& operator=(const Parareal&) = delete;
+
+  /// @brief the communicator for the spatial problem of this rank's time slice
+  MPI_Comm sliceComm() const { return slice_comm_; }
+
+  /// @brief the time slice solved by this rank
+  int slice() const { return slice_; }
+
+  /// @brief the number of time slices
+  int numSlices() const { return num_slices_; }
+
+  /**
+   * @brief solve from @a t_start to @a t_end with the Parareal iteration
+   *
+   * @param t_start the initial time
+   * @param t_end the final time
+   * @param state (input: the initial condition, output: the final state) this rank's part of the state,
+   *        with the same distribution over sliceComm() on every time slice
+   * @param coarse the coarse (sequential) propagator
+   * @param fine the fine (concurrent) propagator
+   * @param options the tolerance and iteration limit
+   * @return the number of iterations performed
+   */
+  int solve(double t_start, double t_end, mfem::Vector& state, const Propagator& coarse, const Propagator& fine,
+            const PararealOptions& options = {});
+
+  /// @brief the largest relative change of any time slice's final state, for each iteration of the last solve
+  const std::vector<double>& changes() const { return changes_; }
+
+  /// @brief whether the last solve converged
+  bool converged() const { return converged_; }
+
+private:
+  /// @brief the number of time slices
+  int num_slices_;
+
+  /// @brief the time slice solved by this rank
+  int slice_;
+
+  /// @brief the ranks solving this rank's time slice
+  MPI_Comm slice_comm_;
+
+  /// @brief the ranks with the same rank in their slice communicator, ordered by time slice
+  MPI_Comm time_comm_;
+
+  /// @brief the largest relative change of any time slice's final state, for each iteration
+  std::vector<double> changes_;
+
+  /// @brief whether the last solve converged
+  bool converged_ = false;
+};
+
+/**
+ * @brief create a Parareal propagator that advances a physics module with equal timesteps
+ *
+ * @param physics the physics module, whose states are reset at the start of each propagation
+ * @param state_name the name of the propagated state (e.g. "temperature")
+ * @param max_dt the largest timestep to take, each propagation takes the fewest equal timesteps no larger than this
+ * @return the propagator, which refers to @a physics
+ */
+Parareal::Propagator physicsPropagator(BasePhysics& physics, const std::string& state_name, double max_dt);
+
+}  // namespace serac
@@ -0,0 +1,54 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/physics/reduced_order_snapshots.hpp"
+
+#include <algorithm>
+
+#include "axom/fmt.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+#include "serac/physics/state/finite_element_state.hpp"
+
+namespace serac {
+
+std::vector<mfem::Vector> collectSnapshots(BasePhysics& physics, const std::string& state_name,
+                                           const std::vector<double>& timesteps)
+{
+  auto names = physics.stateNames();
+  SLIC_ERROR_ROOT_IF(std::find(names.begin(), names.end(), state_name) == names.end(),
+                     axom::fmt::format("collectSnapshots: the physics module has no state named '{}'", state_name));
+
+  std::vector<mfem::Vector> snapshots;
+  snapshots.reserve(timesteps.size());
+  for (double dt : timesteps) {
+    physics.advanceTimestep(dt);
+    snapshots.emplace_back(physics.state(state_name));
+  }
+
+  return snapshots;
+}
+
+std::vector<mfem::Vector> collectSnapshots(BasePhysics& physics, const std::string& state_name,
+                                           std::size_t                            parameter_index,
+                                           const std::vector<FiniteElementState>& parameter_samples,
+                                           const std::vector<double>&             timesteps)
+{
+  std::vector<mfem::Vector> snapshots;
+  snapshots.reserve(parameter_samples.size() * timesteps.size());
+  for (auto& parameter : parameter_samples) {
+    physics.resetStates();
+    physics.setParameter(parameter_index, parameter);
+
+    for (auto& snapshot : collectSnapshots(physics, state_name, timesteps)) {
+      snapshots.push_back(std::move(snapshot));
+    }
+  }
+
+  return snapshots;
+}
+
+}  // namespace serac
@@ -0,0 +1,65 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file reduced_order_snapshots.hpp
+ *
+ * @brief Collect solution snapshots from physics modules, to train the reduced order models in
+ * reduced_order_model.hpp
+ *
+ * @code{.cpp}
+ * SolidMechanics<p, dim, Parameters<H1<1>>> solid(...);
+ * // ... set materials, loads and boundary conditions, and call completeSetup() ...
+ *
+ * std::vector<FiniteElementState> stiffnesses = ...;  // a design-space sample of the parameter field
+ * auto snapshots = collectSnapshots(solid, "displacement", 0, stiffnesses, {1.0});
+ * ReducedBasis basis = properOrthogonalDecomposition(snapshots, solid.mesh().GetComm());
+ * @endcode
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/physics/base_physics.hpp"
+
+namespace serac {
+
+/**
+ * @brief advance a physics module by each of the given timesteps, recording one of its states after each step
+ *
+ * @param physics the physics module, which starts from its current state
+ * @param state_name the name of the state to record (see BasePhysics::stateNames())
+ * @param timesteps the size of each timestep
+ * @return the T-vector of the state after each timestep
+ */
+std::vector<mfem::Vector> collectSnapshots(BasePhysics& physics, const std::string& state_name,
+                                           const std::vector<double>& timesteps);
+
+/**
+ * @brief solve a physics module for each sample of one of its parameters, recording one of its states after
+ * each timestep of each sample
+ *
+ * Each sample starts from the zero state at time 0 (see BasePhysics::resetStates()).
+ *
+ * @param physics the physics module
+ * @param state_name the name of the state to record (see BasePhysics::stateNames())
+ * @param parameter_index the index of the parameter that is varied
+ * @param parameter_samples the values of that parameter
+ * @param timesteps the size of each timestep, which are the same for every sample
+ * @return the T-vector of the state after each timestep, ordered by sample and then by timestep
+ *
+ * @note the physics module keeps the last sample's parameter
+ */
+std::vector<mfem::Vector> collectSnapshots(BasePhysics& physics, const std::string& state_name,
+                                           std::size_t                            parameter_index,
+                                           const std::vector<FiniteElementState>& parameter_samples,
+                                           const std::vector<double>&             timesteps);
+
+}  // namespace serac
@@ -257,11 +257,18 @@ public:
       amg_prec->SetSystemsOptions(displacement_.space().GetVDim(), serac::ordering == mfem::Ordering::byNODES);
     }
 
+    // If the user wants the geometric multigrid preconditioner, give it the levels of the mesh hierarchy
+    auto* multigrid_prec = dynamic_cast<GeometricMultigrid*>(&nonlin_solver_->preconditioner());
+    if (multigrid_prec) {
+      multigrid_prec->setHierarchy(StateManager::coarseMeshes(mesh_tag_), displacement_.space());
+    }
+
     int true_size = velocity_.space().TrueVSize();
 
     u_.SetSize(true_size);
     v_.SetSize(true_size);
     du_.SetSize(true_size);
+    warm_start_residual_.SetSize(true_size);
     predicted_displacement_.SetSize(true_size);
 
     shape_displacement_ = 0.0;
@@ -415,12 +422,15 @@ public:
    *
    * @tparam T the type to be created at each quadrature point
    * @param initial_state the value to be broadcast to each quadrature point
+   * @param storage (optional) use QuadratureDataStorage::Sparse when only a small part of the mesh
+   *        is expected to depart from `initial_state` (e.g. plasticity confined to a small region)
    * @return std::shared_ptr< QuadratureData<T> >
    */
   template <typename T>
-  qdata_type<T> createQuadratureDataBuffer(T initial_state)
+  qdata_type<T> createQuadratureDataBuffer(T                     initial_state,
+                                           QuadratureDataStorage storage = QuadratureDataStorage::Dense)
   {
-    return StateManager::newQuadratureDataBuffer(mesh_tag_, order, dim, initial_state);
+    return StateManager::newQuadratureDataBuffer(mesh_tag_, order, dim, initial_state, storage);
   }
 
   /**
@@ -838,7 +848,7 @@ public:
       auto du_dX   = get<DERIVATIVE>(displacement);
       auto d2u_dt2 = get<VALUE>(acceleration);
 
-      auto stress = material_(state, du_dX, params...);
+      auto stress = solid_mechanics::evaluate_stress(material_, state, du_dX, params...);
 
       auto dx_dX = 0.0 * du_dX + I;
 
@@ -997,6 +1007,43 @@ public:
     addBodyForce(DependsOn<>{}, body_force, optional_domain);
   }
 
+  /**
+   * @brief Set the material response and a body force over the entire domain, evaluated in a single element sweep
+   *
+   * This is equivalent to calling setMaterial() and then addBodyForce() with the same arguments, but the material
+   * and body force q-functions are fused (see fuse_with_state()), so the geometric factors, the trial field
+   * interpolation and the test function integration are done once instead of twice.
+   *
+   * @tparam MaterialType The solid material type
+   * @tparam BodyForceType The type of the body force load
+   * @tparam StateType the type that contains the internal variables for MaterialType
+   * @param material A material that provides a function to evaluate stress, see setMaterial()
+   * @param body_force A function describing the body force applied, see addBodyForce()
+   * @param qdata the buffer of material internal variables at each quadrature point
+   *
+   * @note Both q-functions receive the parameter fields specified in the `DependsOn<...>` argument
+   * @note This method must be called prior to completeSetup()
+   */
+  template <int... active_parameters, typename MaterialType, typename BodyForceType, typename StateType = Empty>
+  void setMaterialAndBodyForce(DependsOn<active_parameters...>, const MaterialType& material, BodyForceType body_force,
+                               qdata_type<StateType> qdata = EmptyQData)
+  {
+    static_assert(std::is_same_v<StateType, Empty> || std::is_same_v<StateType, typename MaterialType::State>,
+                  "invalid quadrature data provided in setMaterialAndBodyForce()");
+    residual_->AddDomainIntegral(Dimension<dim>{}, DependsOn<0, 1, active_parameters + NUM_STATE_VARS...>{},
+                                 fuse_with_state(MaterialStressFunctor<MaterialType>(material, geom_nonlin_),
+                                                 BodyForceIntegrand<BodyForceType>(body_force)),
+                                 mesh_, qdata);
+  }
+
+  /// @overload
+  template <typename MaterialType, typename BodyForceType, typename StateType = Empty>
+  void setMaterialAndBodyForce(const MaterialType& material, BodyForceType body_force,
+                               qdata_type<StateType> qdata = EmptyQData)
+  {
+    setMaterialAndBodyForce(DependsOn<>{}, material, body_force, qdata);
+  }
+
   /**
    * @brief Set the traction boundary condition
    *
@@ -1111,6 +1158,18 @@ public:
   /// @brief Build the quasi-static operator corresponding to the total Lagrangian formulation
   virtual std::unique_ptr<mfem_ext::StdFunctionOperator> buildQuasistaticOperator()
   {
+    // residual and its gradient from a single (differentiated) evaluation
+    auto residual_and_gradient = [this](const mfem::Vector& u, mfem::Vector& r) -> mfem::Operator& {
+      SERAC_MARK_FUNCTION;
+      auto [res, drdu] = (*residual_)(time_, shape_displacement_, differentiate_wrt(u), acceleration_,
+                                      *parameters_[parameter_indices].state...);
+      r = res;
+      r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+      J_   = assemble(drdu);
+      J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+      return *J_;
+    };
+
     // the quasistatic case is entirely described by the residual,
     // there is no ordinary differential equation
     return std::make_unique<mfem_ext::StdFunctionOperator>(
@@ -1119,7 +1178,7 @@ public:
         // residual function
         [this](const mfem::Vector& u, mfem::Vector& r) {
           SERAC_MARK_FUNCTION;
-          const mfem::Vector res =
+          const mfem::Vector& res =
               (*residual_)(time_, shape_displacement_, u, acceleration_, *parameters_[parameter_indices].state...);
 
           // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
@@ -1129,15 +1188,12 @@ public:
           r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
         },
 
-        // gradient of residual function
-        [this](const mfem::Vector& u) -> mfem::Operator& {
-          SERAC_MARK_FUNCTION;
-          auto [r, drdu] = (*residual_)(time_, shape_displacement_, differentiate_wrt(u), acceleration_,
-                                        *parameters_[parameter_indices].state...);
-          J_             = assemble(drdu);
-          J_e_           = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
-          return *J_;
-        });
+        // gradient of residual function (the differentiated evaluation computes the residual anyway)
+        [residual_and_gradient, r = mfem::Vector()](const mfem::Vector& u) mutable -> mfem::Operator& {
+          return residual_and_gradient(u, r);
+        },
+
+        residual_and_gradient);
   }
 
   /**
@@ -1170,13 +1226,28 @@ public:
       // the dynamic case is described by a residual function and a second order
       // ordinary differential equation. Here, we define the residual function in
       // terms of an acceleration.
+
+      // the residual and its jacobian J = M + c0 * K = dR/da + c0 * dR/du from a single (differentiated) evaluation
+      auto residual_and_jacobian = [this](const mfem::Vector& d2u_dt2, mfem::Vector& r) -> mfem::Operator& {
+        add(1.0, u_, c0_, d2u_dt2, predicted_displacement_);
+
+        auto [res, J] = (*residual_)(time_, shape_displacement_, differentiate_along(predicted_displacement_, c0_),
+                                     differentiate_along(d2u_dt2, 1.0), *parameters_[parameter_indices].state...);
+        r = res;
+        r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
+        J_   = assemble(J);
+        J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+
+        return *J_;
+      };
+
       residual_with_bcs_ = std::make_unique<mfem_ext::StdFunctionOperator>(
           displacement_.space().TrueVSize(),
 
           [this](const mfem::Vector& d2u_dt2, mfem::Vector& r) {
             add(1.0, u_, c0_, d2u_dt2, predicted_displacement_);
-            const mfem::Vector res = (*residual_)(time_, shape_displacement_, predicted_displacement_, d2u_dt2,
-                                                  *parameters_[parameter_indices].state...);
+            const mfem::Vector& res = (*residual_)(time_, shape_displacement_, predicted_displacement_, d2u_dt2,
+                                                   *parameters_[parameter_indices].state...);
 
             // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
             // tracking strategy
@@ -1185,27 +1256,12 @@ public:
             r.SetSubVector(bcs_.allEssentialTrueDofs(), 0.0);
           },
 
-          [this](const mfem::Vector& d2u_dt2) -> mfem::Operator& {
-            add(1.0, u_, c0_, d2u_dt2, predicted_displacement_);
-
-            // K := dR/du
-            auto                                  K = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_,
-                                                         differentiate_wrt(predicted_displacement_), d2u_dt2,
-                                                         *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-            // M := dR/da
-            auto M = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, predicted_displacement_,
-                                                         differentiate_wrt(d2u_dt2),
-                                                         *parameters_[parameter_indices].state...));
-            std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
-
-            // J = M + c0 * K
-            J_.reset(mfem::Add(1.0, *m_mat, c0_, *k_mat));
-            J_e_ = bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+          // the jacobian alone (the differentiated evaluation computes the residual anyway)
+          [residual_and_jacobian, r = mfem::Vector()](const mfem::Vector& d2u_dt2) mutable -> mfem::Operator& {
+            return residual_and_jacobian(d2u_dt2, r);
+          },
 
-            return *J_;
-          });
+          residual_and_jacobian);
     }
 
 #ifdef SERAC_USE_PETSC
@@ -1382,15 +1438,10 @@ public:
       velocity_     = end_step_solution.at("velocity");
       acceleration_ = end_step_solution.at("acceleration");
 
-      // K := dR/du
-      auto K = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, differentiate_wrt(displacement_),
-                                                   acceleration_, *parameters_[parameter_indices].state...));
+      // K := dR/du and M := dR/da, from a single evaluation of the residual
+      auto [_, K, M] = (*residual_)(time_, shape_displacement_, differentiate_wrt(displacement_),
+                                    differentiate_wrt(acceleration_), *parameters_[parameter_indices].state...);
       std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-      // M := dR/da
-      auto M = serac::get<DERIVATIVE>((*residual_)(time_, shape_displacement_, displacement_,
-                                                   differentiate_wrt(acceleration_),
-                                                   *parameters_[parameter_indices].state...));
       std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
 
       solid_mechanics::detail::adjoint_integrate(
@@ -1577,6 +1628,9 @@ protected:
   /// vector used to store the change in essential bcs between timesteps
   mfem::Vector du_;
 
+  /// vector used to store the linearized residual when warm-starting a timestep
+  mfem::Vector warm_start_residual_;
+
   /// @brief used to communicate the ODE solver's predicted displacement to the residual operator
   mfem::Vector u_;
 
@@ -1742,8 +1796,10 @@ protected:
 
     if (use_warm_start_) {
       // Update the linearized Jacobian matrix
-      auto r = (*residual_)(time_ + dt, shape_displacement_, displacement_, acceleration_,
-                            *parameters_[parameter_indices].state...);
+      // (copied into preallocated storage, since the Functional's output is overwritten below)
+      warm_start_residual_ = (*residual_)(time_ + dt, shape_displacement_, displacement_, acceleration_,
+                                          *parameters_[parameter_indices].state...);
+      auto& r              = warm_start_residual_;
 
       // use the most recently evaluated Jacobian
       auto [_, drdu] = (*residual_)(time_, shape_displacement_, differentiate_wrt(displacement_), acceleration_,
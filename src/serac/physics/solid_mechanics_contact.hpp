@@ -111,8 +111,8 @@ public:
   {
     auto residual_fn = [this](const mfem::Vector& u, mfem::Vector& r) {
       const mfem::Vector u_blk(const_cast<mfem::Vector&>(u), 0, displacement_.Size());
-      const mfem::Vector res = (*residual_)(ode_time_point_, shape_displacement_, u_blk, acceleration_,
-                                            *parameters_[parameter_indices].state...);
+      const mfem::Vector& res = (*residual_)(ode_time_point_, shape_displacement_, u_blk, acceleration_,
+                                             *parameters_[parameter_indices].state...);
 
       // TODO this copy is required as the sundials solvers do not allow move assignments because of their memory
       // tracking strategy
@@ -213,6 +213,15 @@ public:
    */
   mfem::ParGridFunction& gridFunction() const;
 
+  /// @overload
+  void update(mfem::ParGridFunction& values) override
+  {
+    FiniteElementVector::update(values);
+
+    // the cached grid function was sized for the old space
+    grid_func_.reset();
+  }
+
 protected:
   /**
    * @brief An optional container for a grid function (L-vector) view of the finite element state.
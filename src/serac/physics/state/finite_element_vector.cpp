@@ -105,6 +105,23 @@ FiniteElementVector& FiniteElementVector::operator=(const double value)
   return *this;
 }
 
+void FiniteElementVector::update(mfem::ParGridFunction& values)
+{
+  SLIC_ERROR_IF(values.ParFESpace() != space_.get(), "values must be a grid function on this vector's space");
+
+  // mfem interpolates (or redistributes) the local values,
+  // since the true dofs of the old and new spaces aren't related directly
+  space_->Update();
+  values.Update();
+
+  // Resize the underlying hypre vector to match the updated space
+  HypreParVector new_vector(space_.get());
+  auto*          parallel_vec = new_vector.StealParVector();
+  WrapHypreParVector(parallel_vec);
+
+  values.GetTrueDofs(*this);
+}
+
 double avg(const FiniteElementVector& fe_vector)
 {
   double global_sum;
@@ -166,6 +166,16 @@ public:
    */
   FiniteElementVector& operator=(const double value);
 
+  /**
+   * @brief Update the finite element space after its mesh has been refined, derefined or rebalanced,
+   * and transfer the values from before that change onto the updated space
+   *
+   * @param values the local (L-vector) values of this field from before the mesh changed,
+   * as a grid function on this field's space
+   * @note this must be called after every change to the mesh, since mfem can not compose several updates
+   */
+  virtual void update(mfem::ParGridFunction& values);
+
   /**
    * @brief Destroy the Finite Element Vector object
    */
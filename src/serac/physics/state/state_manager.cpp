@@ -12,13 +12,14 @@
 namespace serac {
 
 // Initialize StateManager's static members - these will be fully initialized in StateManager::initialize
-std::unordered_map<std::string, axom::sidre::MFEMSidreDataCollection> StateManager::datacolls_;
-std::unordered_map<std::string, std::unique_ptr<FiniteElementState>>  StateManager::shape_displacements_;
-bool                                                                  StateManager::is_restart_ = false;
-axom::sidre::DataStore*                                               StateManager::ds_         = nullptr;
-std::string                                                           StateManager::output_dir_ = "";
-std::unordered_map<std::string, mfem::ParGridFunction*>               StateManager::named_states_;
-std::unordered_map<std::string, mfem::ParGridFunction*>               StateManager::named_duals_;
+std::unordered_map<std::string, axom::sidre::MFEMSidreDataCollection>        StateManager::datacolls_;
+std::unordered_map<std::string, std::unique_ptr<FiniteElementState>>         StateManager::shape_displacements_;
+std::unordered_map<std::string, std::vector<std::unique_ptr<mfem::ParMesh>>> StateManager::coarse_meshes_;
+bool                                                                         StateManager::is_restart_ = false;
+axom::sidre::DataStore*                                                      StateManager::ds_         = nullptr;
+std::string                                                                  StateManager::output_dir_ = "";
+std::unordered_map<std::string, mfem::ParGridFunction*>                      StateManager::named_states_;
+std::unordered_map<std::string, mfem::ParGridFunction*>                      StateManager::named_duals_;
 
 double StateManager::newDataCollection(const std::string& name, const std::optional<int> cycle_to_load)
 {
@@ -266,9 +267,32 @@ mfem::ParMesh& StateManager::setMesh(std::unique_ptr<mfem::ParMesh> pmesh, const
   // for the non-restart case
   constructShapeFields(mesh_tag);
 
+  coarse_meshes_.erase(mesh_tag);
+
+  return new_pmesh;
+}
+
+mfem::ParMesh& StateManager::setMeshHierarchy(std::vector<std::unique_ptr<mfem::ParMesh>> levels,
+                                              const std::string&                          mesh_tag)
+{
+  SLIC_ERROR_ROOT_IF(levels.empty(), "A mesh hierarchy must contain at least one mesh");
+
+  auto finest = std::move(levels.back());
+  levels.pop_back();
+
+  auto& new_pmesh          = setMesh(std::move(finest), mesh_tag);
+  coarse_meshes_[mesh_tag] = std::move(levels);
   return new_pmesh;
 }
 
+const std::vector<std::unique_ptr<mfem::ParMesh>>& StateManager::coarseMeshes(const std::string& mesh_tag)
+{
+  static const std::vector<std::unique_ptr<mfem::ParMesh>> no_coarse_meshes;
+
+  auto it = coarse_meshes_.find(mesh_tag);
+  return (it != coarse_meshes_.end()) ? it->second : no_coarse_meshes;
+}
+
 void StateManager::constructShapeFields(const std::string& mesh_tag)
 {
   // Construct the shape displacement field associated with this mesh
@@ -298,6 +322,41 @@ mfem::ParMesh& StateManager::mesh(const std::string& mesh_tag)
   return static_cast<mfem::ParMesh&>(*mesh);
 }
 
+bool StateManager::ownsMesh(const mfem::ParMesh* pmesh)
+{
+  for (auto& [name, datacoll] : datacolls_) {
+    if (datacoll.GetMesh() == pmesh) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void StateManager::updateMesh(const std::string& mesh_tag)
+{
+  SLIC_ERROR_ROOT_IF(!hasMesh(mesh_tag), axom::fmt::format("Mesh tag \"{}\" not found in the data store", mesh_tag));
+  auto&       datacoll = datacolls_.at(mesh_tag);
+  const auto* pmesh    = &mesh(mesh_tag);
+
+  // the grid functions registered for the mesh's fields still have the sizes of the old spaces
+  for (auto* named_fields : {&named_states_, &named_duals_}) {
+    for (auto it = named_fields->begin(); it != named_fields->end();) {
+      if (it->second->ParFESpace()->GetParMesh() == pmesh) {
+        datacoll.DeregisterField(it->first);
+        it = named_fields->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  auto&                  shape         = *shape_displacements_.at(mesh_tag);
+  mfem::ParGridFunction* grid_function = new mfem::ParGridFunction(&shape.space(), static_cast<double*>(nullptr));
+  datacoll.RegisterField(shape.name(), grid_function);
+  shape.fillGridFunction(*grid_function);
+  named_states_[shape.name()] = grid_function;
+}
+
 std::string StateManager::collectionID(const mfem::ParMesh* pmesh)
 {
   for (auto& [name, datacoll] : datacolls_) {
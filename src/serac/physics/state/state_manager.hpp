@@ -103,11 +103,14 @@ public:
    * @param order The order of the discretization of the displacement and velocity fields
    * @param dim The spatial dimension of the mesh
    * @param initial_state the value to be broadcast to each quadrature point
+   * @param storage whether to allocate storage for every quadrature point up front (Dense), or only
+   *        for elements where the data departs from `initial_state` (Sparse)
    * @return shared pointer to quadrature data buffer
    */
   template <typename T>
-  static std::shared_ptr<QuadratureData<T>> newQuadratureDataBuffer(const std::string& mesh_tag, int order, int dim,
-                                                                    T initial_state)
+  static std::shared_ptr<QuadratureData<T>> newQuadratureDataBuffer(
+      const std::string& mesh_tag, int order, int dim, T initial_state,
+      QuadratureDataStorage storage = QuadratureDataStorage::Dense)
   {
     SLIC_ERROR_ROOT_IF(!hasMesh(mesh_tag), axom::fmt::format("Mesh tag '{}' not found in the data store", mesh_tag));
 
@@ -127,7 +130,7 @@ public:
       qpts_per_elem[size_t(geom)] = uint32_t(num_quadrature_points(geom, Q));
     }
 
-    return std::make_shared<QuadratureData<T>>(elems, qpts_per_elem, initial_state);
+    return std::make_shared<QuadratureData<T>>(elems, qpts_per_elem, initial_state, storage);
   }
 
   /**
@@ -244,6 +247,7 @@ public:
     named_states_.clear();
     named_duals_.clear();
     shape_displacements_.clear();
+    coarse_meshes_.clear();
     datacolls_.clear();
     output_dir_.clear();
     is_restart_ = false;
@@ -257,6 +261,24 @@ public:
    */
   static bool hasMesh(const std::string& mesh_tag) { return datacolls_.find(mesh_tag) != datacolls_.end(); }
 
+  /**
+   * @brief Checks if a mesh is held by StateManager
+   * @param[in] pmesh Pointer to a mesh (non-owning)
+   * @return True if @a pmesh was returned by setMesh() or mesh()
+   */
+  static bool ownsMesh(const mfem::ParMesh* pmesh);
+
+  /**
+   * @brief Updates the fields held for a mesh after it was changed in place, e.g. refined or rebalanced by adaptMesh()
+   *
+   * The shape displacement field, whose values must already have been transferred onto the changed mesh, is
+   * registered again with its new size. The other states and duals defined on the mesh are forgotten, since the
+   * physics modules that own them must be rebuilt on the changed mesh (which registers them again).
+   *
+   * @param[in] mesh_tag A string that uniquely identifies the mesh
+   */
+  static void updateMesh(const std::string& mesh_tag);
+
   /**
    * @brief Gives ownership of mesh to StateManager
    * @param[in] pmesh The mesh to register
@@ -265,6 +287,22 @@ public:
    */
   static mfem::ParMesh& setMesh(std::unique_ptr<mfem::ParMesh> pmesh, const std::string& mesh_tag);
 
+  /**
+   * @brief Gives ownership of a uniform refinement hierarchy of meshes to StateManager
+   * @param[in] levels The meshes, ordered from coarsest to finest (see mesh::refineAndDistributeHierarchy)
+   * @param[in] mesh_tag A string that uniquely identifies the (finest) mesh
+   * @return A reference to the finest mesh, which is registered as if by setMesh()
+   */
+  static mfem::ParMesh& setMeshHierarchy(std::vector<std::unique_ptr<mfem::ParMesh>> levels,
+                                         const std::string&                          mesh_tag);
+
+  /**
+   * @brief Returns the coarse levels of a mesh registered with setMeshHierarchy()
+   * @param[in] mesh_tag A string that uniquely identifies the mesh
+   * @return The coarse meshes, ordered from coarsest to finest, or an empty list if the mesh has no hierarchy
+   */
+  static const std::vector<std::unique_ptr<mfem::ParMesh>>& coarseMeshes(const std::string& mesh_tag);
+
   /**
    * @brief Returns a non-owning reference to mesh held by StateManager
    * @param[in] mesh_tag A string that uniquely identifies the mesh
@@ -360,6 +398,9 @@ private:
   /// @brief A map of the shape displacement fields for each stored mesh ID
   static std::unordered_map<std::string, std::unique_ptr<FiniteElementState>> shape_displacements_;
 
+  /// @brief The coarse levels of each stored mesh ID registered with setMeshHierarchy()
+  static std::unordered_map<std::string, std::vector<std::unique_ptr<mfem::ParMesh>>> coarse_meshes_;
+
   /**
    * @brief Whether this simulation has been restarted from another simulation
    */
@@ -23,7 +23,7 @@
 
 namespace serac {
 
-class ContactTest : public testing::TestWithParam<std::pair<ContactEnforcement, std::string>> {};
+class ContactTest : public testing::TestWithParam<std::tuple<ContactMethod, ContactEnforcement, std::string>> {};
 
 TEST_P(ContactTest, patch)
 {
@@ -34,7 +34,7 @@ TEST_P(ContactTest, patch)
   MPI_Barrier(MPI_COMM_WORLD);
 
   // Create DataStore
-  std::string            name = "contact_patch_" + GetParam().second;
+  std::string            name = "contact_patch_" + std::get<2>(GetParam());
   axom::sidre::DataStore datastore;
   StateManager::initialize(datastore, name + "_data");
 
@@ -67,8 +67,8 @@ TEST_P(ContactTest, patch)
                                            .max_iterations = 20,
                                            .print_level    = 1};
 
-  ContactOptions contact_options{.method      = ContactMethod::SingleMortar,
-                                 .enforcement = GetParam().first,
+  ContactOptions contact_options{.method      = std::get<0>(GetParam()),
+                                 .enforcement = std::get<1>(GetParam()),
                                  .type        = ContactType::Frictionless,
                                  .penalty     = 1.0e4};
 
@@ -124,9 +124,12 @@ TEST_P(ContactTest, patch)
 }
 
 INSTANTIATE_TEST_SUITE_P(tribol, ContactTest,
-                         testing::Values(std::make_pair(ContactEnforcement::Penalty, "penalty"),
-                                         std::make_pair(ContactEnforcement::LagrangeMultiplier,
-                                                        "lagrange_multiplier")));
+                         testing::Values(std::make_tuple(ContactMethod::SingleMortar, ContactEnforcement::Penalty,
+                                                         "penalty"),
+                                         std::make_tuple(ContactMethod::SingleMortar,
+                                                         ContactEnforcement::LagrangeMultiplier, "lagrange_multiplier"),
+                                         std::make_tuple(ContactMethod::NodeToSurface, ContactEnforcement::Penalty,
+                                                         "node_to_surface_penalty")));
 
 }  // namespace serac
 
@@ -0,0 +1,280 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/physics/heat_transfer.hpp"
+#include "serac/physics/mesh_adaptivity.hpp"
+#include "serac/physics/state/state_manager.hpp"
+
+namespace serac {
+
+TEST(MeshAdaptivity, RefinementTransfersFieldsAndQuadratureData)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  auto mesh = buildRectangleMesh(4, 4, 1.0, 1.0);
+  mesh.EnsureNCMesh();
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  constexpr int p = 2;
+
+  // a quadratic field is represented exactly on both the original and refined meshes
+  FiniteElementState        u(pmesh, H1<p, 1>{});
+  mfem::FunctionCoefficient func([](const mfem::Vector& x, double) -> double { return x[0] * x[0] + x[1]; });
+  u.project(func);
+
+  auto center = [&](int e) {
+    mfem::Vector x(2);
+    pmesh.GetElementCenter(e, x);
+    return x;
+  };
+
+  // store a different value in the elements on the left and right halves of the mesh
+  int                                  num_elements = pmesh.GetNE();
+  QuadratureData<double>::geom_array_t elements{};
+  QuadratureData<double>::geom_array_t qpts_per_element{};
+  elements[mfem::Geometry::SQUARE]         = uint32_t(num_elements);
+  qpts_per_element[mfem::Geometry::SQUARE] = 4;
+  QuadratureData<double> qdata(elements, qpts_per_element);
+
+  mfem::Vector errors(num_elements);
+  for (int e = 0; e < num_elements; e++) {
+    bool left = center(e)[0] < 0.5;
+    errors[e] = left ? 1.0 : 0.0;
+    for (int q = 0; q < 4; q++) {
+      qdata[mfem::Geometry::SQUARE](e, q) = left ? 1.0 : 2.0;
+    }
+  }
+
+  // refine only the elements on the left half
+  AdaptivityOptions options;
+  options.refine_threshold = 0.5;
+  EXPECT_TRUE(adaptMesh(pmesh, errors, options, {&u}, qdata));
+
+  // the adapted mesh is rebalanced, so compare the global number of elements
+  int num_refined = 0;
+  for (int e = 0; e < num_elements; e++) {
+    num_refined += (errors[e] > 0.5);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &num_refined, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(MPI_IN_PLACE, &num_elements, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  EXPECT_EQ(pmesh.GetGlobalNE(), num_elements + 3 * num_refined);
+  EXPECT_EQ(u.Size(), u.space().GetTrueVSize());
+  EXPECT_LT(computeL2Error(u, func), 1.0e-12);
+
+  // each child element inherits the quadrature data of its parent
+  for (int e = 0; e < pmesh.GetNE(); e++) {
+    double expected = (center(e)[0] < 0.5) ? 1.0 : 2.0;
+    for (int q = 0; q < 4; q++) {
+      EXPECT_EQ(qdata[mfem::Geometry::SQUARE](e, q), expected);
+    }
+  }
+
+  // nothing exceeds the threshold now, so the mesh is left unchanged
+  mfem::Vector small_errors(pmesh.GetNE());
+  small_errors = 0.0;
+  EXPECT_FALSE(adaptMesh(pmesh, small_errors, options, {&u}, qdata));
+}
+
+TEST(MeshAdaptivity, DerefinementTransfersFieldsAndQuadratureData)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  auto mesh = buildRectangleMesh(4, 4, 1.0, 1.0);
+  mesh.EnsureNCMesh();
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  // a linear field is represented exactly on both the refined and derefined meshes
+  FiniteElementState        u(pmesh, H1<1, 1>{});
+  mfem::FunctionCoefficient func([](const mfem::Vector& x, double) -> double { return 2.0 * x[0] - x[1]; });
+  u.project(func);
+
+  // the original element containing a point, which is shared by its children after refinement
+  auto parent_of = [&](int e) {
+    mfem::Vector x(2);
+    pmesh.GetElementCenter(e, x);
+    return double(int(4.0 * x[0]) + 4 * int(4.0 * x[1]));
+  };
+
+  QuadratureData<double>::geom_array_t elements{};
+  QuadratureData<double>::geom_array_t qpts_per_element{};
+  elements[mfem::Geometry::SQUARE]         = uint32_t(pmesh.GetNE());
+  qpts_per_element[mfem::Geometry::SQUARE] = 4;
+  QuadratureData<double> qdata(elements, qpts_per_element);
+
+  // refine every element (keeping the children of each element on the same rank as their parent)
+  AdaptivityOptions options;
+  options.refine_threshold   = 0.5;
+  options.derefine_threshold = 0.5;
+  options.rebalance          = false;
+
+  mfem::Vector errors(pmesh.GetNE());
+  errors = 1.0;
+  EXPECT_TRUE(adaptMesh(pmesh, errors, options, {&u}, qdata));
+  EXPECT_EQ(pmesh.GetGlobalNE(), 64);
+
+  // give the children of each original element the same data, different from that of the other elements
+  for (int e = 0; e < pmesh.GetNE(); e++) {
+    for (int q = 0; q < 4; q++) {
+      qdata[mfem::Geometry::SQUARE](e, q) = parent_of(e);
+    }
+  }
+
+  // no element needs refinement, and every group of siblings is below the derefinement threshold
+  mfem::Vector small_errors(pmesh.GetNE());
+  small_errors = 0.0;
+  EXPECT_TRUE(adaptMesh(pmesh, small_errors, options, {&u}, qdata));
+  EXPECT_EQ(pmesh.GetGlobalNE(), 16);
+  EXPECT_EQ(u.Size(), u.space().GetTrueVSize());
+  EXPECT_LT(computeL2Error(u, func), 1.0e-12);
+
+  // each merged element inherits the data of one of its children
+  for (int e = 0; e < pmesh.GetNE(); e++) {
+    for (int q = 0; q < 4; q++) {
+      EXPECT_EQ(qdata[mfem::Geometry::SQUARE](e, q), parent_of(e));
+    }
+  }
+}
+
+TEST(MeshAdaptivity, AdaptingAStateManagerMeshUpdatesItsFields)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  StateManager::initialize(datastore, "mesh_adaptivity");
+
+  auto mesh = buildRectangleMesh(4, 4, 1.0, 1.0);
+  mesh.EnsureNCMesh();
+
+  std::string mesh_tag{"mesh"};
+  auto&       pmesh = StateManager::setMesh(std::make_unique<mfem::ParMesh>(MPI_COMM_WORLD, mesh), mesh_tag);
+
+  // a linear shape displacement is represented exactly on the refined mesh
+  mfem::VectorFunctionCoefficient shape_func(2, [](const mfem::Vector& x, mfem::Vector& displacement) {
+    displacement[0] = 0.1 * x[1];
+    displacement[1] = 0.05 * x[0];
+  });
+  StateManager::shapeDisplacement(mesh_tag).project(shape_func);
+
+  auto make_thermal = [&]() {
+    return std::make_unique<HeatTransfer<1, 2>>(heat_transfer::default_nonlinear_options,
+                                                heat_transfer::default_linear_options,
+                                                heat_transfer::default_static_options, "thermal", mesh_tag);
+  };
+  auto thermal = make_thermal();
+
+  AdaptivityOptions options;
+  options.refine_threshold = 0.5;
+
+  mfem::Vector errors(pmesh.GetNE());
+  errors = 1.0;
+  EXPECT_TRUE(adaptMesh(pmesh, errors, options, {}));
+
+  // the shape displacement is transferred, and registered again with its new size
+  auto& shape = StateManager::shapeDisplacement(mesh_tag);
+  EXPECT_EQ(shape.Size(), shape.space().GetTrueVSize());
+  EXPECT_LT(computeL2Error(shape, shape_func), 1.0e-12);
+
+  // the physics module is rebuilt on the refined mesh, registering its fields again under the same names
+  thermal.reset();
+  thermal = make_thermal();
+  EXPECT_EQ(thermal->shapeDisplacement().Size(), 2 * thermal->temperature().Size());
+
+  thermal.reset();
+  StateManager::reset();
+}
+
+TEST(MeshAdaptivity, RebalancingPreservesFieldsAndQuadratureData)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  auto mesh = buildRectangleMesh(4, 4, 1.0, 1.0);
+  mesh.EnsureNCMesh();
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  FiniteElementState        u(pmesh, H1<1, 1>{});
+  mfem::FunctionCoefficient func([](const mfem::Vector& x, double) -> double { return 2.0 * x[0] - x[1]; });
+  u.project(func);
+
+  // pretend the quadrature points near x == 0 are yielding
+  QuadratureData<double>::geom_array_t elements{};
+  QuadratureData<double>::geom_array_t qpts_per_element{};
+  elements[mfem::Geometry::SQUARE]         = uint32_t(pmesh.GetNE());
+  qpts_per_element[mfem::Geometry::SQUARE] = 4;
+  QuadratureData<double> plastic_strain(elements, qpts_per_element);
+
+  for (int e = 0; e < pmesh.GetNE(); e++) {
+    mfem::Vector x(2);
+    pmesh.GetElementCenter(e, x);
+    for (int q = 0; q < 4; q++) {
+      plastic_strain[mfem::Geometry::SQUARE](e, q) = (x[0] < 0.25) ? x[1] : 0.0;
+    }
+  }
+
+  mfem::Vector costs = elementCosts(pmesh, plastic_strain, [](double eqps) { return (eqps > 0.0) ? 4.0 : 1.0; });
+
+  // elements on the left edge cost 4 per quadrature point, and the others cost 1 per quadrature point
+  for (int e = 0; e < pmesh.GetNE(); e++) {
+    mfem::Vector x(2);
+    pmesh.GetElementCenter(e, x);
+    EXPECT_EQ(costs[e], (x[0] < 0.25) ? 16.0 : 4.0);
+  }
+
+  // the bottom boundary has 4 boundary elements, each adjacent to one element
+  Domain bottom = Domain::ofBoundaryElements(
+      pmesh, [](std::vector<vec2> x, int /* attr */) { return x[0][1] + x[1][1] < 1.0e-8; });
+  auto global_sum = [](const mfem::Vector& values) {
+    double sum = values.Sum();
+    MPI_Allreduce(MPI_IN_PLACE, &sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    return sum;
+  };
+  double before = global_sum(costs);
+  addBoundaryCost(costs, bottom, 10.0);
+  EXPECT_DOUBLE_EQ(global_sum(costs), before + 40.0);
+
+  rebalanceMesh(pmesh, costs, {&u}, plastic_strain);
+
+  // the migrated quadrature data gives the same total cost, split between the ranks to within one element's cost
+  Domain new_bottom = Domain::ofBoundaryElements(
+      pmesh, [](std::vector<vec2> x, int /* attr */) { return x[0][1] + x[1][1] < 1.0e-8; });
+
+  mfem::Vector new_costs = elementCosts(pmesh, plastic_strain, [](double eqps) { return (eqps > 0.0) ? 4.0 : 1.0; });
+  addBoundaryCost(new_costs, new_bottom, 10.0);
+  EXPECT_DOUBLE_EQ(global_sum(new_costs), before + 40.0);
+
+  double rank_cost[2] = {new_costs.Sum(), -new_costs.Sum()};
+  MPI_Allreduce(MPI_IN_PLACE, rank_cost, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  EXPECT_LE(rank_cost[0] + rank_cost[1], 16.0 + 10.0);
+
+  EXPECT_LT(computeL2Error(u, func), 1.0e-12);
+  for (int e = 0; e < pmesh.GetNE(); e++) {
+    mfem::Vector x(2);
+    pmesh.GetElementCenter(e, x);
+    for (int q = 0; q < 4; q++) {
+      EXPECT_EQ(plastic_strain[mfem::Geometry::SQUARE](e, q), (x[0] < 0.25) ? x[1] : 0.0);
+    }
+  }
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
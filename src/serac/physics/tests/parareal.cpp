@@ -0,0 +1,108 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/physics/parareal.hpp"
+
+#include <string>
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/physics/heat_transfer.hpp"
+#include "serac/physics/materials/thermal_material.hpp"
+#include "serac/physics/state/state_manager.hpp"
+
+namespace serac {
+
+constexpr int dim = 2;
+constexpr int p   = 1;
+
+std::unique_ptr<HeatTransfer<p, dim>> createHeatTransfer(const std::string& name, const std::string& mesh_tag)
+{
+  const NonlinearSolverOptions nonlinear_options = {.nonlin_solver  = NonlinearSolver::Newton,
+                                                    .relative_tol   = 1.0e-12,
+                                                    .absolute_tol   = 1.0e-14,
+                                                    .max_iterations = 20,
+                                                    .print_level    = 0};
+
+  auto thermal = std::make_unique<HeatTransfer<p, dim>>(nonlinear_options, heat_transfer::direct_linear_options,
+                                                        heat_transfer::default_timestepping_options, name, mesh_tag);
+
+  // a mildly nonlinear conductivity
+  thermal->setMaterial(heat_transfer::IsotropicConductorWithLinearConductivityVsTemperature(1.0, 1.0, 1.0, 0.1));
+  thermal->setTemperature([](const mfem::Vector&, double) { return 0.0; });
+  thermal->setTemperatureBCs({1}, [](const mfem::Vector&, double) { return 0.0; });
+  thermal->setSource([](auto /* X */, auto time, auto /* u */, auto /* du_dx */) { return 1.0 + time; });
+  thermal->completeSetup();
+  return thermal;
+}
+
+TEST(Parareal, MatchesSequentialSolution)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  int num_ranks = 0;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  // one rank per time slice
+  Parareal parareal(MPI_COMM_WORLD, num_ranks);
+  EXPECT_EQ(parareal.numSlices(), num_ranks);
+
+  axom::sidre::DataStore datastore;
+  StateManager::initialize(datastore, "parareal_heat_transfer");
+
+  std::string mesh_tag = "mesh";
+  StateManager::setMesh(mesh::refineAndDistribute(buildRectangleMesh(8, 8), 0, 0, parareal.sliceComm()), mesh_tag);
+
+  auto coarse = createHeatTransfer("coarse", mesh_tag);
+  auto fine   = createHeatTransfer("fine", mesh_tag);
+
+  double t_final   = 1.0;
+  double coarse_dt = 0.5;
+  double fine_dt   = 0.05;
+
+  auto coarse_propagator = physicsPropagator(*coarse, "temperature", coarse_dt);
+  auto fine_propagator   = physicsPropagator(*fine, "temperature", fine_dt);
+
+  mfem::Vector initial_temperature(fine->temperature());
+
+  // the sequential fine solution, computed redundantly on every time slice
+  mfem::Vector reference(initial_temperature);
+  fine_propagator(0.0, t_final, reference);
+
+  mfem::Vector temperature(initial_temperature);
+  int          iterations = parareal.solve(0.0, t_final, temperature, coarse_propagator, fine_propagator,
+                                           {.max_iterations = num_ranks, .relative_tol = 0.0, .print_level = 1});
+
+  // the iteration is exact after as many iterations as time slices
+  EXPECT_EQ(iterations, num_ranks);
+  EXPECT_TRUE(parareal.converged());
+  ASSERT_EQ(parareal.changes().size(), static_cast<size_t>(num_ranks));
+
+  mfem::Vector error(temperature);
+  error -= reference;
+  double error_norm     = std::sqrt(mfem::InnerProduct(parareal.sliceComm(), error, error));
+  double reference_norm = std::sqrt(mfem::InnerProduct(parareal.sliceComm(), reference, reference));
+  EXPECT_GT(reference_norm, 0.0);
+  EXPECT_LT(error_norm, 1.0e-8 * reference_norm);
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
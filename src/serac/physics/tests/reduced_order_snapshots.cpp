@@ -0,0 +1,112 @@
+// Copyright (c) 2019-2024, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/slic/core/SimpleLogger.hpp"
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/numerics/functional/reduced_order_model.hpp"
+#include "serac/physics/heat_transfer.hpp"
+#include "serac/physics/reduced_order_snapshots.hpp"
+#include "serac/physics/materials/parameterized_thermal_material.hpp"
+#include "serac/physics/state/state_manager.hpp"
+
+namespace serac {
+
+TEST(ReducedOrderSnapshots, ConductivitySweepOfHeatTransfer)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "reduced_order_snapshots");
+
+  std::string mesh_tag{"mesh"};
+  auto& pmesh = StateManager::setMesh(mesh::refineAndDistribute(buildRectangleMesh(8, 8), 0, 0), mesh_tag);
+
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  HeatTransfer<p, dim, Parameters<H1<1>>> thermal(heat_transfer::default_nonlinear_options,
+                                                  heat_transfer::direct_linear_options,
+                                                  heat_transfer::default_static_options, "thermal", mesh_tag,
+                                                  {"conductivity"});
+
+  heat_transfer::ParameterizedLinearIsotropicConductor material;
+  thermal.setMaterial(DependsOn<0>{}, material);
+  thermal.setTemperatureBCs({1, 2, 3, 4}, [](const mfem::Vector&, double) { return 0.0; });
+  thermal.setSource(heat_transfer::ConstantSource{1.0}, EntireDomain(pmesh));
+
+  // conductivity fields k(x) = 1 + a x, for several values of a
+  auto conductivity = [&](double a) {
+    FiniteElementState        k(pmesh, H1<1>{}, "conductivity_sample");
+    mfem::FunctionCoefficient func([a](const mfem::Vector& x, double) { return 1.0 + a * x[0]; });
+    k.project(func);
+    return k;
+  };
+
+  std::vector<FiniteElementState> training;
+  for (double a : {0.0, 0.25, 0.75, 1.0}) {
+    training.push_back(conductivity(a));
+  }
+
+  thermal.setParameter(0, training[0]);
+  thermal.completeSetup();
+
+  std::vector<mfem::Vector> snapshots = collectSnapshots(thermal, "temperature", 0, training, {1.0});
+  ASSERT_EQ(snapshots.size(), training.size());
+
+  // each snapshot is the solution of its own sample
+  auto solve_full = [&](const FiniteElementState& k) {
+    thermal.resetStates();
+    thermal.setParameter(0, k);
+    thermal.advanceTimestep(1.0);
+    return mfem::Vector(thermal.temperature());
+  };
+
+  for (std::size_t i = 0; i < training.size(); i++) {
+    mfem::Vector difference = solve_full(training[i]);
+    difference -= snapshots[i];
+    EXPECT_LT(std::sqrt(mfem::InnerProduct(MPI_COMM_WORLD, difference, difference)), 1.0e-10);
+  }
+
+  ReducedBasis basis = properOrthogonalDecomposition(snapshots, MPI_COMM_WORLD, 1.0e-14);
+  EXPECT_GT(basis.size(), 1);
+  EXPECT_LE(basis.size(), int(snapshots.size()));
+
+  mfem::Vector offset(snapshots[0].Size());
+  offset = 0.0;
+
+  // the best reduced approximation to the full solution of a sample that wasn't in the training set
+  mfem::Vector u_full = solve_full(conductivity(0.5));
+  mfem::Vector q;
+  basis.project(u_full, q);
+
+  ReducedOrderError error = fullOrderError(basis, offset, q, u_full);
+  EXPECT_NEAR(error.solution_error, error.projection_error, 1.0e-12);
+  EXPECT_LT(error.solution_error, 1.0e-2);
+
+  // a reduced solution that misses the full solution by a known amount
+  q *= 0.9;
+  error = fullOrderError(basis, offset, q, u_full);
+  EXPECT_NEAR(error.solution_error, 0.1, 1.0e-2);
+}
+
+}  // namespace serac
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
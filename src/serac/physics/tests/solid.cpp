@@ -228,6 +228,61 @@ void functional_solid_spatial_essential_bc()
   }
 }
 
+// Registering the material and body force with setMaterialAndBodyForce() fuses them into a single domain integral,
+// which should give the same solution as registering them separately
+void functional_solid_fused_material_and_body_force()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 1;
+  constexpr int dim = 3;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_mechanics_fused");
+
+  std::string filename = SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+  auto        mesh     = mesh::refineAndDistribute(buildMeshFromFile(filename), 1, 0);
+
+  std::string mesh_tag{"mesh"};
+  serac::StateManager::setMesh(std::move(mesh), mesh_tag);
+
+  solid_mechanics::NeoHookean             mat{.density = 1.0, .K = 1.0, .G = 1.0};
+  solid_mechanics::ConstantBodyForce<dim> force{{0.0, 0.0, -0.01}};
+
+  NonlinearSolverOptions nonlinear_options{.nonlin_solver  = NonlinearSolver::Newton,
+                                           .relative_tol   = 1.0e-12,
+                                           .absolute_tol   = 1.0e-12,
+                                           .max_iterations = 20};
+
+  auto solve = [&](bool fused) {
+    std::string name         = fused ? "solid_fused" : "solid_unfused";
+    auto        solid_solver = std::make_unique<SolidMechanics<p, dim>>(
+        nonlinear_options, solid_mechanics::direct_linear_options, solid_mechanics::default_quasistatic_options,
+        GeometricNonlinearities::On, name, mesh_tag);
+    if (fused) {
+      solid_solver->setMaterialAndBodyForce(mat, force);
+    } else {
+      solid_solver->setMaterial(mat);
+      solid_solver->addBodyForce(force);
+    }
+
+    auto zero_displacement = [](const mfem::Vector&, mfem::Vector& u) -> void { u = 0.0; };
+    solid_solver->setDisplacementBCs({1}, zero_displacement);
+    solid_solver->setDisplacement(zero_displacement);
+    solid_solver->completeSetup();
+    solid_solver->advanceTimestep(1.0);
+    return solid_solver;
+  };
+
+  auto unfused = solve(false);
+  auto fused   = solve(true);
+
+  mfem::Vector difference(fused->displacement());
+  difference -= unfused->displacement();
+  EXPECT_GT(norm(unfused->displacement()), 0.0);
+  EXPECT_LT(mfem::ParNormlp(difference, 2, MPI_COMM_WORLD), 1.0e-8 * norm(unfused->displacement()));
+}
+
 template <typename lambda>
 struct ParameterizedBodyForce {
   template <int dim, typename T1, typename T2>
@@ -368,6 +423,8 @@ TEST(SolidMechanics, 3DQuadStaticJ2) { functional_solid_test_static_J2(); }
 
 TEST(SolidMechanics, SpatialBoundaryCondition) { functional_solid_spatial_essential_bc(); }
 
+TEST(SolidMechanics, FusedMaterialAndBodyForce) { functional_solid_fused_material_and_body_force(); }
+
 }  // namespace serac
 
 int main(int argc, char* argv[])
@@ -103,7 +103,7 @@ void functional_test_static_3D(double expected_norm)
 }
 
 template <int p>
-void functional_test_shrinking_3D(double expected_norm)
+void functional_test_shrinking_3D(double expected_norm, StaggeredCouplingOptions coupling_options = {})
 {
   MPI_Barrier(MPI_COMM_WORLD);
 
@@ -156,6 +156,7 @@ void functional_test_shrinking_3D(double expected_norm)
   GreenSaintVenantThermoelasticMaterial::State initial_state{};
   auto                                         qdata = thermal_solid_solver.createQuadratureDataBuffer(initial_state);
   thermal_solid_solver.setMaterial(material, qdata);
+  thermal_solid_solver.setCouplingOptions(coupling_options);
 
   // Define the function for the initial temperature
   double theta_0                   = 1.0;
@@ -183,6 +184,81 @@ void functional_test_shrinking_3D(double expected_norm)
 
   // Check the final displacement norm
   EXPECT_NEAR(expected_norm, norm(thermal_solid_solver.displacement()), 1.0e-4);
+
+  ASSERT_EQ(thermal_solid_solver.couplingIterations().size(), 1u);
+  EXPECT_EQ(thermal_solid_solver.cycle(), 1);
+  EXPECT_EQ(thermal_solid_solver.timesteps().size(), 1u);
+  EXPECT_LE(thermal_solid_solver.couplingIterations().back(), coupling_options.max_iterations);
+}
+
+// cools a beam with a dynamic solid, so that the final displacement depends on the temperature
+// seen by every solid substep (and not only the last one)
+template <int p>
+mfem::Vector functional_test_subcycled_dynamics_3D(StaggeredCouplingOptions coupling_options)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int dim = 3;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_functional_subcycled_dynamics");
+
+  std::string filename = SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  auto mesh = mesh::refineAndDistribute(buildMeshFromFile(filename), 1, 0);
+
+  std::string mesh_tag{"mesh"};
+
+  serac::StateManager::setMesh(std::move(mesh), mesh_tag);
+
+  std::set<int> constraint_bdr = {1};
+  std::set<int> temp_bdr       = {1, 2, 3};
+
+  const LinearSolverOptions linear_options = {.linear_solver  = LinearSolver::GMRES,
+                                              .preconditioner = Preconditioner::HypreAMG,
+                                              .relative_tol   = 1.0e-10,
+                                              .absolute_tol   = 1.0e-14,
+                                              .max_iterations = 500,
+                                              .print_level    = 0};
+
+  const NonlinearSolverOptions nonlinear_options = {
+      .relative_tol = 1.0e-10, .absolute_tol = 1.0e-12, .max_iterations = 10, .print_level = 1};
+
+  Thermomechanics<p, dim> thermal_solid_solver(nonlinear_options, linear_options, heat_transfer::default_static_options,
+                                               nonlinear_options, linear_options,
+                                               solid_mechanics::default_timestepping_options,
+                                               GeometricNonlinearities::On, "thermal_solid_functional", mesh_tag);
+
+  double                                       rho       = 1.0;
+  double                                       E         = 1.0;
+  double                                       nu        = 0.0;
+  double                                       c         = 1.0;
+  double                                       alpha     = 1.0e-3;
+  double                                       theta_ref = 2.0;
+  double                                       k         = 1.0;
+  GreenSaintVenantThermoelasticMaterial        material{rho, E, nu, c, alpha, theta_ref, k};
+  GreenSaintVenantThermoelasticMaterial::State initial_state{};
+  auto                                         qdata = thermal_solid_solver.createQuadratureDataBuffer(initial_state);
+  thermal_solid_solver.setMaterial(material, qdata);
+  thermal_solid_solver.setCouplingOptions(coupling_options);
+
+  // start at the reference temperature, and cool down to 1 in the first step
+  auto initial_temperature_field = [theta_ref](const mfem::Vector&, double) -> double { return theta_ref; };
+  auto one                       = [](const mfem::Vector&, double) -> double { return 1.0; };
+
+  thermal_solid_solver.setTemperatureBCs(temp_bdr, one);
+  thermal_solid_solver.setTemperature(initial_temperature_field);
+
+  auto zeroVector = [](const mfem::Vector&, mfem::Vector& u) { u = 0.0; };
+
+  thermal_solid_solver.setDisplacementBCs(constraint_bdr, zeroVector);
+  thermal_solid_solver.setDisplacement(zeroVector);
+
+  thermal_solid_solver.completeSetup();
+
+  thermal_solid_solver.advanceTimestep(1.0);
+
+  return thermal_solid_solver.displacement();
 }
 
 // TODO: investigate this failing test
@@ -339,6 +415,46 @@ TEST(Thermomechanics, thermalContraction)
   serac::functional_test_shrinking_3D<p>(std::sqrt(L * L * L / 3.0) * alpha * delta_theta);
 }
 
+TEST(Thermomechanics, thermalContractionStaggered)
+{
+  constexpr int p           = 2;
+  double        alpha       = 1e-3;
+  double        L           = 8;
+  double        delta_theta = 1.0;
+
+  serac::StaggeredCouplingOptions coupling_options{.max_iterations = 10, .relative_tol = 1.0e-8, .print_level = 1};
+  serac::functional_test_shrinking_3D<p>(std::sqrt(L * L * L / 3.0) * alpha * delta_theta, coupling_options);
+}
+
+TEST(Thermomechanics, thermalContractionSubcycled)
+{
+  constexpr int p           = 2;
+  double        alpha       = 1e-3;
+  double        L           = 8;
+  double        delta_theta = 1.0;
+
+  serac::StaggeredCouplingOptions coupling_options{.thermal_substeps = 4, .solid_substeps = 2};
+  serac::functional_test_shrinking_3D<p>(std::sqrt(L * L * L / 3.0) * alpha * delta_theta, coupling_options);
+}
+
+TEST(Thermomechanics, subcycledStaggeredInterpolatesFromStartOfStepTemperature)
+{
+  constexpr int p = 1;
+
+  // the solid substeps see the temperature interpolated between the start and end of the step, so the coupling
+  // iterations (which warm start the thermal solve from the latest iterate) must reach the single pass result,
+  // up to the (tiny) effect of the thermal expansion on the temperature
+  mfem::Vector single_pass = serac::functional_test_subcycled_dynamics_3D<p>({.solid_substeps = 2});
+  mfem::Vector staggered   = serac::functional_test_subcycled_dynamics_3D<p>(
+      {.max_iterations = 5, .relative_tol = 1.0e-10, .solid_substeps = 2});
+
+  double reference = mfem::ParNormlp(single_pass, 2, MPI_COMM_WORLD);
+  EXPECT_GT(reference, 0.0);
+
+  staggered -= single_pass;
+  EXPECT_LT(mfem::ParNormlp(staggered, 2, MPI_COMM_WORLD), 1.0e-3 * reference);
+}
+
 TEST(Thermomechanics, parameterized)
 {
   // this is the small strain solution, which works with a loose enought tolerance
@@ -95,8 +95,65 @@ void functional_thermal_test_nonlinear()
   }
 }
 
+// Registering the material and source with setMaterialAndSource() fuses them into a single domain integral, which
+// should give the same solution as registering them separately
+void functional_thermal_test_fused_material_and_source()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  constexpr int p   = 2;
+  constexpr int dim = 3;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "heat_transfer_fused");
+
+  std::string filename = SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+
+  std::string mesh_tag{"mesh"};
+
+  auto mesh = mesh::refineAndDistribute(buildMeshFromFile(filename), 0, 0);
+  serac::StateManager::setMesh(std::move(mesh), mesh_tag);
+
+  heat_transfer::IsotropicConductorWithLinearConductivityVsTemperature mat(1.0, 1.0, 1.0, 0.1);
+
+  auto source = [](auto /* X */, auto /* time */, auto u, auto /* du_dx */) { return 1.0 + 0.1 * u; };
+
+  NonlinearSolverOptions nonlinear_options{.nonlin_solver  = NonlinearSolver::Newton,
+                                           .relative_tol   = 1.0e-12,
+                                           .absolute_tol   = 1.0e-12,
+                                           .max_iterations = 20};
+
+  auto solve = [&](bool fused) {
+    std::string name           = fused ? "thermal_fused" : "thermal_unfused";
+    auto        thermal_solver = std::make_unique<HeatTransfer<p, dim>>(
+        nonlinear_options, heat_transfer::default_linear_options, heat_transfer::default_static_options, name,
+        mesh_tag);
+    if (fused) {
+      thermal_solver->setMaterialAndSource(mat, source);
+    } else {
+      thermal_solver->setMaterial(mat);
+      thermal_solver->setSource(source);
+    }
+
+    thermal_solver->setTemperatureBCs({1}, [](const mfem::Vector&, double) { return 0.0; });
+    thermal_solver->completeSetup();
+    thermal_solver->advanceTimestep(1.0);
+    return thermal_solver;
+  };
+
+  auto unfused = solve(false);
+  auto fused   = solve(true);
+
+  mfem::Vector difference(fused->temperature());
+  difference -= unfused->temperature();
+  EXPECT_GT(norm(unfused->temperature()), 0.0);
+  EXPECT_LT(mfem::ParNormlp(difference, 2, MPI_COMM_WORLD), 1.0e-8 * norm(unfused->temperature()));
+}
+
 TEST(HeatTransfer, robin_condition) { functional_thermal_test_nonlinear(); }
 
+TEST(HeatTransfer, fused_material_and_source) { functional_thermal_test_fused_material_and_source(); }
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
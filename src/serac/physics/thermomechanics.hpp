@@ -12,8 +12,12 @@
 
 #pragma once
 
+#include <cmath>
+#include <functional>
+
 #include "mfem.hpp"
 
+#include "serac/numerics/anderson_acceleration.hpp"
 #include "serac/physics/base_physics.hpp"
 #include "serac/physics/thermomechanics_input.hpp"
 #include "serac/physics/solid_mechanics.hpp"
@@ -23,6 +27,30 @@
 
 namespace serac {
 
+/// @brief Options for the staggered (thermal, then solid) coupling iterations of each Thermomechanics timestep
+struct StaggeredCouplingOptions {
+  /// The maximum number of thermal/solid exchanges per timestep, the default of 1 is a single operator-split pass
+  int max_iterations = 1;
+
+  /// Relative tolerance on the change in the exchanged fields, relative to the change of the first exchange
+  double relative_tol = 1.0e-6;
+
+  /// Absolute tolerance on the change in the exchanged fields
+  double absolute_tol = 1.0e-12;
+
+  /// The number of previous iterates used by Anderson mixing (0 for plain fixed-point iterations)
+  int anderson_depth = 3;
+
+  /// Print the coupling residual of each iteration (1), or only a summary of each timestep (0)
+  int print_level = 0;
+
+  /// The number of (equal) heat transfer timesteps taken per coupling step
+  int thermal_substeps = 1;
+
+  /// The number of (equal) solid mechanics timesteps taken per coupling step
+  int solid_substeps = 1;
+};
+
 /**
  * @brief The operator-split thermal-structural solver
  *
@@ -81,7 +109,9 @@ public:
         thermal_(std::move(thermal_solver), thermal_timestepping, physics_name + "thermal", mesh_tag, {"displacement"},
                  cycle, time),
         solid_(std::move(solid_solver), solid_timestepping, geom_nonlin, physics_name + "mechanical", mesh_tag,
-               {"temperature"}, cycle, time)
+               {"temperature"}, cycle, time),
+        thermal_quasistatic_(thermal_timestepping.timestepper == TimestepMethod::QuasiStatic),
+        solid_quasistatic_(solid_timestepping.timestepper == TimestepMethod::QuasiStatic)
   {
     SLIC_ERROR_ROOT_IF(mesh_.Dimension() != dim,
                        axom::fmt::format("Compile time dimension and runtime mesh dimension mismatch"));
@@ -240,27 +270,66 @@ public:
    */
   void advanceTimestep(double dt) override
   {
-    thermal_.setParameter(0, solid_.displacement());
-    thermal_.advanceTimestep(dt);
-
-    solid_.setParameter(0, thermal_.temperature());
-    solid_.advanceTimestep(dt);
+    if (coupling_options_.max_iterations > 1) {
+      staggeredTimestep(dt);
+    } else {
+      mfem::Vector temperature_start(thermal_.temperature());
+      exchangeFields(dt, temperature_start, solid_.displacement(), solid_.displacement());
+      coupling_iterations_.push_back(1);
+    }
 
     cycle_ += 1;
     time_ += dt;
+
+    // the submodules record their own (sub)timesteps, this records the coupling steps
+    if (cycle_ > max_cycle_) {
+      timesteps_.push_back(dt);
+      max_cycle_ = cycle_;
+      max_time_  = time_;
+    }
   }
 
+  /**
+   * @brief Iterate the thermal/solid exchange of each timestep until the exchanged fields stop changing
+   *
+   * @param options The tolerances, iteration limit and Anderson mixing depth of the coupling iterations, and the
+   * number of substeps each submodule takes per coupling step
+   *
+   * @note Iterating requires repeating the submodules' timesteps, so any material state is copied at the start
+   * of each timestep, to be restored before each repeat.
+   *
+   * @note With substeps, each submodule's cycle (and checkpoints, for adjoint analysis) advances by its number of
+   * substeps per coupling step, while the cycle of this module advances by one.
+   */
+  void setCouplingOptions(const StaggeredCouplingOptions& options)
+  {
+    SLIC_ERROR_ROOT_IF(options.max_iterations < 1, "Thermomechanics requires at least one coupling iteration");
+    SLIC_ERROR_ROOT_IF(options.thermal_substeps < 1 || options.solid_substeps < 1,
+                       "Thermomechanics requires at least one substep per coupling step for each submodule");
+    coupling_options_ = options;
+  }
+
+  /**
+   * @brief The number of thermal/solid exchanges taken by each timestep since construction
+   *
+   * @return A vector with one entry per call to advanceTimestep()
+   */
+  const std::vector<int>& couplingIterations() const { return coupling_iterations_; }
+
   /**
    * @brief Create a shared ptr to a quadrature data buffer for the given material type
    *
    * @tparam T the type to be created at each quadrature point
    * @param initial_state the value to be broadcast to each quadrature point
+   * @param storage (optional) whether every quadrature point gets its own storage up front (Dense),
+   *        or only when it departs from `initial_state` (Sparse)
    * @return std::shared_ptr< QuadratureData<T> >
    */
   template <typename T>
-  std::shared_ptr<QuadratureData<T>> createQuadratureDataBuffer(T initial_state)
+  std::shared_ptr<QuadratureData<T>> createQuadratureDataBuffer(
+      T initial_state, QuadratureDataStorage storage = QuadratureDataStorage::Dense)
   {
-    return solid_.createQuadratureDataBuffer(initial_state);
+    return solid_.createQuadratureDataBuffer(initial_state, storage);
   }
 
   /**
@@ -384,6 +453,13 @@ public:
     thermal_.setMaterial(DependsOn<0, active_parameters + 1 ...>{}, ThermalMaterialInterface<MaterialType>{material});
     solid_.setMaterial(DependsOn<0, active_parameters + 1 ...>{}, MechanicalMaterialInterface<MaterialType>{material},
                        qdata);
+
+    // the staggered coupling iterations repeat timesteps, so they need to be able to undo material state updates
+    if constexpr (!std::is_same_v<StateType, Empty>) {
+      auto snapshot  = std::make_shared<QuadratureData<StateType>>(*qdata);
+      save_qdata_    = [qdata, snapshot]() { snapshot->copy_from(*qdata); };
+      restore_qdata_ = [qdata, snapshot]() { qdata->copy_from(*snapshot); };
+    }
   }
 
   /// @overload
@@ -530,11 +606,162 @@ protected:
   using displacement_field = H1<order, dim>;  ///< the function space for the displacement field
   using temperature_field  = H1<order>;       ///< the function space for the temperature field
 
+  /**
+   * @brief Advance both submodules by one coupling step: first the thermal substeps, then the solid substeps
+   *
+   * Each thermal substep uses the displacement interpolated linearly in time between @a displacement_start and
+   * @a displacement_end, and each solid substep uses the temperature interpolated linearly in time between
+   * @a temperature_start and the temperature computed by the thermal substeps.
+   *
+   * @param dt The increment of simulation time of the coupling step
+   * @param temperature_start The temperature at the start of the coupling step
+   * @param displacement_start The displacement at the start of the coupling step
+   * @param displacement_end The (predicted) displacement at the end of the coupling step
+   */
+  void exchangeFields(double dt, const mfem::Vector& temperature_start, const mfem::Vector& displacement_start,
+                      const mfem::Vector& displacement_end)
+  {
+    const int thermal_substeps = coupling_options_.thermal_substeps;
+    const int solid_substeps   = coupling_options_.solid_substeps;
+
+    FiniteElementState exchanged_displacement(solid_.displacement());
+    for (int i = 1; i <= thermal_substeps; i++) {
+      double theta = double(i) / thermal_substeps;
+      mfem::add(1.0 - theta, displacement_start, theta, displacement_end, exchanged_displacement);
+      thermal_.setParameter(0, exchanged_displacement);
+      thermal_.advanceTimestep(dt / thermal_substeps);
+    }
+
+    FiniteElementState exchanged_temperature(thermal_.temperature());
+    for (int i = 1; i <= solid_substeps; i++) {
+      double theta = double(i) / solid_substeps;
+      mfem::add(1.0 - theta, temperature_start, theta, thermal_.temperature(), exchanged_temperature);
+      solid_.setParameter(0, exchanged_temperature);
+      solid_.advanceTimestep(dt / solid_substeps);
+    }
+  }
+
+  /**
+   * @brief Advance both submodules, repeating the thermal/solid exchange until the exchanged fields converge
+   *
+   * The exchange is the fixed-point map x = (temperature, displacement) -> g(x), where g(x) is the result of a
+   * thermal solve (using the displacement of x) followed by a solid solve (using the new temperature). The
+   * iterates are combined with Anderson mixing, and the quasi-static solves are warm-started from the latest one.
+   *
+   * @param dt The increment of simulation time to advance the underlying thermomechanical problem
+   */
+  void staggeredTimestep(double dt)
+  {
+    const auto& temperature  = thermal_.temperature();
+    const auto& displacement = solid_.displacement();
+
+    const int num_temperature_dofs  = temperature.Size();
+    const int num_displacement_dofs = displacement.Size();
+
+    mfem::Vector x(num_temperature_dofs + num_displacement_dofs);
+    mfem::Vector gx(num_temperature_dofs + num_displacement_dofs);
+    mfem::Vector x_temperature(x, 0, num_temperature_dofs);
+    mfem::Vector x_displacement(x, num_temperature_dofs, num_displacement_dofs);
+    mfem::Vector gx_temperature(gx, 0, num_temperature_dofs);
+    mfem::Vector gx_displacement(gx, num_temperature_dofs, num_displacement_dofs);
+
+    x_temperature  = temperature;
+    x_displacement = displacement;
+
+    // the start-of-step fields, captured before any warm start overwrites the states
+    mfem::Vector temperature_start(temperature);
+    mfem::Vector displacement_start(displacement);
+
+    const int thermal_substeps = coupling_options_.thermal_substeps;
+    const int solid_substeps   = coupling_options_.solid_substeps;
+
+    if (save_qdata_) {
+      save_qdata_();
+    }
+
+    AndersonAcceleration anderson(coupling_options_.anderson_depth, comm_);
+
+    double initial_norm = 0.0;
+    bool   converged    = false;
+    int    iterations   = 0;
+    while (!converged && iterations < coupling_options_.max_iterations) {
+      if (iterations > 0) {
+        for (int i = 0; i < thermal_substeps; i++) {
+          thermal_.revertTimestep(dt / thermal_substeps);
+        }
+        for (int i = 0; i < solid_substeps; i++) {
+          solid_.revertTimestep(dt / solid_substeps);
+        }
+        if (restore_qdata_) {
+          restore_qdata_();
+        }
+
+        // warm start from the latest iterate (the states of a transient module are the start-of-step values,
+        // and the latest iterate is only a good guess for the first substep when there is a single substep)
+        if (thermal_quasistatic_ && thermal_substeps == 1) {
+          const_cast<FiniteElementState&>(temperature) = x_temperature;
+        }
+        if (solid_quasistatic_ && solid_substeps == 1) {
+          const_cast<FiniteElementState&>(displacement) = x_displacement;
+        }
+      }
+
+      exchangeFields(dt, temperature_start, displacement_start, x_displacement);
+
+      iterations++;
+
+      gx_temperature  = temperature;
+      gx_displacement = displacement;
+
+      mfem::Vector change(gx);
+      change -= x;
+      double norm = std::sqrt(mfem::InnerProduct(comm_, change, change));
+      if (iterations == 1) {
+        initial_norm = norm;
+      }
+
+      if (coupling_options_.print_level > 0) {
+        SLIC_INFO_ROOT(axom::fmt::format("Thermomechanics coupling iteration {:3} : ||g(x) - x|| = {:13}", iterations,
+                                         norm));
+      }
+
+      converged = norm <= coupling_options_.absolute_tol ||
+                  (iterations > 1 && norm <= coupling_options_.relative_tol * initial_norm);
+
+      if (!converged) {
+        anderson.next(x, gx, x);
+      }
+    }
+
+    coupling_iterations_.push_back(iterations);
+
+    SLIC_INFO_ROOT(axom::fmt::format("Thermomechanics cycle {}: {} coupling iterations{}", cycle_ + 1, iterations,
+                                     converged ? "" : " (not converged)"));
+  }
+
   /// Submodule to compute the heat transfer physics
   HeatTransfer<order, dim, Parameters<displacement_field, parameter_space...>> thermal_;
 
   /// Submodule to compute the mechanics
   SolidMechanics<order, dim, Parameters<temperature_field, parameter_space...>> solid_;
+
+  /// Whether the thermal solve's unknown is the temperature itself, so that it can be warm-started
+  bool thermal_quasistatic_;
+
+  /// Whether the solid solve's unknown is the displacement itself, so that it can be warm-started
+  bool solid_quasistatic_;
+
+  /// Options for the staggered coupling iterations
+  StaggeredCouplingOptions coupling_options_;
+
+  /// The number of thermal/solid exchanges taken by each timestep
+  std::vector<int> coupling_iterations_;
+
+  /// Copy the material state at the start of a timestep (empty when the material has no state)
+  std::function<void()> save_qdata_;
+
+  /// Restore the material state copied by save_qdata_
+  std::function<void()> restore_qdata_;
 };
 
 }  // namespace serac